@@ -0,0 +1,56 @@
+//  See https://github.com/shibatch/tlfloat for our project.
+//        Copyright Naoki Shibata and contributors.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Quad and octuple arithmetic of the C API, compiled once for each
+// instruction set. dispatch.cpp includes this file for the generic
+// x86-64 variant, and dispatch_bmi2.cpp and dispatch_avx512.cpp
+// include it after enabling the target ISA with a pragma. Each of
+// the latter two renames the tlfloat namespace with a macro before
+// including this file, so that their template instantiations get
+// different symbol names and the linker never substitutes one
+// variant for another. The resolvers in dispatch.cpp pick a variant
+// when the library is loaded.
+//
+// If TLFLOAT_DISPATCH_VARIANT is not defined, the functions are
+// defined with their public names.
+
+#ifndef __DISPATCH_HPP_INCLUDED__
+#define __DISPATCH_HPP_INCLUDED__
+
+#include "tlfloat/tlmath.hpp"
+#include "tlfloat/tlfloat.h"
+
+#if defined(TLFLOAT_DISPATCH_VARIANT)
+#define TLFLOAT_DISPATCH_CAT0(x, y) x ## y
+#define TLFLOAT_DISPATCH_CAT(x, y) TLFLOAT_DISPATCH_CAT0(x, y)
+#define TLFLOAT_DISPATCH_NAME(name) TLFLOAT_DISPATCH_CAT(name ## _, TLFLOAT_DISPATCH_VARIANT)
+#define TLFLOAT_DISPATCH_ATTR __attribute__((visibility("hidden")))
+#else
+#define TLFLOAT_DISPATCH_NAME(name) name
+#define TLFLOAT_DISPATCH_ATTR
+#endif
+
+extern "C" {
+  TLFLOAT_DISPATCH_ATTR tlfloat_quad_ TLFLOAT_DISPATCH_NAME(tlfloat_addq)(const tlfloat_quad_ x, const tlfloat_quad_ y) { return (tlfloat_quad_)(tlfloat::Quad(x) + tlfloat::Quad(y)); }
+  TLFLOAT_DISPATCH_ATTR tlfloat_octuple_ TLFLOAT_DISPATCH_NAME(tlfloat_addo)(const tlfloat_octuple_ x, const tlfloat_octuple_ y) { return (tlfloat_octuple_)(tlfloat::Octuple(x) + tlfloat::Octuple(y)); }
+
+  TLFLOAT_DISPATCH_ATTR tlfloat_quad_ TLFLOAT_DISPATCH_NAME(tlfloat_subq)(const tlfloat_quad_ x, const tlfloat_quad_ y) { return (tlfloat_quad_)(tlfloat::Quad(x) - tlfloat::Quad(y)); }
+  TLFLOAT_DISPATCH_ATTR tlfloat_octuple_ TLFLOAT_DISPATCH_NAME(tlfloat_subo)(const tlfloat_octuple_ x, const tlfloat_octuple_ y) { return (tlfloat_octuple_)(tlfloat::Octuple(x) - tlfloat::Octuple(y)); }
+
+  TLFLOAT_DISPATCH_ATTR tlfloat_quad_ TLFLOAT_DISPATCH_NAME(tlfloat_mulq)(const tlfloat_quad_ x, const tlfloat_quad_ y) { return (tlfloat_quad_)(tlfloat::Quad(x) * tlfloat::Quad(y)); }
+  TLFLOAT_DISPATCH_ATTR tlfloat_octuple_ TLFLOAT_DISPATCH_NAME(tlfloat_mulo)(const tlfloat_octuple_ x, const tlfloat_octuple_ y) { return (tlfloat_octuple_)(tlfloat::Octuple(x) * tlfloat::Octuple(y)); }
+
+  TLFLOAT_DISPATCH_ATTR tlfloat_quad_ TLFLOAT_DISPATCH_NAME(tlfloat_divq)(const tlfloat_quad_ x, const tlfloat_quad_ y) { return (tlfloat_quad_)(tlfloat::Quad(x) / tlfloat::Quad(y)); }
+  TLFLOAT_DISPATCH_ATTR tlfloat_octuple_ TLFLOAT_DISPATCH_NAME(tlfloat_divo)(const tlfloat_octuple_ x, const tlfloat_octuple_ y) { return (tlfloat_octuple_)(tlfloat::Octuple(x) / tlfloat::Octuple(y)); }
+
+  TLFLOAT_DISPATCH_ATTR tlfloat_quad_ TLFLOAT_DISPATCH_NAME(tlfloat_fmaq)(const tlfloat_quad_ x, const tlfloat_quad_ y, const tlfloat_quad_ z) { return (tlfloat_quad_)fma(tlfloat::Quad(x), tlfloat::Quad(y), tlfloat::Quad(z)); }
+  TLFLOAT_DISPATCH_ATTR tlfloat_octuple_ TLFLOAT_DISPATCH_NAME(tlfloat_fmao)(const tlfloat_octuple_ x, const tlfloat_octuple_ y, const tlfloat_octuple_ z) { return (tlfloat_octuple_)fma(tlfloat::Octuple(x), tlfloat::Octuple(y), tlfloat::Octuple(z)); }
+
+  TLFLOAT_DISPATCH_ATTR tlfloat_quad_ TLFLOAT_DISPATCH_NAME(tlfloat_sqrtq)(const tlfloat_quad_ x) { return (tlfloat_quad_)sqrt(tlfloat::Quad(x)); }
+  TLFLOAT_DISPATCH_ATTR tlfloat_octuple_ TLFLOAT_DISPATCH_NAME(tlfloat_sqrto)(const tlfloat_octuple_ x) { return (tlfloat_octuple_)sqrt(tlfloat::Octuple(x)); }
+}
+
+#endif // #ifndef __DISPATCH_HPP_INCLUDED__
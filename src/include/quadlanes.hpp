@@ -0,0 +1,398 @@
+//  See https://github.com/shibatch/tlfloat for our project.
+//        Copyright Naoki Shibata and contributors.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Lane-parallel kernels for quad-precision addition, multiplication
+// and FMA. Values are held in SoA form : the high and low 64-bit
+// words of L quad numbers are kept in separate vectors, and carries,
+// 64x64->128 bit products and leading-zero counts are emulated with
+// 64-bit vector operations. The kernels only handle lanes whose
+// operands and result are normal numbers. Every other lane is marked
+// in the returned mask, and the caller has to compute that lane with
+// the scalar Quad operators. Within this domain the results are
+// correctly rounded, and thus bit-identical to the scalar path.
+
+#ifndef __QUADLANES_HPP_INCLUDED__
+#define __QUADLANES_HPP_INCLUDED__
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include "tlfloat/tlfloat.hpp"
+
+namespace tlfloat {
+  namespace detail {
+    template<int L> struct QuadLanesVector;
+    template<> struct QuadLanesVector<2> {
+      typedef uint64_t v_t __attribute__((vector_size(16)));
+      typedef int64_t m_t __attribute__((vector_size(16)));
+    };
+    template<> struct QuadLanesVector<4> {
+      typedef uint64_t v_t __attribute__((vector_size(32)));
+      typedef int64_t m_t __attribute__((vector_size(32)));
+    };
+    template<> struct QuadLanesVector<8> {
+      typedef uint64_t v_t __attribute__((vector_size(64)));
+      typedef int64_t m_t __attribute__((vector_size(64)));
+    };
+
+    template<int L>
+    struct QuadLanes {
+      typedef typename QuadLanesVector<L>::v_t v_t;
+      typedef typename QuadLanesVector<L>::m_t m_t;
+
+      static constexpr uint64_t MANTMASK = (uint64_t(1) << 48) - 1;
+      static constexpr uint64_t SIGNMASK = uint64_t(1) << 63;
+      static constexpr uint64_t BIAS = 16383;
+
+      static inline __attribute__((always_inline)) v_t bcast(uint64_t u) { return v_t{} + u; }
+      static inline __attribute__((always_inline)) v_t mask(m_t c) { return (v_t)c; }
+      static inline __attribute__((always_inline)) v_t sel(v_t m, v_t t, v_t f) { return (t & m) | (f & ~m); }
+
+      // Lanes whose biased exponent is 0 or 0x7fff
+      static inline __attribute__((always_inline)) v_t special(v_t e) { return mask(e - 1 >= 0x7ffe); }
+
+      // Lower 32 bits of each lane are multiplied to a 64-bit product.
+      // Inline assembly is used for AVX2 and AVX-512 since intrinsics
+      // cannot be inlined into functions without the target attribute.
+      static inline __attribute__((always_inline)) v_t mul32(v_t x, v_t y) {
+#if defined(__x86_64__)
+	if constexpr (L == 8) {
+	  v_t r;
+	  __asm__("vpmuludq %2, %1, %0" : "=v" (r) : "v" (x), "v" (y));
+	  return r;
+	} else if constexpr (L == 4) {
+	  v_t r;
+	  __asm__("vpmuludq %2, %1, %0" : "=x" (r) : "x" (x), "x" (y));
+	  return r;
+	} else if constexpr (L == 2) {
+	  return (v_t)_mm_mul_epu32((__m128i)x, (__m128i)y);
+	}
+#endif
+	return (x & 0xffffffff) * (y & 0xffffffff);
+      }
+
+      // Number of leading zeros of each lane. Lanes must not be 0.
+      static inline __attribute__((always_inline)) v_t clz(v_t x) {
+#if defined(__x86_64__)
+	if constexpr (L == 8) {
+	  v_t r;
+	  __asm__("vplzcntq %1, %0" : "=v" (r) : "v" (x));
+	  return r;
+	}
+#endif
+	v_t n = {}, m;
+	m = mask((x >> 32) == 0); n += m & 32; x = sel(m, x << 32, x);
+	m = mask((x >> 48) == 0); n += m & 16; x = sel(m, x << 16, x);
+	m = mask((x >> 56) == 0); n += m &  8; x = sel(m, x <<  8, x);
+	m = mask((x >> 60) == 0); n += m &  4; x = sel(m, x <<  4, x);
+	m = mask((x >> 62) == 0); n += m &  2; x = sel(m, x <<  2, x);
+	m = mask((x >> 63) == 0); n += m &  1;
+	return n;
+      }
+
+      // Returns w[k + q] for each lane, 0 if k + q is out of range
+      template<int N>
+      static inline __attribute__((always_inline)) v_t pick(const v_t (&w)[N], int k, v_t q) {
+	v_t r = {};
+	for(int i=0;i<N;i++) if (i - k >= 0) r |= mask(q == (uint64_t)(i - k)) & w[i];
+	return r;
+      }
+
+      // Shifts an N-word number right by n bits with sticky (0 <= n < 64*N)
+      template<int N>
+      static inline __attribute__((always_inline)) void shrs(v_t (&w)[N], v_t n) {
+	v_t q = n >> 6, r = n & 63, rc = 63 - r, lost = {}, o[N];
+	for(int i=0;i<N;i++) lost |= mask(q > (uint64_t)i) & w[i];
+	lost |= pick(w, 0, q) & ((bcast(1) << r) - 1);
+	for(int i=0;i<N;i++) o[i] = (pick(w, i, q) >> r) | ((pick(w, i+1, q) << 1) << rc);
+	for(int i=0;i<N;i++) w[i] = o[i];
+	w[0] |= mask(lost != 0) & 1;
+      }
+
+      // Shifts an N-word number left by n bits (0 <= n < 64*N)
+      template<int N>
+      static inline __attribute__((always_inline)) void shl(v_t (&w)[N], v_t n) {
+	v_t q = n >> 6, r = n & 63, rc = 63 - r, o[N];
+	for(int i=0;i<N;i++) {
+	  v_t x = {}, y = {};
+	  for(int j=0;j<=i;j++) x |= mask(q == (uint64_t)(i - j)) & w[j];
+	  for(int j=0;j<i;j++) y |= mask(q == (uint64_t)(i - 1 - j)) & w[j];
+	  o[i] = (x << r) | ((y >> 1) >> rc);
+	}
+	for(int i=0;i<N;i++) w[i] = o[i];
+      }
+
+      // Number of leading zeros of an N-word number, which must not be 0
+      template<int N>
+      static inline __attribute__((always_inline)) v_t clzn(const v_t (&w)[N]) {
+	v_t t = w[N-1], n = {};
+	for(int i=N-2;i>=0;i--) {
+	  v_t z = mask(t == 0);
+	  t = sel(z, w[i], t);
+	  n += z & 64;
+	}
+	return n + clz(t);
+      }
+
+      static inline __attribute__((always_inline)) v_t addc(v_t x, v_t y, v_t &c) {
+	v_t s = x + y, t = s + c;
+	c = (mask(s < x) | mask(t < s)) & 1;
+	return t;
+      }
+
+      static inline __attribute__((always_inline)) v_t subb(v_t x, v_t y, v_t &b) {
+	v_t s = x - y, t = s - b;
+	b = (mask(x < y) | mask(s < b)) & 1;
+	return t;
+      }
+
+      // 113 x 113 -> 226 bit product of mantissas with implicit bits.
+      // The operands are split into 32-bit limbs so that every partial
+      // product is a single 32x32->64 bit vector multiplication.
+      static inline __attribute__((always_inline)) void mulMant(v_t (&p)[4], v_t ah, v_t al, v_t bh, v_t bl) {
+	const v_t M32 = bcast(0xffffffff);
+	v_t a[4] = { al, al >> 32, ah, ah >> 32 };
+	v_t b[4] = { bl, bl >> 32, bh, bh >> 32 };
+	v_t col[9] = {};
+	for(int i=0;i<4;i++) {
+	  for(int j=0;j<4;j++) {
+	    v_t t = mul32(a[i], b[j]);
+	    col[i+j] += t & M32;
+	    col[i+j+1] += t >> 32;
+	  }
+	}
+	v_t c = {}, w[8];
+	for(int k=0;k<8;k++) {
+	  v_t t = col[k] + c;
+	  w[k] = t & M32;
+	  c = t >> 32;
+	}
+	for(int k=0;k<4;k++) p[k] = w[2*k] | (w[2*k+1] << 32);
+      }
+
+      // Rounds (mh:ml) to nearest even with the given round and sticky
+      // bits, and then packs the result. e is the biased exponent before
+      // rounding. Lanes that overflow or underflow are added to fb.
+      static inline __attribute__((always_inline)) void roundPack(v_t &rh, v_t &rl, v_t &fb, const v_t &s, const v_t &e, v_t mh, v_t ml, const v_t &rnd, const v_t &sticky) {
+	v_t up = rnd & (sticky | ml) & 1, ml2 = ml + up;
+	mh += mask(ml2 < ml) & 1;
+	ml = ml2;
+	v_t ov = mh >> 49;
+	fb |= special(e) | special(e + ov);
+	rh = (s & SIGNMASK) | ((e + ov) << 48) | ((mh >> ov) & MANTMASK);
+	rl = ml;
+      }
+
+      // x + y. y is negated if negy is true. Returns the mask of lanes
+      // that have to be computed by the scalar path.
+      static inline __attribute__((always_inline)) v_t addsub(v_t &rh, v_t &rl, v_t xh, v_t xl, v_t yh, v_t yl, bool negy) {
+	if (negy) yh ^= SIGNMASK;
+
+	v_t ex = (xh >> 48) & 0x7fff, ey = (yh >> 48) & 0x7fff;
+	v_t fb = special(ex) | special(ey);
+
+	v_t swap = mask((yh & ~SIGNMASK) > (xh & ~SIGNMASK)) | (mask((yh & ~SIGNMASK) == (xh & ~SIGNMASK)) & mask(yl > xl));
+	v_t ah = sel(swap, yh, xh), al = sel(swap, yl, xl), bh = sel(swap, xh, yh), bl = sel(swap, xl, yl);
+	v_t ea = sel(swap, ey, ex), d = ea - sel(swap, ex, ey);
+	v_t sub = mask(((ah ^ bh) & SIGNMASK) != 0);
+
+	// 116-bit mantissas with 3 extra bits at the bottom
+	v_t a[2] = { al << 3, (((ah & MANTMASK) | (MANTMASK + 1)) << 3) | (al >> 61) };
+	v_t b[2] = { bl << 3, (((bh & MANTMASK) | (MANTMASK + 1)) << 3) | (bl >> 61) };
+
+	v_t far = mask(d >= 116);
+	shrs(b, d & 127);
+	b[1] = sel(far, v_t{}, b[1]);
+	b[0] = sel(far, bcast(1), b[0]);
+
+	v_t c = {}, s[2];
+	s[0] = addc(a[0], b[0], c);
+	s[1] = addc(a[1], b[1], c);
+	v_t sc = mask((s[1] >> 52) != 0);
+	s[0] = sel(sc, (s[0] >> 1) | (s[1] << 63) | (s[0] & 1), s[0]);
+	s[1] = sel(sc, s[1] >> 1, s[1]);
+
+	v_t bw = {}, t[2];
+	t[0] = subb(a[0], b[0], bw);
+	t[1] = subb(a[1], b[1], bw);
+	fb |= sub & mask((t[0] | t[1]) == 0);
+	v_t lz = clzn(t) - 12;
+	shl(t, lz & 127);
+
+	v_t h = sel(sub, t[1], s[1]), l = sel(sub, t[0], s[0]);
+	v_t e = ea + sel(sub, -lz, sc & 1);
+
+	roundPack(rh, rl, fb, ah, e, h >> 3, (l >> 3) | (h << 61), l >> 2, mask((l & 3) != 0));
+	return fb;
+      }
+
+      // x * y
+      static inline __attribute__((always_inline)) v_t mul(v_t &rh, v_t &rl, const v_t &xh, const v_t &xl, const v_t &yh, const v_t &yl) {
+	v_t ex = (xh >> 48) & 0x7fff, ey = (yh >> 48) & 0x7fff;
+	v_t fb = special(ex) | special(ey);
+
+	v_t p[4];
+	mulMant(p, (xh & MANTMASK) | (MANTMASK + 1), xl, (yh & MANTMASK) | (MANTMASK + 1), yl);
+
+	// The product is in [2^224, 2^226)
+	v_t top = (p[3] >> 33) & 1, sh = 48 + top;
+	v_t h = (p[2] >> sh) | (p[3] << (64 - sh)), l = (p[1] >> sh) | (p[2] << (64 - sh));
+	v_t sticky = mask(((p[1] & ((bcast(1) << (sh - 1)) - 1)) | p[0]) != 0);
+
+	roundPack(rh, rl, fb, xh ^ yh, ex + ey - BIAS + top, h, l, p[1] >> (sh - 1), sticky);
+	return fb;
+      }
+
+      // x * y + z
+      static inline __attribute__((always_inline)) v_t fma(v_t &rh, v_t &rl, const v_t &xh, const v_t &xl, const v_t &yh, const v_t &yl, const v_t &zh, const v_t &zl) {
+	v_t ex = (xh >> 48) & 0x7fff, ey = (yh >> 48) & 0x7fff, ez = (zh >> 48) & 0x7fff;
+	v_t fb = special(ex) | special(ey) | special(ez);
+
+	// The product is placed so that its top bit is at bit 252 or 253,
+	// and the top bit of the addend is placed at bit 252.
+	v_t p[4];
+	mulMant(p, (xh & MANTMASK) | (MANTMASK + 1), xl, (yh & MANTMASK) | (MANTMASK + 1), yl);
+	p[3] = (p[3] << 28) | (p[2] >> 36);
+	p[2] = (p[2] << 28) | (p[1] >> 36);
+	p[1] = (p[1] << 28) | (p[0] >> 36);
+	p[0] = p[0] << 28;
+
+	v_t q[4] = { v_t{}, v_t{}, zl << 12, (((zh & MANTMASK) | (MANTMASK + 1)) << 12) | (zl >> 52) };
+
+	// The operand with the smaller exponent is shifted right with sticky
+	v_t epz = ex + ey - BIAS, pbig = mask((m_t)(epz - ez) >= 0), d = sel(pbig, epz - ez, ez - epz);
+	v_t far = mask(d >= 256), b[4], t[4];
+	for(int i=0;i<4;i++) { b[i] = sel(pbig, p[i], q[i]); t[i] = sel(pbig, q[i], p[i]); }
+	shrs(t, d & 255);
+	for(int i=1;i<4;i++) t[i] = sel(far, v_t{}, t[i]);
+	t[0] = sel(far, bcast(1), t[0]);
+
+	v_t sp = xh ^ yh, sub = mask(((sp ^ zh) & SIGNMASK) != 0);
+
+	// b + t or b - t, which is negated if it is negative
+	v_t c = sub & 1, r[4];
+	for(int i=0;i<4;i++) r[i] = addc(b[i], t[i] ^ sub, c);
+	v_t neg = sub & mask(c == 0);
+	c = neg & 1;
+	for(int i=0;i<4;i++) r[i] = addc(r[i] ^ neg, v_t{}, c);
+	fb |= sub & mask((r[0] | r[1] | r[2] | r[3]) == 0);
+
+	v_t lz = clzn(r);
+	shl(r, lz & 255);
+
+	v_t e = sel(pbig, epz, ez) + 3 - lz;
+	v_t sticky = mask(((r[2] & ((1ULL << 14) - 1)) | r[1] | r[0]) != 0);
+
+	roundPack(rh, rl, fb, sel(pbig, sp, zh) ^ neg, e, r[3] >> 15, (r[3] << 49) | (r[2] >> 15), r[2] >> 14, sticky);
+	return fb;
+      }
+
+      static inline __attribute__((always_inline)) bool any(v_t m) {
+	uint64_t u = 0;
+	for(int i=0;i<L;i++) u |= m[i];
+	return u != 0;
+      }
+
+      // Deinterleaves L quad numbers into the high and low words
+      static inline __attribute__((always_inline)) void load(v_t &h, v_t &l, const void *ptr) {
+	v_t u[2];
+	memcpy(u, ptr, sizeof(u));
+	if constexpr (L == 2) {
+	  l = __builtin_shufflevector(u[0], u[1], 0, 2);
+	  h = __builtin_shufflevector(u[0], u[1], 1, 3);
+	} else if constexpr (L == 4) {
+	  l = __builtin_shufflevector(u[0], u[1], 0, 2, 4, 6);
+	  h = __builtin_shufflevector(u[0], u[1], 1, 3, 5, 7);
+	} else {
+	  l = __builtin_shufflevector(u[0], u[1], 0, 2, 4, 6, 8, 10, 12, 14);
+	  h = __builtin_shufflevector(u[0], u[1], 1, 3, 5, 7, 9, 11, 13, 15);
+	}
+      }
+
+      static inline __attribute__((always_inline)) void store(void *ptr, v_t h, v_t l) {
+	v_t u[2];
+	if constexpr (L == 2) {
+	  u[0] = __builtin_shufflevector(l, h, 0, 2);
+	  u[1] = __builtin_shufflevector(l, h, 1, 3);
+	} else if constexpr (L == 4) {
+	  u[0] = __builtin_shufflevector(l, h, 0, 4, 1, 5);
+	  u[1] = __builtin_shufflevector(l, h, 2, 6, 3, 7);
+	} else {
+	  u[0] = __builtin_shufflevector(l, h, 0, 8, 1, 9, 2, 10, 3, 11);
+	  u[1] = __builtin_shufflevector(l, h, 4, 12, 5, 13, 6, 14, 7, 15);
+	}
+	memcpy(ptr, u, sizeof(u));
+      }
+    };
+
+    // Array operations processing L elements at a time. T is Quad or
+    // any type with the same representation. dst may be the same array
+    // as the sources.
+
+    template<int L, typename T>
+    static inline __attribute__((always_inline)) void addsubLanes(T *dst, const T *x, const T *y, size_t n, bool neg) {
+      typedef QuadLanes<L> QL;
+      typename QL::v_t xh, xl, yh, yl, rh, rl;
+      size_t i = 0;
+      for(;i + L <= n;i += L) {
+	QL::load(xh, xl, x + i);
+	QL::load(yh, yl, y + i);
+	auto fb = QL::addsub(rh, rl, xh, xl, yh, yl, neg);
+	T r[L];
+	QL::store(r, rh, rl);
+	if (QL::any(fb)) {
+	  for(int j=0;j<L;j++) if (fb[j]) r[j] = (T)(neg ? Quad(x[i+j]) - Quad(y[i+j]) : Quad(x[i+j]) + Quad(y[i+j]));
+	}
+	memcpy((void *)(dst + i), r, sizeof(r));
+      }
+      for(;i<n;i++) dst[i] = (T)(neg ? Quad(x[i]) - Quad(y[i]) : Quad(x[i]) + Quad(y[i]));
+    }
+
+    template<int L, typename T>
+    static inline __attribute__((always_inline)) void mulLanes(T *dst, const T *x, const T *y, size_t n) {
+      typedef QuadLanes<L> QL;
+      typename QL::v_t xh, xl, yh, yl, rh, rl;
+      size_t i = 0;
+      for(;i + L <= n;i += L) {
+	QL::load(xh, xl, x + i);
+	QL::load(yh, yl, y + i);
+	auto fb = QL::mul(rh, rl, xh, xl, yh, yl);
+	T r[L];
+	QL::store(r, rh, rl);
+	if (QL::any(fb)) {
+	  for(int j=0;j<L;j++) if (fb[j]) r[j] = (T)(Quad(x[i+j]) * Quad(y[i+j]));
+	}
+	memcpy((void *)(dst + i), r, sizeof(r));
+      }
+      for(;i<n;i++) dst[i] = (T)(Quad(x[i]) * Quad(y[i]));
+    }
+
+    template<int L, typename T>
+    static inline __attribute__((always_inline)) void fmaLanes(T *dst, const T *x, const T *y, const T *z, size_t n) {
+      typedef QuadLanes<L> QL;
+      typename QL::v_t xh, xl, yh, yl, zh, zl, rh, rl;
+      size_t i = 0;
+      for(;i + L <= n;i += L) {
+	QL::load(xh, xl, x + i);
+	QL::load(yh, yl, y + i);
+	QL::load(zh, zl, z + i);
+	auto fb = QL::fma(rh, rl, xh, xl, yh, yl, zh, zl);
+	T r[L];
+	QL::store(r, rh, rl);
+	if (QL::any(fb)) {
+	  for(int j=0;j<L;j++) if (fb[j]) r[j] = (T)fma(Quad(x[i+j]), Quad(y[i+j]), Quad(z[i+j]));
+	}
+	memcpy((void *)(dst + i), r, sizeof(r));
+      }
+      for(;i<n;i++) dst[i] = (T)fma(Quad(x[i]), Quad(y[i]), Quad(z[i]));
+    }
+  }
+}
+#endif // #ifndef __QUADLANES_HPP_INCLUDED__
@@ -32,6 +32,11 @@
 #define TLFLOAT_VERSION_PATCH
 #endif
 
+#ifndef TLFLOAT_TOOM3_THRESHOLD
+/** BigUInt<N>::mul uses Toom-3 multiplication if N is this value or larger */
+#define TLFLOAT_TOOM3_THRESHOLD 13
+#endif
+
 /*! \cond NO_DOCUMENTATION_WITH_DOXYGEN */
 #define TLFLOAT_NOINLINE
 #define TLFLOAT_INLINE
@@ -44,6 +49,9 @@
 #include <x86intrin.h>
 #define TLFLOAT_ENABLE_X86INTRIN
 #define TLFLOAT_ENABLE_ASM_GNU
+#if defined(__clang__) || __GNUC__ >= 11
+#define TLFLOAT_ENABLE_X86_IFMA
+#endif
 #endif
 
 #if defined(TLFLOAT_COMPILER_SUPPORTS_INT128) && !defined(__CUDA_ARCH__)
@@ -253,6 +261,77 @@ namespace tlfloat {
 #endif
     }
 
+#if defined(TLFLOAT_ENABLE_X86_IFMA)
+    static inline bool cpuSupportsIFMA() {
+#if defined(__AVX512IFMA__)
+      return true;
+#else
+      return __builtin_cpu_supports("avx512ifma");
+#endif
+    }
+
+    template<int I>
+    static inline __attribute__((target("avx512f,avx512ifma"), always_inline))
+    void mul256ifmaStep(__m512i &l0, __m512i &l1, __m512i &h0, __m512i &h1, __m512i b, uint64_t a) {
+      const __m512i z = _mm512_setzero_si512(), va = _mm512_set1_epi64((long long)a);
+      __m512i bs = b;
+      if constexpr (I != 0) bs = _mm512_maskz_alignr_epi64(0xff, b, z, 8 - I);
+      l0 = _mm512_madd52lo_epu64(l0, va, bs);
+      h0 = _mm512_madd52hi_epu64(h0, va, bs);
+      if constexpr (I == 4) {
+	const __m512i bt = _mm512_maskz_alignr_epi64(0xff, z, b, 8 - I);
+	l1 = _mm512_madd52lo_epu64(l1, va, bt);
+	h1 = _mm512_madd52hi_epu64(h1, va, bt);
+      }
+    }
+
+    // 256 x 256 -> 512 bit multiplication with AVX-512 IFMA. The
+    // operands are split into five 52-bit limbs. Each limb of a is
+    // multiplied by all limbs of b at once, and the columns are
+    // accumulated in vector registers without any carry chain.
+    static inline __attribute__((target("avx512f,avx512ifma")))
+    void mul256ifma(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+      const uint64_t M = (uint64_t(1) << 52) - 1;
+      const uint64_t al[5] = {
+	a[0] & M, ((a[0] >> 52) | (a[1] << 12)) & M, ((a[1] >> 40) | (a[2] << 24)) & M,
+	((a[2] >> 28) | (a[3] << 36)) & M, a[3] >> 16
+      };
+      const uint64_t bl[8] = {
+	b[0] & M, ((b[0] >> 52) | (b[1] << 12)) & M, ((b[1] >> 40) | (b[2] << 24)) & M,
+	((b[2] >> 28) | (b[3] << 36)) & M, b[3] >> 16, 0, 0, 0
+      };
+
+      const __m512i vb = _mm512_loadu_si512(bl), z = _mm512_setzero_si512();
+      __m512i l0 = z, l1 = z, h0 = z, h1 = z;
+      mul256ifmaStep<0>(l0, l1, h0, h1, vb, al[0]);
+      mul256ifmaStep<1>(l0, l1, h0, h1, vb, al[1]);
+      mul256ifmaStep<2>(l0, l1, h0, h1, vb, al[2]);
+      mul256ifmaStep<3>(l0, l1, h0, h1, vb, al[3]);
+      mul256ifmaStep<4>(l0, l1, h0, h1, vb, al[4]);
+
+      // The high halves belong to the next column
+      uint64_t c[16];
+      _mm512_storeu_si512(c + 0, _mm512_add_epi64(l0, _mm512_maskz_alignr_epi64(0xff, h0, z, 7)));
+      _mm512_storeu_si512(c + 8, _mm512_add_epi64(l1, _mm512_maskz_alignr_epi64(0xff, h1, h0, 7)));
+
+      uint64_t carry = 0;
+      for(int k=0;k<10;k++) {
+	uint64_t t = c[k] + carry;
+	c[k] = t & M;
+	carry = t >> 52;
+      }
+
+      r[0] = (c[0]      ) | (c[1] << 52);
+      r[1] = (c[1] >> 12) | (c[2] << 40);
+      r[2] = (c[2] >> 24) | (c[3] << 28);
+      r[3] = (c[3] >> 36) | (c[4] << 16);
+      r[4] = (c[4] >> 48) | (c[5] <<  4) | (c[6] << 56);
+      r[5] = (c[6] >>  8) | (c[7] << 44);
+      r[6] = (c[7] >> 20) | (c[8] << 32);
+      r[7] = (c[8] >> 32) | (c[9] << 20);
+    }
+#endif // #if defined(TLFLOAT_ENABLE_X86_IFMA)
+
     template<typename T>
     class SafeArray {
       T* bufPtr;
@@ -292,6 +371,9 @@ namespace tlfloat {
 
     template<typename mant_t, typename longmant_t, int nbexp, int nbmant> class UnpackedFloat;
 
+    template<int W>
+    static constexpr void mulArrayToom3(uint64_t *r, const uint64_t *a, const uint64_t *b);
+
     template<typename T, std::enable_if_t<(std::is_integral_v<T>), int> = 0>
     static constexpr TLFLOAT_INLINE T bitmask(int b) { return (T(1) << b) - 1; }
 
@@ -333,10 +415,31 @@ namespace tlfloat {
     constexpr TLFLOAT_INLINE BigUInt(const BigUInt<N-1>& h, const BigUInt<N-1>& l) : low(l), high(h) {}
 
 #if !defined(TLFLOAT_DOXYGEN)
-    // Karatsuba algorithm
     template<int..., int K = N, std::enable_if_t<(K >= 10), int> = 0>
     static constexpr inline BigUInt mul(const BigUInt<N-1>& lhs, const BigUInt<N-1>& rhs) {
       if (std::is_constant_evaluated()) return BigUInt(lhs.mulhi(rhs), lhs * rhs);
+      if constexpr (N >= TLFLOAT_TOOM3_THRESHOLD) {
+	return mulToom3(lhs, rhs);
+      } else {
+	return mulKaratsuba(lhs, rhs);
+      }
+    }
+
+    // Toom-3 algorithm
+    template<int..., int K = N, std::enable_if_t<(K >= 10), int> = 0>
+    static constexpr inline BigUInt mulToom3(const BigUInt<N-1>& lhs, const BigUInt<N-1>& rhs) {
+      constexpr int W = 1 << (N - 7);
+      uint64_t a[W] = {}, b[W] = {}, r[W * 2] = {};
+      for(int i=0;i<W;i++) { a[i] = lhs.getWord(i); b[i] = rhs.getWord(i); }
+      detail::mulArrayToom3<W>(r, a, b);
+      BigUInt ret(0);
+      for(int i=0;i<W*2;i++) ret.setWord(i, r[i]);
+      return ret;
+    }
+
+    // Karatsuba algorithm
+    template<int..., int K = N, std::enable_if_t<(K >= 10), int> = 0>
+    static constexpr inline BigUInt mulKaratsuba(const BigUInt<N-1>& lhs, const BigUInt<N-1>& rhs) {
       if (lhs.isZero() || rhs.isZero()) return BigUInt(0);
       if (lhs.isAllOne() && rhs.isAllOne()) return BigUInt(~BigUInt<N-1>(1), BigUInt<N-1>(1));
       auto x0tx1 = lhs.high.adc(lhs.low, false), y0ty1 = rhs.high.adc(rhs.low, false);
@@ -362,6 +465,18 @@ namespace tlfloat {
     template<int..., int K = N, std::enable_if_t<(K == 8 || K == 9), int> = 0>
     static constexpr TLFLOAT_INLINE BigUInt mul(const BigUInt<N-1>& lhs, const BigUInt<N-1>& rhs) {
       if (std::is_constant_evaluated()) return BigUInt(lhs.mulhi(rhs), lhs * rhs);
+#if defined(TLFLOAT_ENABLE_X86_IFMA)
+      if constexpr (N == 9) {
+	if (detail::cpuSupportsIFMA()) {
+	  uint64_t a[4], b[4], r[8];
+	  for(int i=0;i<4;i++) { a[i] = lhs.getWord(i); b[i] = rhs.getWord(i); }
+	  detail::mul256ifma(r, a, b);
+	  BigUInt ret(0);
+	  for(int i=0;i<8;i++) ret.setWord(i, r[i]);
+	  return ret;
+	}
+      }
+#endif
       BigUInt ret(0);
       uint64_t ah = 0, am = 0, al = 0;
       const unsigned n = 1 << (N - 7);
@@ -399,6 +514,79 @@ namespace tlfloat {
       return BigUInt(m.first, m.second);
     }
 
+    // Squaring with Karatsuba algorithm : (h + l)^2 gives 2hl with one
+    // half-size squaring instead of a multiplication
+    template<int..., int K = N, std::enable_if_t<(K >= 10), int> = 0>
+    static constexpr inline BigUInt sqr(const BigUInt<N-1>& x) {
+      if (std::is_constant_evaluated()) return mul(x, x);
+      if (x.isZero()) return BigUInt(0);
+      if (x.isAllOne()) return BigUInt(~BigUInt<N-1>(1), BigUInt<N-1>(1));
+      auto x0tx1 = x.high.adc(x.low, false);
+      BigUInt<N-1> z1 = BigUInt<N-1>::sqr(x0tx1.first);
+      unsigned z1c = x0tx1.second;
+      if (x0tx1.second) {
+	for(int i=0;i<2;i++) {
+	  auto t = z1.adc(BigUInt<N-1>(x0tx1.first, 0), false);
+	  z1c += t.second;
+	  z1 = t.first;
+	}
+      }
+      BigUInt<N-1> z0 = BigUInt<N-1>::sqr(x.low), z2 = BigUInt<N-1>::sqr(x.high);
+      auto z0pz2 = z0.adc(z2, false);
+      z1c -= z0pz2.second;
+      auto t = z1.sbc(z0pz2.first, false);
+      return BigUInt(z2, z0) + (BigUInt(z1c - t.second, t.first) << (1 << (N-2)));
+    }
+
+    // Each cross product x_i * x_j (i < j) is computed once, and the
+    // sum of them is doubled before the squares of the words are added
+    template<int..., int K = N, std::enable_if_t<(K == 8 || K == 9), int> = 0>
+    static constexpr TLFLOAT_INLINE BigUInt sqr(const BigUInt<N-1>& x) {
+      if (std::is_constant_evaluated()) return mul(x, x);
+#if defined(TLFLOAT_ENABLE_X86_IFMA)
+      if constexpr (N == 9) {
+	if (detail::cpuSupportsIFMA()) {
+	  uint64_t a[4], r[8];
+	  for(int i=0;i<4;i++) a[i] = x.getWord(i);
+	  detail::mul256ifma(r, a, a);
+	  BigUInt ret(0);
+	  for(int i=0;i<8;i++) ret.setWord(i, r[i]);
+	  return ret;
+	}
+      }
+#endif
+      const unsigned n = 1 << (N - 7);
+      uint64_t r[n * 2] = {};
+      for(unsigned i=0;i<n-1;i++) {
+	uint64_t carry = 0;
+	for(unsigned j=0;j<n;j++) {
+	  if (j <= i) continue;
+	  xpair<uint64_t, uint64_t> m = detail::mul128(x.getWord(i), x.getWord(j));
+	  xpair<uint64_t, bool> a = detail::adc64(false, r[i+j], m.second);
+	  xpair<uint64_t, bool> b = detail::adc64(false, a.first, carry);
+	  r[i+j] = b.first;
+	  carry = m.first + a.second + b.second;
+	}
+	r[i+n] = carry;
+      }
+      BigUInt ret(0);
+      bool c = false;
+      uint64_t msb = 0;
+      for(unsigned i=0;i<n;i++) {
+	xpair<uint64_t, uint64_t> m = detail::mul128(x.getWord(i), x.getWord(i));
+	xpair<uint64_t, bool> a = detail::adc64(c, (r[i*2+0] << 1) | msb, m.second);
+	xpair<uint64_t, bool> b = detail::adc64(a.second, (r[i*2+1] << 1) | (r[i*2+0] >> 63), m.first);
+	msb = r[i*2+1] >> 63;
+	c = b.second;
+	ret.setWord(i*2+0, a.first);
+	ret.setWord(i*2+1, b.first);
+      }
+      return ret;
+    }
+
+    template<int..., int K = N, std::enable_if_t<K == 7, int> = 0>
+    static constexpr TLFLOAT_INLINE BigUInt sqr(const BigUInt<N-1>& x) { return mul(x, x); }
+
     constexpr TLFLOAT_INLINE xpair<BigUInt, bool> inc() const {
       auto rl = low.inc();
       xpair<BigUInt, bool> s(0, false);
@@ -462,6 +650,87 @@ namespace tlfloat {
       return y + y;
     }
 
+    constexpr TLFLOAT_INLINE BigUInt<N+1> mulWord(uint64_t rhs) const {
+      uint64_t r[(1 << (N - 5))] = {}, c = 0;
+      for(int i=0;i<(1 << (N - 6));i++) {
+	xpair<uint64_t, uint64_t> m = detail::mul128(getWord(i), rhs);
+	xpair<uint64_t, bool> t = detail::adc64(false, m.second, c);
+	r[i] = t.first;
+	c = m.first + t.second;
+      }
+      r[1 << (N - 6)] = c;
+      return BigUInt<N+1>(r);
+    }
+
+    // Returns (*this * c) mod 2^(2^N) for a signed 64-bit c
+    constexpr TLFLOAT_INLINE BigUInt mulWordSigned(int64_t c) const {
+      const BigUInt p = (BigUInt)mulWord(c < 0 ? -uint64_t(c) : uint64_t(c));
+      return c < 0 ? -p : p;
+    }
+
+    /*
+      Lehmer's extension of Euclidean algorithm, as described in
+      Algorithm L in Chapter 4.5.2 of The Art of Computer Programming
+      Vol. 2. The quotients are computed from the leading 62 bits of
+      the operands as long as they are guaranteed to be the same as
+      those computed from the whole numbers, and then applied to the
+      whole numbers at a time. If s or t is not null, the cofactors
+      satisfying a * s + b * t == gcd(a, b) modulo 2^(2^N) are also
+      computed.
+    */
+    static constexpr BigUInt gcdLehmer(BigUInt a, BigUInt b, BigUInt *s, BigUInt *t) {
+      BigUInt sa = 1, sb = 0, ta = 0, tb = 1;
+      if (a < b) {
+	BigUInt u = a; a = b; b = u;
+	sa = 0; sb = 1; ta = 1; tb = 0;
+      }
+
+      while(!b.isZero()) {
+	const int nb = a.ilogbp1();
+
+	if (nb <= 64) {
+	  uint64_t x = a.getWord(0), y = b.getWord(0);
+	  while(y != 0) {
+	    const uint64_t q = x / y, r = x - q * y;
+	    x = y; y = r;
+	    if (s) { BigUInt u = sa - (BigUInt)sb.mulWord(q); sa = sb; sb = u; }
+	    if (t) { BigUInt u = ta - (BigUInt)tb.mulWord(q); ta = tb; tb = u; }
+	  }
+	  a = x;
+	  break;
+	}
+
+	uint64_t x = (a >> (nb - 62)).getWord(0), y = (b >> (nb - 62)).getWord(0);
+	int64_t A = 1, B = 0, C = 0, D = 1;
+
+	for(;;) {
+	  if (int64_t(y) + C == 0 || int64_t(y) + D == 0) break;
+	  const uint64_t q = (x + A) / (y + C);
+	  if (q != (x + B) / (y + D)) break;
+	  int64_t u = int64_t(uint64_t(A) - q * uint64_t(C)); A = C; C = u;
+	  u = int64_t(uint64_t(B) - q * uint64_t(D)); B = D; D = u;
+	  const uint64_t r = x - q * y; x = y; y = r;
+	}
+
+	if (B == 0) {
+	  xpair<BigUInt, BigUInt> qr = a.divmod(b);
+	  a = b; b = qr.second;
+	  if (s) { BigUInt u = sa - qr.first * sb; sa = sb; sb = u; }
+	  if (t) { BigUInt u = ta - qr.first * tb; ta = tb; tb = u; }
+	  continue;
+	}
+
+	BigUInt u = a.mulWordSigned(A) + b.mulWordSigned(B);
+	b = a.mulWordSigned(C) + b.mulWordSigned(D); a = u;
+	if (s) { u = sa.mulWordSigned(A) + sb.mulWordSigned(B); sb = sa.mulWordSigned(C) + sb.mulWordSigned(D); sa = u; }
+	if (t) { u = ta.mulWordSigned(A) + tb.mulWordSigned(B); tb = ta.mulWordSigned(C) + tb.mulWordSigned(D); ta = u; }
+      }
+
+      if (s) *s = sa;
+      if (t) *t = ta;
+      return a;
+    }
+
     /*
       In Volume 2: Seminumerical Algorithms, Chapter 4.3:
       Multiple-Precision Arithmetic of The Art of Computer Programming,
@@ -905,6 +1174,33 @@ namespace tlfloat {
       return div(BigUInt<N+1>(*this) << ((1 << N)-1), rhs | (BigUInt(1) << ((1 << N)-1)));
     }
 
+    /** This method finds the same quotient and remainder as
+	divmod2(rhs), without Algorithm D. The quotient is first
+	estimated with reciprocalAprx(), whose error is at most a few
+	thousand units in the last place. This error is then corrected
+	by one Newton step computed from the exact remainder, and the
+	remaining error of at most two is fixed by checking the final
+	remainder. */
+    constexpr TLFLOAT_INLINE xpair<BigUInt, BigUInt> divmod2Newton(const BigUInt& rhs) const {
+      const BigUInt d = rhs | (BigUInt(1) << ((1 << N)-1));
+      const BigUInt recip = d.reciprocalAprx();
+      BigUInt q = mulhiAprx(recip);
+      BigUInt<N+1> r = (BigUInt<N+1>(*this) << ((1 << N)-1)) - BigUInt<N+1>::mul(q, d);
+
+      const bool neg = r.bit((1 << (N+1))-1);
+      const uint64_t e = ((neg ? -r : r) >> ((1 << N)-1)).getWord(0);
+      const uint64_t c = detail::mul128(e, recip.getWord((1 << (N-6))-1)).first;
+      if (neg) {
+	q -= c; r += d.mulWord(c);
+      } else {
+	q += c; r -= d.mulWord(c);
+      }
+
+      while(r.bit((1 << (N+1))-1)) { q--; r += d; }
+      while(!(d > r)) { q++; r -= d; }
+      return xpair<BigUInt, BigUInt>(q, (BigUInt)r);
+    }
+
     constexpr TLFLOAT_INLINE BigUInt mod(const BigUInt& rhs, const BigUInt& recip) const {
       if (rhs == 1) return 0;
       BigUInt q = this->mulhi(recip), m = *this - q * rhs;
@@ -929,14 +1225,16 @@ namespace tlfloat {
       return r;
     }
 
-    constexpr BigUInt gcd(BigUInt b) const {
-      BigUInt a = *this;
-      while(!b.isZero()) {
-	BigUInt t = b;
-	b = a % b;
-	a = t;
-      }
-      return a;
+    /** This method returns the greatest common divisor of this number and b */
+    constexpr BigUInt gcd(const BigUInt& b) const { return gcdLehmer(*this, b, nullptr, nullptr); }
+
+    /** This method returns x in [0, m) such that (*this * x) % m == 1.
+	If there is no such x or m is smaller than 2, 0 is returned. */
+    constexpr BigUInt modinv(const BigUInt& m) const {
+      if (m.isZero() || m == 1) return 0;
+      BigUInt s;
+      if (gcdLehmer(*this % m, m, &s, nullptr) != 1) return 0;
+      return s.msb() ? s + m : s;
     }
 
     //
@@ -988,6 +1286,38 @@ namespace tlfloat {
       if (sign) *this = 1 + ~(*this);
     }
 
+    /**
+     * This class holds a divisor together with its exact reciprocal,
+     * so that numbers can be divided by the same divisor many times
+     * with a multiplication and at most one correction, instead of
+     * Algorithm D.
+     */
+    class Divisor {
+    public:
+      const BigUInt<N> d;
+
+    private:
+      // floor(2^(2^N) / d), or 0 if d is 1
+      const BigUInt<N> recip;
+
+    public:
+      constexpr Divisor(const BigUInt<N>& d) :
+	d(d), recip(d == 1 ? BigUInt<N>(0) : BigUInt::div(BigUInt<N+1>(BigUInt<N>(1), BigUInt<N>(0)), d).first) {
+	assert(!d.isZero());
+      }
+
+      /** This method returns the quotient and remainder of x divided by the divisor */
+      constexpr TLFLOAT_INLINE xpair<BigUInt<N>, BigUInt<N>> divmod(const BigUInt<N>& x) const {
+	if (recip.isZero()) return xpair<BigUInt<N>, BigUInt<N>>(x, 0);
+	BigUInt<N> q = x.mulhi(recip), r = x - q * d;
+	if (!(r < d)) { q++; r -= d; }
+	return xpair<BigUInt<N>, BigUInt<N>>(q, r);
+      }
+
+      constexpr TLFLOAT_INLINE BigUInt<N> div(const BigUInt<N>& x) const { return divmod(x).first; }
+      constexpr TLFLOAT_INLINE BigUInt<N> mod(const BigUInt<N>& x) const { return divmod(x).second; }
+    };
+
     class Montgomery {
       BigUInt<N> ninv(BigUInt<N> n) {
 	BigUInt<N> nr(1);
@@ -1015,22 +1345,113 @@ namespace tlfloat {
 	return reduce(BigUInt<N+1>::mul(x, y));
       }
 
+      constexpr BigUInt<N> sqr(const BigUInt<N>& x) const {
+	return reduce(BigUInt<N+1>::sqr(x));
+      }
+
       constexpr BigUInt<N> transform(const BigUInt<N>& x) const {
 	return BigUInt<N+1>(x, 0).mod(n, recn).low;
       }
 
-      constexpr BigUInt<N> pow(BigUInt<N> a, BigUInt<N> e) const {
-	// a is in Montgomery representation
-	BigUInt<N> r = one;
-  
-	for (;;) {
-	  if (e.getWord(0) & 1) r = mul(r, a);
-	  e >>= 1;
-	  if (e.isZero()) break;
-	  a = mul(a, a);
+      /** Exponentiation with the sliding window method. a and the
+	  returned value are in Montgomery representation. */
+      constexpr BigUInt<N> pow(const BigUInt<N>& a, const BigUInt<N>& e) const {
+	BigUInt<N> r;
+	powWindow<1>(&r, &a, e, 1);
+	return r;
+      }
+
+      /** This method computes r[i] = pow(a[i], e) for i = 0 .. count-1.
+	  The window decomposition of the exponent is shared, and up
+	  to four bases are processed at a time to hide the latency of
+	  multiplication. r and a may point to the same array. */
+      constexpr void pow(BigUInt<N> *r, const BigUInt<N> *a, const BigUInt<N>& e, int count) const {
+	for(int i=0;i<count;i+=BATCH) powWindow<BATCH>(r + i, a + i, e, count - i < BATCH ? count - i : BATCH);
+      }
+
+      /** Simultaneous multi-exponentiation with Straus's method. This
+	  method returns the product of pow(a[i], e[i]) for i = 0 .. K-1,
+	  sharing the squarings among all the bases. a and the
+	  returned value are in Montgomery representation. */
+      template<int K>
+      constexpr BigUInt<N> multipow(const BigUInt<N> (&a)[K], const BigUInt<N> (&e)[K]) const {
+	int nb = 0;
+	for(int k=0;k<K;k++) if (int(e[k].ilogbp1()) > nb) nb = e[k].ilogbp1();
+	const int w = windowSize(nb) < 4 ? windowSize(nb) : 4;
+
+	// a^0, a^1, ..., a^(2^w - 1)
+	BigUInt<N> t[K][16];
+	for(int k=0;k<K;k++) {
+	  t[k][0] = one;
+	  for(int j=1;j<(1 << w);j++) t[k][j] = mul(t[k][j-1], a[k]);
+	}
+
+	BigUInt<N> x = one;
+	bool first = true;
+	for(int i=(nb + w - 1) / w * w - w;i>=0;i-=w) {
+	  if (!first) for(int l=0;l<w;l++) x = sqr(x);
+	  for(int k=0;k<K;k++) {
+	    const unsigned v = unsigned(bits(e[k], i, w));
+	    if (v == 0) continue;
+	    x = first ? t[k][v] : mul(x, t[k][v]);
+	    first = false;
+	  }
 	}
 
-	return r; // r is in Montgomery representation
+	return x;
+      }
+
+    private:
+      static constexpr int BATCH = 4, MAXWINDOW = 6;
+
+      template<int B>
+      constexpr void powWindow(BigUInt<N> *r, const BigUInt<N> *a, const BigUInt<N>& e, const int m) const {
+	const int nb = e.ilogbp1(), w = windowSize(nb);
+
+	// Odd powers a, a^3, a^5, ..., a^(2^w - 1)
+	BigUInt<N> t[B][1 << (MAXWINDOW-1)], x[B];
+	for(int k=0;k<m;k++) {
+	  t[k][0] = a[k];
+	  const BigUInt<N> a2 = sqr(t[k][0]);
+	  for(int j=1;j<(1 << (w-1));j++) t[k][j] = mul(t[k][j-1], a2);
+	  x[k] = one;
+	}
+
+	bool first = true;
+	for(int i=nb-1;i>=0;) {
+	  if (!e.bit(i)) {
+	    for(int k=0;k<m;k++) x[k] = sqr(x[k]);
+	    i--;
+	    continue;
+	  }
+
+	  int j = i - w + 1 < 0 ? 0 : i - w + 1;
+	  while(!e.bit(j)) j++;
+	  const unsigned v = unsigned(bits(e, j, i - j + 1)) >> 1;
+
+	  if (first) {
+	    for(int k=0;k<m;k++) x[k] = t[k][v];
+	  } else {
+	    for(int l=0;l<i-j+1;l++) {
+	      for(int k=0;k<m;k++) x[k] = sqr(x[k]);
+	    }
+	    for(int k=0;k<m;k++) x[k] = mul(x[k], t[k][v]);
+	  }
+
+	  first = false;
+	  i = j - 1;
+	}
+
+	for(int k=0;k<m;k++) r[k] = x[k];
+      }
+
+      static constexpr int windowSize(int nb) {
+	return nb <= 8 ? 1 : nb <= 24 ? 2 : nb <= 80 ? 3 : nb <= 240 ? 4 : nb <= 672 ? 5 : MAXWINDOW;
+      }
+
+      // Bits [p, p+w) of e
+      static constexpr uint64_t bits(const BigUInt<N>& e, int p, int w) {
+	return (e >> p).getWord(0) & ((uint64_t(1) << w) - 1);
       }
     };
   };
@@ -1184,8 +1605,296 @@ namespace tlfloat {
     constexpr TLFLOAT_INLINE xpair<BigUInt, BigUInt> divmod(const BigUInt& rhs) const {
       return xpair<BigUInt, BigUInt> { *this / rhs, *this % rhs };
     }
+
+    /**
+     * This class holds a 64-bit divisor together with its
+     * normalization shift and reciprocal. A BigUInt of any width is
+     * divided by it one word at a time with the 2/1 division of
+     * Möller and Granlund, without a division instruction.
+     */
+    class Divisor {
+    public:
+      const uint64_t d;
+
+    private:
+      const int s;
+      const uint64_t dn, v;
+
+      // Divides (u1, u0) by dn, where u1 < dn
+      constexpr TLFLOAT_INLINE xpair<uint64_t, uint64_t> div2by1(uint64_t u1, uint64_t u0) const {
+	const xpair<uint64_t, uint64_t> p = detail::mul128(v, u1);
+	const xpair<uint64_t, bool> t = detail::adc64(false, p.second, u0);
+	uint64_t q = p.first + u1 + t.second + 1, r = u0 - q * dn;
+	if (r > t.first) { q--; r += dn; }
+	if (r >= dn) { q++; r -= dn; }
+	return xpair<uint64_t, uint64_t>(q, r);
+      }
+
+    public:
+      constexpr Divisor(uint64_t d) :
+	d(d), s(detail::clz64(d)), dn(d << s), v(detail::divmod128_64(~dn, ~uint64_t(0), dn).first) {
+	assert(d != 0);
+      }
+
+      /** This method returns the quotient and remainder of x divided by the divisor */
+      constexpr TLFLOAT_INLINE xpair<uint64_t, uint64_t> divmod(uint64_t x) const {
+	xpair<uint64_t, uint64_t> a = div2by1(s == 0 ? 0 : x >> (64 - s), x << s);
+	return xpair<uint64_t, uint64_t>(a.first, a.second >> s);
+      }
+
+      /** This method returns the quotient and remainder of x divided by the divisor */
+      template<int M>
+      constexpr TLFLOAT_INLINE xpair<BigUInt<M>, uint64_t> divmod(const BigUInt<M>& x) const {
+	constexpr int W = 1 << (M - 6);
+	uint64_t u[W+1] = {}, q[W] = {};
+	for(int i=0;i<W;i++) u[i] = x.getWord(i);
+	u[W] = 0;
+	if (s != 0) {
+	  for(int i=W;i>0;i--) u[i] = (u[i] << s) | (u[i-1] >> (64 - s));
+	  u[0] <<= s;
+	}
+	uint64_t r = u[W];
+	for(int i=W-1;i>=0;i--) {
+	  xpair<uint64_t, uint64_t> a = div2by1(r, u[i]);
+	  q[i] = a.first;
+	  r = a.second;
+	}
+	return xpair<BigUInt<M>, uint64_t>(BigUInt<M>(q), r >> s);
+      }
+
+      template<int M>
+      constexpr TLFLOAT_INLINE BigUInt<M> div(const BigUInt<M>& x) const { return divmod(x).first; }
+      template<int M>
+      constexpr TLFLOAT_INLINE uint64_t mod(const BigUInt<M>& x) const { return divmod(x).second; }
+    };
   };
 
+  namespace detail {
+    /*
+      Multiplication of little-endian arrays of 64-bit words of any
+      length, used by the Toom-3 path of BigUInt::mul. The parts that
+      Toom-3 splits the operands into are a third of the original
+      length plus one word, so they are not BigUInt. Arrays whose
+      length is a power of two are multiplied with BigUInt::mul, and
+      the others with Toom-3 if they are long enough, or with the
+      subtractive variant of Karatsuba algorithm.
+    */
+
+    static_assert(TLFLOAT_TOOM3_THRESHOLD >= 10, "TLFLOAT_TOOM3_THRESHOLD must be 10 or larger");
+
+    // r[0..n) += a[0..m), m <= n. Returns the carry.
+    static constexpr TLFLOAT_INLINE bool addArray(uint64_t *r, int n, const uint64_t *a, int m) {
+      bool c = false;
+      for(int i=0;i<m;i++) {
+	xpair<uint64_t, bool> t = adc64(c, r[i], a[i]);
+	r[i] = t.first;
+	c = t.second;
+      }
+      for(int i=m;i<n && c;i++) c = ++r[i] == 0;
+      return c;
+    }
+
+    // r[0..n) -= a[0..m), m <= n. Returns the borrow.
+    static constexpr TLFLOAT_INLINE bool subArray(uint64_t *r, int n, const uint64_t *a, int m) {
+      bool c = false;
+      for(int i=0;i<m;i++) {
+	xpair<uint64_t, bool> t = sbc64(c, r[i], a[i]);
+	r[i] = t.first;
+	c = t.second;
+      }
+      for(int i=m;i<n && c;i++) c = r[i]-- == 0;
+      return c;
+    }
+
+    static constexpr TLFLOAT_INLINE void negArray(uint64_t *r, int n) {
+      bool c = true;
+      for(int i=0;i<n;i++) {
+	r[i] = ~r[i] + c;
+	c = c && r[i] == 0;
+      }
+    }
+
+    // Replaces a two's complement number with its absolute value, and
+    // returns true if it was negative
+    static constexpr TLFLOAT_INLINE bool absArray(uint64_t *r, int n) {
+      if ((r[n-1] >> 63) == 0) return false;
+      negArray(r, n);
+      return true;
+    }
+
+    // Arithmetic shift right by one bit
+    static constexpr TLFLOAT_INLINE void sarArray(uint64_t *r, int n) {
+      for(int i=0;i<n-1;i++) r[i] = (r[i] >> 1) | (r[i+1] << 63);
+      r[n-1] = uint64_t(int64_t(r[n-1]) >> 1);
+    }
+
+    // Exact division of a two's complement number by 3
+    static constexpr TLFLOAT_INLINE void divexact3Array(uint64_t *r, int n) {
+      uint64_t c = 0;
+      for(int i=0;i<n;i++) {
+	xpair<uint64_t, bool> s = sbc64(false, r[i], c);
+	const uint64_t q = s.first * 0xaaaaaaaaaaaaaaabULL; // inverse of 3 modulo 2^64
+	r[i] = q;
+	c = mul128(q, 3).first + s.second;
+      }
+    }
+
+    template<int W> static constexpr void mulArray(uint64_t *r, const uint64_t *a, const uint64_t *b);
+
+    template<int W>
+    static constexpr void mulArrayBasecase(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+      for(int i=0;i<W*2;i++) r[i] = 0;
+      for(int j=0;j<W;j++) {
+	uint64_t carry = 0;
+	for(int i=0;i<W;i++) {
+	  xpair<uint64_t, uint64_t> m = mul128(a[i], b[j]);
+	  xpair<uint64_t, bool> s = adc64(false, r[i+j], m.second);
+	  xpair<uint64_t, bool> t = adc64(false, s.first, carry);
+	  r[i+j] = t.first;
+	  carry = m.first + s.second + t.second;
+	}
+	r[j+W] = carry;
+      }
+    }
+
+    // (a0 + a1 B)(b0 + b1 B) = a0 b0 + (a0 b0 + a1 b1 - (a0 - a1)(b0 - b1)) B + a1 b1 B^2
+    template<int W>
+    static constexpr void mulArrayKaratsuba(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+      constexpr int H = (W + 1) / 2, L = W - H;
+      uint64_t da[H] = {}, db[H] = {};
+      for(int i=0;i<H;i++) { da[i] = a[i]; db[i] = b[i]; }
+      const bool nega = subArray(da, H, a + H, L), negb = subArray(db, H, b + H, L);
+      if (nega) negArray(da, H);
+      if (negb) negArray(db, H);
+      uint64_t dm[H * 2] = {};
+      mulArray<H>(dm, da, db);
+
+      mulArray<H>(r, a, b);
+      mulArray<L>(r + H * 2, a + H, b + H);
+
+      uint64_t z1[H * 2 + 1] = {};
+      for(int i=0;i<H*2;i++) z1[i] = r[i];
+      addArray(z1, H * 2 + 1, r + H * 2, L * 2);
+      if (nega != negb) {
+	addArray(z1, H * 2 + 1, dm, H * 2);
+      } else {
+	subArray(z1, H * 2 + 1, dm, H * 2);
+      }
+      addArray(r + H, W * 2 - H, z1, H * 2 + 1 < W * 2 - H ? H * 2 + 1 : W * 2 - H);
+    }
+
+    // Evaluates x0 + x1 t + x2 t^2 at t = 1, -1 and -2 into arrays of
+    // K+1 words in two's complement
+    template<int K>
+    static constexpr TLFLOAT_INLINE void evaluateToom3(uint64_t *p1, uint64_t *m1, uint64_t *m2, const uint64_t *x0, const uint64_t *x1, const uint64_t *x2) {
+      constexpr int M = K + 1;
+      for(int i=0;i<K;i++) p1[i] = x0[i];
+      p1[K] = 0;
+      addArray(p1, M, x2, K);
+      for(int i=0;i<M;i++) m1[i] = p1[i];
+      addArray(p1, M, x1, K);
+      subArray(m1, M, x1, K);
+      for(int i=0;i<M;i++) m2[i] = m1[i];
+      addArray(m2, M, x2, K);
+      for(int i=M-1;i>0;i--) m2[i] = (m2[i] << 1) | (m2[i-1] >> 63);
+      m2[0] <<= 1;
+      subArray(m2, M, x0, K);
+    }
+
+    /*
+      Toom-3 with the evaluation points 0, 1, -1, -2 and infinity and
+      the interpolation sequence by Marco Bodrato, "Towards Optimal
+      Toom-Cook Multiplication for Univariate and Multivariate
+      Polynomials in Characteristic 2 and 0", WAIFI 2007.
+    */
+    template<int W>
+    static constexpr void mulArrayToom3(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+      constexpr int K = (W + 2) / 3, M = K + 1, L = M * 2;
+      static_assert(W >= 4);
+
+      uint64_t a2[K] = {}, b2[K] = {};
+      for(int i=0;i<W-K*2;i++) { a2[i] = a[K*2+i]; b2[i] = b[K*2+i]; }
+
+      uint64_t ap1[M] = {}, am1[M] = {}, am2[M] = {}, bp1[M] = {}, bm1[M] = {}, bm2[M] = {};
+      evaluateToom3<K>(ap1, am1, am2, a, a + K, a2);
+      evaluateToom3<K>(bp1, bm1, bm2, b, b + K, b2);
+
+      uint64_t v0[K * 2] = {}, vinf[K * 2] = {}, v1[L] = {}, vm1[L] = {}, vm2[L] = {};
+      mulArray<K>(v0, a, b);
+      mulArray<K>(vinf, a2, b2);
+      mulArray<M>(v1, ap1, bp1);
+      bool neg = absArray(am1, M) != absArray(bm1, M);
+      mulArray<M>(vm1, am1, bm1);
+      if (neg) negArray(vm1, L);
+      neg = absArray(am2, M) != absArray(bm2, M);
+      mulArray<M>(vm2, am2, bm2);
+      if (neg) negArray(vm2, L);
+
+      // r3 = (v(-2) - v(1)) / 3
+      uint64_t r3[L] = {};
+      for(int i=0;i<L;i++) r3[i] = vm2[i];
+      subArray(r3, L, v1, L);
+      divexact3Array(r3, L);
+
+      // r1 = (v(1) - v(-1)) / 2
+      uint64_t r1[L] = {};
+      for(int i=0;i<L;i++) r1[i] = v1[i];
+      subArray(r1, L, vm1, L);
+      sarArray(r1, L);
+
+      // r2 = v(-1) - v(0)
+      uint64_t r2[L] = {};
+      for(int i=0;i<L;i++) r2[i] = vm1[i];
+      subArray(r2, L, v0, K * 2);
+
+      // r3 = (r2 - r3) / 2 + 2 v(inf)
+      negArray(r3, L);
+      addArray(r3, L, r2, L);
+      sarArray(r3, L);
+      addArray(r3, L, vinf, K * 2);
+      addArray(r3, L, vinf, K * 2);
+
+      // r2 = r2 + r1 - v(inf)
+      addArray(r2, L, r1, L);
+      subArray(r2, L, vinf, K * 2);
+
+      // r1 = r1 - r3
+      subArray(r1, L, r3, L);
+
+      // All of r1, r2 and r3 are now non-negative, and the words
+      // beyond the length of the product are zero
+
+      for(int i=0;i<W*2;i++) r[i] = 0;
+      for(int i=0;i<K*2;i++) r[i] = v0[i];
+      for(int i=0;i<K*2 && K*4+i<W*2;i++) r[K*4+i] = vinf[i];
+      addArray(r + K * 1, W * 2 - K * 1, r1, L < W * 2 - K * 1 ? L : W * 2 - K * 1);
+      addArray(r + K * 2, W * 2 - K * 2, r2, L < W * 2 - K * 2 ? L : W * 2 - K * 2);
+      addArray(r + K * 3, W * 2 - K * 3, r3, L < W * 2 - K * 3 ? L : W * 2 - K * 3);
+    }
+
+    template<int W>
+    static constexpr void mulArray(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+      if constexpr (W == 1) {
+	xpair<uint64_t, uint64_t> m = mul128(a[0], b[0]);
+	r[0] = m.second;
+	r[1] = m.first;
+      } else if constexpr (std::bit_width(unsigned(W)) + 6 >= TLFLOAT_TOOM3_THRESHOLD) {
+	mulArrayToom3<W>(r, a, b);
+      } else if constexpr ((W & (W - 1)) == 0) {
+	constexpr int N = std::bit_width(unsigned(W)) + 5;
+	BigUInt<N> x, y;
+	for(int i=0;i<W;i++) { x.setWord(i, a[i]); y.setWord(i, b[i]); }
+	BigUInt<N+1> z = BigUInt<N+1>::mul(x, y);
+	for(int i=0;i<W*2;i++) r[i] = z.getWord(i);
+      } else if constexpr (W < 4) {
+	mulArrayBasecase<W>(r, a, b);
+      } else {
+	mulArrayKaratsuba<W>(r, a, b);
+      }
+    }
+  } // namespace detail
+
+
   /**
    * This is a trivially copyable template class that represents an
    * arbitrary precision signed integer. It can represent an integer
@@ -1278,6 +1987,28 @@ namespace tlfloat {
     constexpr TLFLOAT_INLINE bool isNegative() const { return u.msb(); }
     constexpr TLFLOAT_INLINE bool isZero() const { return u.isZero(); }
 
+    /** This method returns the greatest common divisor of the absolute values of this number and b */
+    constexpr BigInt gcd(const BigInt& b) const { return BigInt(abs().u.gcd(b.abs().u)); }
+
+    /** This method returns the greatest common divisor g of the
+	absolute values of this number and b, and sets *x and *y so that
+	*this * *x + b * *y == g */
+    constexpr BigInt extgcd(const BigInt& b, BigInt *x, BigInt *y) const {
+      BigUInt<N> s, t, g = BigUInt<N>::gcdLehmer(abs().u, b.abs().u, &s, &t);
+      *x = BigInt(u.msb() ? -s : s);
+      *y = BigInt(b.u.msb() ? -t : t);
+      return BigInt(g);
+    }
+
+    /** This method returns x in [0, m) such that (*this * x) mod m ==
+	1. If there is no such x or m is smaller than 2, 0 is returned. */
+    constexpr BigInt modinv(const BigInt& m) const {
+      if (m.u.msb()) return 0;
+      BigUInt<N> a = abs().u % m.u;
+      if (u.msb() && !a.isZero()) a = m.u - a;
+      return BigInt(a.modinv(m.u));
+    }
+
     constexpr TLFLOAT_INLINE BigInt divmod(const BigInt& rhs, const BigUInt<N>& recip, BigInt* mod) const {
       BigUInt<N> r, q = abs().u.divmod(rhs.abs().u, recip, &r);
       if (u.msb() ^ rhs.u.msb()) { q = -q; r = -r; }
@@ -1485,19 +2216,13 @@ namespace tlfloat {
 	buf.memmove(idx-5, "(nil)", 5);
 	idx -= 5;
       } else {
-	if (flag_unsigned) {
-	  BigUInt<N> u = value;
-	  do {
-	    buf[--idx] = digits[int(u % base)];
-	    u /= base;
-	  } while(u > 0);
-	} else {
-	  BigInt<N> v = value;
-	  do {
-	    buf[--idx] = digits[int(v % base)];
-	    v /= base;
-	  } while(v > 0);
-	}
+	const BigUInt<6>::Divisor divisor(base);
+	BigUInt<N> u = value;
+	do {
+	  xpair<BigUInt<N>, uint64_t> a = divisor.divmod(u);
+	  buf[--idx] = digits[a.second];
+	  u = a.first;
+	} while(u > 0);
 	if (precision == 0 && value == 0) idx++;
 	length = bufsize-1 - idx;
 
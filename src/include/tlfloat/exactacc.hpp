@@ -0,0 +1,172 @@
+//  See https://github.com/shibatch/tlfloat for our project.
+//        Copyright Naoki Shibata and contributors.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef __EXACTACC_HPP_INCLUDED__
+#define __EXACTACC_HPP_INCLUDED__
+
+#include <tlfloat/tlfloat.hpp>
+
+namespace tlfloat {
+  /**
+   * This class accumulates sums of floating-point numbers and products
+   * of two floating-point numbers without any rounding error. The
+   * fixed-point register covers the whole range of the products of
+   * two finite numbers, and the accumulated value is rounded only once
+   * when result() is called. Therefore, the result is correctly
+   * rounded and does not depend on the order of additions.
+   *
+   * The register is a sequence of 32-bit digits held in 64-bit signed
+   * limbs. Each addition updates only a few limbs, and carries are
+   * propagated once every 2^28 additions. Partial accumulators can be
+   * combined with merge(), e.g. to reduce the results of threads.
+   *
+   * tlfloat_t can be BFloat16, Half, Float, Double or Quad. The size
+   * of the object is about 16KB for Quad.
+   */
+  template<typename tlfloat_t>
+  class ExactAccumulator {
+    typedef decltype(tlfloat_t::to_Unpacked_t()) Unpacked_t;
+    typedef decltype(Unpacked_t::mant) mant_t;
+    typedef decltype(Unpacked_t::longmant_t_()) longmant_t;
+    typedef std::conditional_t<(sizeof(longmant_t) < 8), uint64_t, longmant_t> gather_t;
+
+    static_assert(Unpacked_t::nbexp_() != 0 && Unpacked_t::nbexp_() <= 15);
+
+    static constexpr int nbmant = Unpacked_t::nbmant_();
+
+    // Exponent of the least significant bit of a denormal number.
+    // The least significant bit of the register is ulpexp * 2.
+    static constexpr int ulpexp = 1 - Unpacked_t::expoffset() - nbmant;
+
+    static constexpr int NBITS = 2 * ((1 << Unpacked_t::nbexp_()) - 3) + 2 * (nbmant + 1) + 64;
+    static constexpr int NLIMBS = NBITS / 32 + 3;
+    static constexpr uint32_t LIMIT = 1U << 28;
+
+    int64_t acc[NLIMBS] = {};
+    uint32_t count = 0;
+    bool isnan = false, ispinf = false, isninf = false, isempty = true, isnegzero = true;
+
+    template<typename T>
+    static constexpr TLFLOAT_INLINE uint64_t word(const T& x, unsigned i) {
+      if constexpr (std::is_integral_v<T>) {
+	return uint64_t(x);
+      } else {
+	return x.getWord(i);
+      }
+    }
+
+    template<typename T>
+    constexpr TLFLOAT_INLINE void addMant(const T& m, int p, bool neg) {
+      for(unsigned j=0;j<(sizeof(T) + 7) / 8;j++) {
+	const uint64_t w = word(m, j);
+	const unsigned q = p + 64 * j, k = q >> 5, r = q & 31;
+	const uint64_t lo = w << r, hi = r == 0 ? 0 : (w >> (64 - r));
+	const int64_t s = -int64_t(neg);
+	acc[k+0] += (int64_t(lo & 0xffffffff) ^ s) - s;
+	acc[k+1] += (int64_t(lo >> 32) ^ s) - s;
+	acc[k+2] += (int64_t(hi) ^ s) - s;
+      }
+      if (++count >= LIMIT) normalize();
+    }
+
+    constexpr void normalize() {
+      for(int i=0;i<NLIMBS-1;i++) {
+	acc[i+1] += acc[i] >> 32;
+	acc[i] &= 0xffffffff;
+      }
+      count = 0;
+    }
+
+    constexpr TLFLOAT_INLINE void addSpecial(const Unpacked_t& x) {
+      if (x.isnan) isnan = true;
+      if (x.isinf) { if (x.sign) isninf = true; else ispinf = true; }
+    }
+
+  public:
+    constexpr ExactAccumulator() = default;
+
+    /** Adds x to the accumulator */
+    constexpr TLFLOAT_INLINE void add(const tlfloat_t& x) {
+      const Unpacked_t u = x.getUnpacked();
+      isempty = false;
+      isnegzero = isnegzero && u.iszero && u.sign;
+      if (u.isnan || u.isinf) { addSpecial(u); return; }
+      if (u.iszero) return;
+      addMant(u.mant, u.exp - ulpexp, u.sign);
+    }
+
+    /** Adds the exact product of x and y to the accumulator */
+    constexpr TLFLOAT_INLINE void addProduct(const tlfloat_t& x, const tlfloat_t& y) {
+      const Unpacked_t u = x.getUnpacked(), v = y.getUnpacked();
+      const bool sign = u.sign != v.sign;
+      isempty = false;
+      isnegzero = isnegzero && (u.iszero || v.iszero) && sign;
+      if (u.isnan || u.isinf || v.isnan || v.isinf) {
+	if (u.isnan || v.isnan || u.iszero || v.iszero) { isnan = true; return; }
+	if (sign) isninf = true; else ispinf = true;
+	return;
+      }
+      if (u.iszero || v.iszero) return;
+      addMant(detail::mul(u.mant, v.mant), u.exp + v.exp, sign);
+    }
+
+    /** Adds the value accumulated in another accumulator to this accumulator */
+    constexpr void merge(const ExactAccumulator& o) {
+      if (count + o.count >= LIMIT) normalize();
+      for(int i=0;i<NLIMBS;i++) acc[i] += o.acc[i];
+      count += o.count + 1;
+      isnan = isnan || o.isnan;
+      ispinf = ispinf || o.ispinf;
+      isninf = isninf || o.isninf;
+      isempty = isempty && o.isempty;
+      isnegzero = isnegzero && o.isnegzero;
+    }
+
+    /** Returns the accumulated value correctly rounded to the nearest representable value */
+    constexpr tlfloat_t result() const {
+      if (isnan || (ispinf && isninf)) return tlfloat_t::nan();
+      if (ispinf || isninf) return tlfloat_t::infinity(isninf);
+
+      ExactAccumulator t = *this;
+      t.normalize();
+      const bool sign = t.acc[NLIMBS-1] < 0;
+      if (sign) {
+	for(int i=0;i<NLIMBS;i++) t.acc[i] = -t.acc[i];
+	t.normalize();
+      }
+
+      int top = NLIMBS-1;
+      while(top >= 0 && t.acc[top] == 0) top--;
+      if (top < 0) return tlfloat_t::zero(!isempty && isnegzero);
+
+      // tb : position of the most significant bit, ub : position of the ULP of the result
+
+      const int tb = top * 32 + 63 - int(detail::clz64(uint64_t(t.acc[top])));
+      int ub = tb - nbmant;
+      if (ub < -ulpexp) ub = -ulpexp;
+
+      gather_t g = 0;
+      for(int i=tb >> 5;i>=(ub >> 5);i--) g = (g << 32) | gather_t(uint32_t(t.acc[i]));
+      mant_t m = mant_t(g >> (ub & 31));
+
+      const int rp = ub - 1;
+      const bool rb = (t.acc[rp >> 5] >> (rp & 31)) & 1;
+      bool sb = (t.acc[rp >> 5] & ((int64_t(1) << (rp & 31)) - 1)) != 0;
+      for(int i=(rp >> 5)-1;i>=0 && !sb;i--) sb = t.acc[i] != 0;
+
+      if (rb && (sb || Unpacked_t::bit(m, 0))) m += 1;
+
+      int64_t e = int64_t(ub) + ulpexp;
+      if (m == (mant_t(1) << (nbmant + 1))) { m >>= 1; e++; }
+
+      if (e >= (1 << Unpacked_t::nbexp_()) - 2) return tlfloat_t::infinity(sign);
+      if (m == 0) return tlfloat_t::zero(sign);
+
+      return tlfloat_t(Unpacked_t(m, int32_t(e), sign, false, false, false));
+    }
+  };
+} // namespace tlfloat
+#endif // #ifndef __EXACTACC_HPP_INCLUDED__
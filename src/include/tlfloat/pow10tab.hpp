@@ -0,0 +1,807 @@
+//  See https://github.com/shibatch/tlfloat for our project.
+//        Copyright Naoki Shibata and contributors.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstdint>
+
+namespace tlfloat {
+  namespace detail {
+    static constexpr int tlfloat_pow10tab_a_words = 6;
+    static constexpr int tlfloat_pow10tab_a_shift = 6;
+    static constexpr int tlfloat_pow10tab_a_min = -77;
+    static constexpr int tlfloat_pow10tab_a_max = 77;
+
+#ifndef __CUDA_ARCH__
+    static constexpr uint64_t tlfloat_pow10tab_a[][6] = {
+#else
+    static __device__ constexpr uint64_t tlfloat_pow10tab_a[][6] = {
+#endif
+      { 0x91eb639d873d0932ULL, 0x2d4142591c37e6c2ULL, 0xda1b3c3dd3889587ULL, 0x73a7380aba84a6b1ULL, 0xbddb2dfde3f8a6e3ULL, 0xb9e5428330737362ULL, },
+      { 0xbfbf23d8340ec472ULL, 0x7e66fc9d7f272fc5ULL, 0xdc628f87c4589f17ULL, 0x2bfb20990dedb270ULL, 0xac63454249b771c8ULL, 0x8d36f6971766349cULL, },
+      { 0x5b88279c459a6cccULL, 0x922af86c3d7570e1ULL, 0x53b2a5bf9b61e838ULL, 0x6b6ff5a002416e72ULL, 0x326cb526b3747638ULL, 0xd68bd3c92066a797ULL, },
+      { 0x81d4231561124cb5ULL, 0x27f0e97696e4119eULL, 0x0a1b8776e70cec81ULL, 0x4c2692ffb4103a61ULL, 0xc62364c260a887e2ULL, 0xa2faa242a3bd093cULL, },
+      { 0xa00bb842448ae415ULL, 0x1d601e750c6d2c63ULL, 0x3ff4fd8f537a8334ULL, 0xa4fbd971b7335438ULL, 0xa6246cc005e1b086ULL, 0xf79cd0bc0a9865e1ULL, },
+      { 0x7eae865931369909ULL, 0x6c7071725158a524ULL, 0x49245cf985eea6b7ULL, 0x4a0ad081b987938aULL, 0x41a8bcd577f7a7d8ULL, 0xbc1905f3e898cca2ULL, },
+      { 0x282f84186d9d0ce4ULL, 0x8808f873e993ab20ULL, 0x722fa8210ca7121aULL, 0xc17503760879f1d7ULL, 0x62648d93cdf05ba2ULL, 0x8ee3393b07698e29ULL, },
+      { 0x99e02a29d2dffbf3ULL, 0x91d3d914021a46b7ULL, 0xdadd9645f360cb51ULL, 0xf290163350ecb3ebULL, 0xa8edffdccfe4db4bULL, 0xd9167ab0c1965798ULL, },
+      { 0x20ad375643cf2953ULL, 0x89c7f892f39a3fabULL, 0xd8ebff5fba5462deULL, 0x890f060f9004cedeULL, 0xd49596808f0f2914ULL, 0xa4e8e60beec08b8fULL, },
+      { 0xddce234edee7e820ULL, 0x74f8c80dd18c3ba7ULL, 0x5d108da0223a3d5fULL, 0x842dc41b89ca32c7ULL, 0x31c0368ccb2c5757ULL, 0xfa8bbf517f29408aULL, },
+      { 0xd1a3c508f6e2eb66ULL, 0xfd4bf35a698519c6ULL, 0x0276eb2becf6ace2ULL, 0x57b5b173d643f3d4ULL, 0x6c682809ba47ff0eULL, 0xbe53771cc8f1b8bbULL, },
+      { 0x4f22ad7605e55919ULL, 0x7353cd70f9e18dddULL, 0xa61fb09d649d06b3ULL, 0x9e48b99391902b00ULL, 0xd6960685c12cd7c1ULL, 0x90948ea6c52e5802ULL, },
+      { 0xa5d427fcdfb3d06cULL, 0xae7bd3042c373693ULL, 0x83bc371bf0dc6ae5ULL, 0x39c70812ffdfd468ULL, 0xf0fc278b7f968212ULL, 0xdba8d6d20f6b5894ULL, },
+      { 0x9834265791e1cf28ULL, 0x04e663ac16d51215ULL, 0x5e2d7403972f6f2bULL, 0x20305d0244e091baULL, 0x2de38123a1c3cffcULL, 0xa6dd04c8d2ce9fdeULL, },
+      { 0xae524f06da038292ULL, 0x1372aef38f32c5e5ULL, 0x9eb9296cc5749dbaULL, 0x48324e275376dfddULL, 0x5052e9289f0f2333ULL, 0xfd83933eda772c0bULL, },
+      { 0xb4380c67d8d17599ULL, 0xbabd7c7617bb450fULL, 0xa6453f6b1f6a06f3ULL, 0x30a0ea226e12164bULL, 0x1a096fc7358788c3ULL, 0xc094aa3eddb202e4ULL, },
+      { 0x56b45f68162ddf81ULL, 0xc753b5f55782ef43ULL, 0xf3017365ac5c688aULL, 0xbf3f2e0ffc99e3cbULL, 0x1436a2dad831490dULL, 0x924b063d1ceb45b3ULL, },
+      { 0xa575a3b4615c99cdULL, 0x78a2d1deaf37c1a9ULL, 0x825b397e11354a97ULL, 0xb171e37a76c65371ULL, 0x1463ef488d5226cbULL, 0xde42ff8d37cad87fULL, },
+      { 0x1286a836e4e13bf3ULL, 0x7d9e71b0dae61786ULL, 0x76485e859b9221afULL, 0x7fc103fc5525486dULL, 0x2409ac6534c33030ULL, 0xa8d7103b2a9fddbfULL, },
+      { 0x9c90718f9e5e2be6ULL, 0x76b7ec28d6b077eeULL, 0xeae08f8e91d839c1ULL, 0xfa0c3128067e32adULL, 0x752cd52fafaf4af1ULL, 0x804233bf4b0b191cULL, },
+      { 0xe8f3c12ac23b68d2ULL, 0x1c6eeb72928cae3cULL, 0x9d2480e6a30373b8ULL, 0x80d0a82031a0123fULL, 0x75af8412a0d013fcULL, 0xc2dcb3d89fb0f90eULL, },
+      { 0xb3a4349ff1397879ULL, 0xe8a6b9c1bb8d6fbdULL, 0x982b64e953ac4e27ULL, 0x45efb05f20cf48b3ULL, 0x4b4de34e0ebc3e06ULL, 0x9406af8f83fd6265ULL, },
+      { 0x8e3063da328e93fcULL, 0x40ae9938642739c8ULL, 0x6ddd26ef279b0d05ULL, 0x294d82f85639fb9cULL, 0x81884dd8cb5eb34aULL, 0xe0e50c894cc21dfdULL, },
+      { 0x03d5906804b3a3a2ULL, 0xa8ad237805053bccULL, 0x980aa8fad888f870ULL, 0x6ad4b3205eb000afULL, 0x5086fdecf2f641c6ULL, 0xaad71a5aab16dc6cULL, },
+      { 0x68f2344ff6f52611ULL, 0x0b96076f83ef4d51ULL, 0x3ba001e967ee3c08ULL, 0x6546f97a4c6298ceULL, 0x5e580222f2f811aeULL, 0x81c72bae7e65dad8ULL, },
+      { 0x1e669d31d0bd682cULL, 0x59cd74957d02432eULL, 0x1c0b623f2299cb95ULL, 0xa42303e570b87e7fULL, 0x9e98cb984f0d3050ULL, 0xc52ba8a6aeb15d92ULL, },
+      { 0x3e54a15c6797911fULL, 0x9352528afcb8c3dfULL, 0x82bfc54641b7630fULL, 0xa0d0f971c37719e7ULL, 0x3615915d6df7666fULL, 0x95c79a5ea669fe86ULL, },
+      { 0xdfb69be53f071991ULL, 0xc7934f7836735217ULL, 0xed2504513092b5cdULL, 0x3b735f721430e99dULL, 0x31ea85e808deba7fULL, 0xe38f15b51b8440f7ULL, },
+      { 0x4026c1a7926d0d16ULL, 0x0dc77c9e045e9837ULL, 0x6b9d538c192cfb1bULL, 0x1c5af3bd4d2c60b5ULL, 0xec41c1793d69d0d1ULL, 0xacdd3555869159d1ULL, },
+      { 0x59e95d7c1dabfdc8ULL, 0xb3dc3b626e1758b1ULL, 0xf81e8a916ca9106bULL, 0xe8a94db92ca5841fULL, 0xe79e236bf8bf47a8ULL, 0x8350bf3c91575a87ULL, },
+      { 0x490bf105cdad0ec8ULL, 0x288b3b97ebbcf2abULL, 0xf8487e84cc0cb08cULL, 0x961cd07660c85d2fULL, 0x4e6570cd8536b61fULL, 0xc7819da48dde4790ULL, },
+      { 0xadfb9d2048643794ULL, 0x9b1360e732b964bfULL, 0xb619c2e78d128abcULL, 0xfdbcb2ba98abab84ULL, 0xe1e20cfd1289138cULL, 0x978dd69af60dc360ULL, },
+      { 0x32428623405f2e05ULL, 0x677eb75a5e9335d2ULL, 0x12bc6fe717ccf422ULL, 0x8ee58fdc35fd6c67ULL, 0xdb67cf7bbbac365aULL, 0xe641334805f3e36fULL, },
+      { 0x6843bc8ae5f5ffdaULL, 0x49e83129b28a1c84ULL, 0xf73aec8b34d883c2ULL, 0xb7d1f78b317fae11ULL, 0xe3187c34500d9ab3ULL, 0xaee973911228abcaULL, },
+      { 0x94cb18be7497b9c8ULL, 0x1f87dd56b6857499ULL, 0x221ae8bf1986af23ULL, 0xd121690c160997acULL, 0x67ac7c1d9ccd8266ULL, 0x84defc62f01c45b0ULL, },
+      { 0x271b8f37a0f57d8fULL, 0xf2df376734a6ad1dULL, 0x42032f9f971bfc07ULL, 0x9fb576046ab35018ULL, 0x474b3cb1fe1d6a7fULL, 0xc9dea80d6283a34cULL, },
+      { 0x13b132398a096b7aULL, 0x25343e32b3a58934ULL, 0xed7c65abc6b00b8aULL, 0x5cbd0ea3f3b06e00ULL, 0x212da7006dc4e43bULL, 0x995974653b7e0231ULL, },
+      { 0x5757dc0dd46c87c9ULL, 0xbc1a50909f029444ULL, 0x49ce2be1d65f0a25ULL, 0x5ad05b84c7c4be7dULL, 0x598eec7d41754c09ULL, 0xe8fb7dc2dec0a404ULL, },
+      { 0x5fb8c7c82af438e5ULL, 0x4c101cb45e4353b1ULL, 0xbf9536f5cf4202a0ULL, 0x217b35d5cf1d588aULL, 0xf73cbde9febc8fceULL, 0xb0fbe7aa6ce75997ULL, },
+      { 0x6693f7ca9fefd841ULL, 0x79e5ea8d5de37287ULL, 0x5a01dfc3ce5de7a5ULL, 0x860aab5af5540ccaULL, 0x138204ea625927f7ULL, 0x8671f14568278beaULL, },
+      { 0x1ae3bbb4be62d6c1ULL, 0xa36992e1b362713cULL, 0x5ef1eebff7941925ULL, 0x47ea18be2f96d249ULL, 0x1d8106ccf8ee85b4ULL, 0xcc42dd5cb5091819ULL, },
+      { 0xe7973a663836ffb6ULL, 0xf70b888660d34946ULL, 0xe752a5fb23fc74c4ULL, 0x660bdfd108ba7989ULL, 0xe393a9c032fb0c34ULL, 0x9b2a840f28a1638fULL, },
+      { 0x7fab230ccf47c161ULL, 0xd0bfd8269c16bd7aULL, 0xe8c5f5a63fd0fbd1ULL, 0x0ccc12293f1d7a58ULL, 0x131565be33dda91aULL, 0xebbe0df0c8201ac5ULL, },
+      { 0xc86ed96eff7d22d5ULL, 0xb231afed8c034fcbULL, 0x8e428200409793dbULL, 0xeed30cce7c442265ULL, 0x9063016130392df7ULL, 0xb314a47728f9cd6cULL, },
+      { 0x009917d909d802adULL, 0x8cd336b3eb2807f4ULL, 0xb226de162a880b07ULL, 0xbb3cdbb623256638ULL, 0xbae63e54a2044dddULL, 0x8809ac32a8a8a8edULL, },
+      { 0x0583c8fe05b57dc3ULL, 0xddddc0dfbb0d6f2cULL, 0x71aad59046c74249ULL, 0x8263ca5cbc774bd9ULL, 0x492512d4f2ead2cbULL, 0xceae534f34362de4ULL, },
+      { 0xa6e853a1edc88a8fULL, 0xcb763e19f9d93a6bULL, 0x09bd1946fa3ceaacULL, 0xe67e4dcd407bd3eeULL, 0x699b5f371124cf4fULL, 0x9d01161bed052bb7ULL, },
+      { 0x812c618f4a87f093ULL, 0xe2c1dfa37c51a9faULL, 0xdf6332a738ad39cdULL, 0x50a8dc181a6ae467ULL, 0xbfe3c33c58668242ULL, 0xee88fce8152a48dfULL, },
+      { 0x4f04f5e86c7bc43aULL, 0x66cd20b7cd8a1fa6ULL, 0xd8adfef042f23094ULL, 0x2bf87d930ebf4396ULL, 0x11800af4bc788512ULL, 0xb533bd05f6e01fedULL, },
+      { 0x9b315382c49275a4ULL, 0xa4ad1c1c7fdce9b9ULL, 0xb62593291c768919ULL, 0xc098e6ed0bfbd6f6ULL, 0x6c83ad1260ff20f4ULL, 0x89a63ba4c497b50eULL, },
+      { 0xd5facf690fe448bcULL, 0xc88dde4d0a1b7ba9ULL, 0xf5f378bd88b5e339ULL, 0x70b449709c8d8001ULL, 0x0fc4eafedd191926ULL, 0xd1211fe37ac6a148ULL, },
+      { 0xd9ebb6f3632bf06bULL, 0x6a35b6e9b642afe2ULL, 0x95abef79db0c6387ULL, 0x6276e8b3738d2f80ULL, 0x52ffa3f3adcdf125ULL, 0x9edd3b40cbf457e6ULL, },
+      { 0x65ab49aed126303cULL, 0x2abf104c6040e49aULL, 0x6d086b163b4631b8ULL, 0x8cf6873ef4426490ULL, 0x75d9b3727e6e5a47ULL, 0xf15c640b2de17b85ULL, },
+      { 0xbc32d0857fdd4186ULL, 0x3480fcf7dd9707e2ULL, 0xfad3d6bb39dfd932ULL, 0x0fd924be26af7592ULL, 0x68e1eb75340122d4ULL, 0xb759449f52a711b2ULL, },
+      { 0xd734164e3c29e3ddULL, 0x5f443dafc7e6a4e1ULL, 0x202349253a58ecc0ULL, 0xa6498798ba280923ULL, 0x1754b16beba6aad6ULL, 0x8b47ae41b64bda30ULL, },
+      { 0x6870815d0df0f6c2ULL, 0xa23b3eb9bbefad51ULL, 0x0c450d29cf87049dULL, 0x4e241e61e269d4e8ULL, 0x7b5b520aa67d2087ULL, 0xd39b595ad755ea09ULL, },
+      { 0x30d6092ab6653aafULL, 0x2958108c43c5adaeULL, 0x63ddfb68f971b0c5ULL, 0x2822e38faf74b26eULL, 0x6e1f7f1642ebaac8ULL, 0xa0bf0465b455e921ULL, },
+      { 0x5eabddc580bbf51cULL, 0xada80215bc062c1bULL, 0xcd5140f638d331b3ULL, 0xddee7f83569c8b33ULL, 0x1f4bf6653cd3b977ULL, 0xf4385d0975edbabeULL, },
+      { 0xa1449d856e247cefULL, 0x694e2be07d3c08c0ULL, 0x4edfad695e16755fULL, 0x9360dcae892a2b6bULL, 0xa7890845b98cde15ULL, 0xb9854ec6332e5955ULL, },
+      { 0x45cad3db77fb1b9aULL, 0x21436532db14ea3fULL, 0xa3804f4d3dfeea1aULL, 0xe4ceee3337dec382ULL, 0x1668cd8fad294d80ULL, 0x8cee12dbe4a0d94dULL, },
+      { 0x182aed2acdabdf00ULL, 0xd554f694baa72f53ULL, 0xa219c141c2ba9b3bULL, 0x7a26b9c407754a71ULL, 0xff2f89082e46b1aeULL, 0xd61d163a16a90d2fULL, },
+      { 0x62702807d10d8cfaULL, 0x5191a70f9e339aa9ULL, 0xc0eaff3755a2ddcdULL, 0xf53e94d1b2357c32ULL, 0x87a601586bd3f698ULL, 0xa2a682a5da57c0bdULL, },
+      { 0x9ccae9322ca1ccddULL, 0x5d2d597802c55e28ULL, 0xa1cfa20a06ef6273ULL, 0x49c126b8ac219f55ULL, 0x52e84de3b97f1642ULL, 0xf71d01e03613f568ULL, },
+      { 0x60e4935c46dde70bULL, 0x04e59967f72fce75ULL, 0x276e3f0f67f0553bULL, 0x00de73d9d5be6974ULL, 0x6d4aa5b50bb5dc0dULL, 0xbbb7ef38bb827f2dULL, },
+      { 0xa659a00b48d630dcULL, 0x90aa2e4bc7632a7eULL, 0xeadb2f393fc07de2ULL, 0xd4e7468e07450e42ULL, 0xe31578d4e269d267ULL, 0x8e997872a9b05ac7ULL, },
+      { 0x2d841994d48af09dULL, 0xf7a7ba9898b3b1f2ULL, 0x39f87391a061c7ddULL, 0x4d0525af79e132c3ULL, 0x5ae1b25946117390ULL, 0xd8a66d4a505de96bULL, },
+      { 0x38de91968b2e53b0ULL, 0xe0e443e7ea11bb45ULL, 0xfd141efbe7ff38ddULL, 0xf2d5c346258da620ULL, 0xd521d9abbfeb2fedULL, 0xa493c75052eb8374ULL, },
+      { 0x5b535f1390f9a26cULL, 0x5fa1efba94d197fcULL, 0x8c59134b7b7ab7f2ULL, 0x112ee12926d4bbd2ULL, 0xd04ee5efc60d3e49ULL, 0xfa0a6cdb8871347cULL, },
+      { 0x089e75912ceb1fd3ULL, 0x2363d15fd592379aULL, 0x42410a94cb61b332ULL, 0xf834911ffc964b3eULL, 0x8904f03c4c1d014aULL, 0xbdf139f0ee5092c6ULL, },
+      { 0xe0e47572dfadea99ULL, 0xfefde89b01e51068ULL, 0xd4c94a9da0693e0cULL, 0xe7317d62209b6a93ULL, 0x7132d332e3f204d4ULL, 0x9049ee32db23d21cULL, },
+      { 0x3ba36c63544121a1ULL, 0x49dae9c810b8c99fULL, 0x5c8a5dc65d745a24ULL, 0x2726c48a85389fa7ULL, 0x84c663cee6b86e7cULL, 0xdb377599b6074244ULL, },
+      { 0x8b5702e0274d2985ULL, 0xd99af864abf96a1cULL, 0xd391c92b7b5f748bULL, 0xa8562a3d2ff7c888ULL, 0x88db9fffd5e6810eULL, 0xa686e3e8b11b0857ULL, },
+      { 0x0fbe25a0fbbc2e2dULL, 0xb1784339fb23f131ULL, 0xb2a230093c93f6fdULL, 0xab9fac96b03d8443ULL, 0x8920b098955522b4ULL, 0xfd00b897478238d0ULL, },
+      { 0x55f3dff45e1bdf17ULL, 0x7a730e52e6e74360ULL, 0x9b03537708b1648fULL, 0xa23e2ed27766e8ccULL, 0xfa911155fefb5308ULL, 0xc0314325637a1939ULL, },
+      { 0x484b92dddd259df4ULL, 0x9b80d07e3b9b33b3ULL, 0x2e63f619de93a2c6ULL, 0x1c5a40917d0fa664ULL, 0x7b6306a34627ddcfULL, 0x91ff83775423cc06ULL, },
+      { 0xee49e1c12e611caaULL, 0xf2f3a45f9009f3c9ULL, 0x4ed775fc49f27952ULL, 0xe26ca6063461fffaULL, 0xac7cb3f6d05ddbdeULL, 0xddd0467c64bce4a0ULL, },
+      { 0xe4926e2d6669a035ULL, 0x6f203147025d1129ULL, 0x0e128b5d938cfb3fULL, 0x2a1fee40d90aab31ULL, 0x3f2398d747b36224ULL, 0xa87fea27a539e9a5ULL, },
+      { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8000000000000000ULL, },
+      { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x50f8080000000000ULL, 0x3cbf6b71c76b25fbULL, 0xc2781f49ffcfa6d5ULL, },
+      { 0x0000000000000000ULL, 0x424ba54f80400000ULL, 0x0bc3c54e3f40f7e6ULL, 0x0234f3fd7b08dd39ULL, 0xc66f336c36b10137ULL, 0x93ba47c980e98cdfULL, },
+      { 0xda76edf9904b8496ULL, 0xfa9cf203c6e28119ULL, 0xceb740079a8b3d33ULL, 0x0f118a2758e233b1ULL, 0x85bbe253f47b1417ULL, 0xe070f78d3927556aULL, },
+      { 0xccd604d64e2ddab2ULL, 0x5a6b43a2a6c495b8ULL, 0xae780c7fea81c788ULL, 0x851e4cbf3de2f98aULL, 0xddbb901b98feeab7ULL, 0xaa7eebfb9df9de8dULL, },
+      { 0xe852dc3a9b708718ULL, 0x2f0717fb4ee5b252ULL, 0x4f0aabd7e1be4da6ULL, 0x21ceb9ec7b8c62edULL, 0xe6a1158300d46640ULL, 0x81842f29f2cce375ULL, },
+      { 0x9cd9bd7f1b92377fULL, 0xba53571ac20aee4eULL, 0x9c34cce922010bacULL, 0xe117befa6fab7d19ULL, 0x1027fff56784f444ULL, 0xc4c5e310aef8aa17ULL, },
+      { 0xf11bc52bc532b997ULL, 0x8ed4d7bad24b81ebULL, 0xffa6738a27dcf7a3ULL, 0x3c11d8430d5c4802ULL, 0xa7ea9c8838ce9437ULL, 0x957a4ae1ebf7f3d3ULL, },
+      { 0x74a24bbae09b3399ULL, 0x0b9a1d7d634df2d8ULL, 0x422d38ea3584cde4ULL, 0x9c6583981d134cbaULL, 0xcc655c54bc5058f8ULL, 0xe319a0aea60e91c6ULL, },
+      { 0x8e4132f3d4a96fefULL, 0xd301326de867459bULL, 0x4a581611df8700f9ULL, 0xb3e40992f8b347e2ULL, 0xc6ebceff061b64c5ULL, 0xac83fb896b6795fcULL, },
+      { 0xf3fc907eb5a42be8ULL, 0xb76197c0ba00694cULL, 0x90d12d8e1d4c7321ULL, 0x2e9c7527d11d4e6bULL, 0x96e4ac8ae2f0a61dULL, 0x830cf791e54a9d1cULL, },
+      { 0x74a151ce19a7bda3ULL, 0x735248561e4a305aULL, 0x50c00f7212e04c7dULL, 0x83689c3cbd362290ULL, 0x9dad43f230e1226eULL, 0xc71aa36a1f8f01cbULL, },
+      { 0x4d963d164f347476ULL, 0x790955debadbbb83ULL, 0x7ced4bde6b367155ULL, 0xb0d7ba426777344dULL, 0x6c8d3fca02ca6de6ULL, 0x973f9ca8cd00a68cULL, },
+      { 0x0731e1a414f934e7ULL, 0xbf5c3af576f4beaeULL, 0x4b5901995e76a174ULL, 0x52210ac35b45b385ULL, 0x23114665acc60d3bULL, 0xe5ca5a0b8d737f0eULL, },
+      { 0x7ff8ae6b353cdcfdULL, 0xbb54fe741343c52fULL, 0xf48b51375df06e86ULL, 0x412fe9e72afd355eULL, 0x870a8d87239d8f35ULL, 0xae8f2b2ce3d5dbe9ULL, },
+      { 0xa7897926b8ed044bULL, 0xec7aaa1988887481ULL, 0x5676d47a6f66702bULL, 0xbbd356dd36f14528ULL, 0xc832a5685e79350cULL, 0x849a672a0d2ecfd1ULL, },
+      { 0x4a9cf154d24daa37ULL, 0x253069a5c329f9afULL, 0xd6f4b6d27bd1c61cULL, 0x526b988275249b0fULL, 0x650d3d28f18b50ceULL, 0xc976758681750c17ULL, },
+      { 0xb233584e0b3c877aULL, 0xf6523611ec437be2ULL, 0xb1f68718ca0242b6ULL, 0x06a04e1f1626b5d2ULL, 0x1eac5b7d1142d87cULL, 0x990a4d36997a9834ULL, },
+      { 0x1c02a1dab10ed82aULL, 0x699573031c3c6730ULL, 0x4d789b006e44eaf3ULL, 0x0e2bc6f6e25d9e83ULL, 0xdc18d6ce622438a3ULL, 0xe8833c181c3bbfe0ULL, },
+      { 0xe5f3e00e160cb6f6ULL, 0x25f2d8d5c4338f1dULL, 0x38e55892ccddb68eULL, 0x5ecc5ab963d91b0bULL, 0x026b8897e82cde8dULL, 0xb0a08d798abce436ULL, },
+      { 0x6b25772eade5ee2fULL, 0xc7b2ab3e451b3e08ULL, 0xb8a89f2441e0083fULL, 0xecff2e2c1eae9db9ULL, 0x085bccd5c05ee9f9ULL, 0x862c8c0eeb856ecbULL, },
+      { 0x668f6b75f9733677ULL, 0x6812a3774bbb1902ULL, 0xd8adfb2e00494c5eULL, 0x72435286baf0e84eULL, 0xbeb7fbdc1cbe8b37ULL, 0xcbd96ed6466cf081ULL, },
+      { 0xe66c18ac4e4ed2c0ULL, 0x77c45ef3b7c8e132ULL, 0xe00e35abda0c5952ULL, 0x57e155f4ae05d035ULL, 0x2f1a208fdedff747ULL, 0x9ada6cd496ef0e05ULL, },
+      { 0x807967b7efdcb7a2ULL, 0x58156c687997f4b8ULL, 0xfe834dce2059475eULL, 0xf0c01c012927f616ULL, 0xbc921b2c3eb25c7bULL, 0xeb445f92a877bb09ULL, },
+      { 0x9195f5f997a43a58ULL, 0x4f0cb5b821dad78eULL, 0x0badb504e5728cb4ULL, 0x7704bd1bb5a5802fULL, 0x4257ac3b4c1d7794ULL, 0xb2b8353b3993a7e4ULL, },
+      { 0x123934f0420eae25ULL, 0xa288259c7f8053cfULL, 0x82171c2863dc80b5ULL, 0x779afc75bb5d53beULL, 0x532430e7002aca8eULL, 0x87c37487ccf4b0bfULL, },
+      { 0xc94284a63bb0afc8ULL, 0x087a94b85ad2db3eULL, 0x562ca41d21f9f2ceULL, 0x5b1545b7a4a86071ULL, 0x7877892520ee1715ULL, 0xce43a50ae4f7fb8eULL, },
+      { 0x6aec8fdc6cf87284ULL, 0x9896cb6e5594c065ULL, 0x2239a394574e2e86ULL, 0x5c0648c4e9e45faaULL, 0x2e61aa868501e740ULL, 0x9cb00bfd6f025339ULL, },
+      { 0x3b94889af844b2a9ULL, 0xa0f174e327921d03ULL, 0xbf34ff7963028cd9ULL, 0xc20578fa3851488bULL, 0x2d4070f33b21ab7bULL, 0xee0ddd84924ab88cULL, },
+      { 0xe9b499e5c6a8d9f8ULL, 0x16aa5ce6db2a4498ULL, 0xdcfa6ad81bf61987ULL, 0xd92f8109437a02b1ULL, 0xf33ce3d6f17b62d1ULL, 0xb4d63576caa95365ULL, },
+      { 0x78fc3d647b9c0389ULL, 0x9946f0b1c577426dULL, 0xc2a7c78bc844d71eULL, 0xdea7bf8e2153308dULL, 0xbc3bc2377649deefULL, 0x895f2f074b86004cULL, },
+      { 0x0d8898224e1ee76dULL, 0x28f345e146ee6058ULL, 0xaebd2aef647650daULL, 0x351091ed9695d569ULL, 0xfc8ea8820c829fe6ULL, 0xd0b52e179d84f732ULL, },
+      { 0x1b93cf2ee5ca6f7eULL, 0x8b21c11eb962b1b6ULL, 0x77154ce2bcba1964ULL, 0x6a3197bbebe3034fULL, 0xa74d28ce329ace52ULL, 0x9e8b3b5dc53d5de4ULL, },
+      { 0xf9c943408d87907cULL, 0x6ead47aae0c0e71eULL, 0x23e0fe4273aabd5bULL, 0x95d9ca3d05c2de20ULL, 0x6e2cb3e7e6c76433ULL, 0xf0dfcf43277d1129ULL, },
+      { 0xf07d9b2b155f2d7dULL, 0x474c52445b88a20eULL, 0x6ae82736619c70a4ULL, 0x006deaf7b163aa51ULL, 0x180f7fcdf9f88b9dULL, 0xb6faa16ac604d6f6ULL, },
+      { 0xf60aa963f4165ed7ULL, 0xafccc453ceb4460aULL, 0x63093ad0caadb06cULL, 0x31be1482014cdaf0ULL, 0x1e34291b1ef566c7ULL, 0x8affca2bd1f88549ULL, },
+      { 0x971cf7fbcef2c146ULL, 0x1bfedf3a72c6fcc2ULL, 0xe701f7bc8d1a0383ULL, 0x03baa2f38e35464fULL, 0x3f50c802040f4cccULL, 0xd32e203241f4806fULL, },
+      { 0x33d54c7b01dddf49ULL, 0xec8eebcbbbe9e8a9ULL, 0x0c61cdd68ac8e8b5ULL, 0x1f17dfae241cfad8ULL, 0xd51af6a3244a6983ULL, 0xa06c0bd4ce9db63fULL, },
+      { 0x990e291101ee0ab8ULL, 0xbde48d8e84c30280ULL, 0x155051a9ae17e1c9ULL, 0xe182161815aa3827ULL, 0x17f49abd213c38b8ULL, 0xf3ba4e7089c084e0ULL, },
+      { 0xc2a2acf1e19432d2ULL, 0x5ac5d0f468faf5ccULL, 0x5d512195d0175bc1ULL, 0xe906612b94cc94b7ULL, 0x0c1beb6383dd861cULL, 0xb9258c901050bc53ULL, },
+      { 0xcb8136603ca815e1ULL, 0x3a3c029775f0bbc7ULL, 0x126d388625960d50ULL, 0xaef839a8a7f6a14cULL, 0x5dfed09922680a06ULL, 0x8ca554c020a1f0a6ULL, },
+      { 0x28520b97eaba0b48ULL, 0xfa55375b6d9f954cULL, 0x93fc56e82f86fdecULL, 0x616a13318ff341b2ULL, 0x1e914685a756a7d6ULL, 0xd5ae91d3ff7a6f8eULL, },
+      { 0x7b380f1b33140fecULL, 0x96f07123693c2c9bULL, 0x8cd036553f38a1e8ULL, 0x5e997e9f45d7897dULL, 0xf09e780bcc8238d9ULL, 0xa2528e74eaf101fcULL, },
+      { 0xeff4058acd7af586ULL, 0x72cb4bad26c68a8eULL, 0x3cb8494e84b16f5bULL, 0x507a83727a7becf5ULL, 0x5e0a5c3957f5dbb8ULL, 0xf69d74fc97aee56aULL, },
+      { 0x8749f1268da70ca6ULL, 0x242a31e92e389631ULL, 0x10e980a1c0ccfd83ULL, 0x6fc5802cde0b3272ULL, 0x4c808753bb22fef8ULL, 0xbb570a9a9bd977ccULL, },
+      { 0x6843ae943acd1db5ULL, 0x02c0d0e3de121198ULL, 0xc6a9720eef2ccaa1ULL, 0x452107c368a41805ULL, 0xd1445b3f1cc9a09cULL, 0x8e4fddbbd3e242b6ULL, },
+      { 0xdd0c36a5efd2df0aULL, 0xbe031d99282d54f6ULL, 0x765ffec978435914ULL, 0x2839eebbd2636ad9ULL, 0xb1a05a0d64a2e6e8ULL, 0xd83699ba2ae37e0cULL, },
+      { 0xa1b314893eaa465aULL, 0x6711f093bde8b6bfULL, 0xd83ca9b2bffd7a99ULL, 0xac18f659182b0e63ULL, 0xba5da243711d4f39ULL, 0xa43ed4844001a59eULL, },
+      { 0x21b71cc33d5d6448ULL, 0x79b6709cee8b1b63ULL, 0x7c9361e0fab6d091ULL, 0xf02c90b784b4227aULL, 0xfdd08c4da13655ecULL, 0xf9895d25d88b5a8aULL, },
+      { 0x1b80ad35cdb73d3fULL, 0x73d05b9044343ad8ULL, 0x302349e12f45c73fULL, 0xb494bcc96d53e49cULL, 0x566765461bd2f61bULL, 0xbd8f2f7a1ba47d6dULL, },
+      { 0x03b07f6a44631549ULL, 0x969faf950e7a4b5eULL, 0xb802599e6f482a0aULL, 0x357c0a5a746a6e67ULL, 0x36ff0ad5e3a835b0ULL, 0x8fff7443ec2f51edULL, },
+      { 0x0d240c450d307022ULL, 0x01e559724ab5af08ULL, 0x18135131d3bd6276ULL, 0xbeb1ad9e2863c8c1ULL, 0x032727c1ccef13baULL, 0xdac64ee70f466ae5ULL, },
+      { 0xaa9627d4a07c3e08ULL, 0x693038e326f394eeULL, 0x0c7a3cbe3d82a042ULL, 0xfca81f202c5d111aULL, 0x50e3660235410f98ULL, 0xa630ef7d5699fe45ULL, },
+      { 0x01311da2a5d6ce0cULL, 0xce63bf37237379ccULL, 0x4b12afaa89fdde70ULL, 0x192df5f08f7399f1ULL, 0x7119aa2c0c5ee694ULL, 0xfc7e217a6ace9f0fULL, },
+      { 0x96f0772b9693af6cULL, 0x219eedca202f6620ULL, 0x5e72b10d5be4a787ULL, 0x9c65e36ac2d966acULL, 0xda1276a2f5debc0bULL, 0xbfce0f5ab8a6761dULL, },
+      { 0x9ce15d452700484aULL, 0xff59a49257e5edebULL, 0x69ee0def60b61c3dULL, 0xead238211605495cULL, 0xf739f1ca6f8ae61eULL, 0x91b427ab57bce6adULL, },
+      { 0x358359813545ec85ULL, 0x3ac56bdd8342772eULL, 0x134ca67a679b84aeULL, 0x8909e424a112a3cdULL, 0x95aa118ec1d08317ULL, 0xdd5dc8a2bf27f3f7ULL, },
+      { 0xca439bfd79112a06ULL, 0x8ea86c4ab22851bbULL, 0x647f228805a4c604ULL, 0x5e943a525ef980dbULL, 0xe012eb55f30d3c0aULL, 0xa828f10fb963c71cULL, },
+      { 0x3c31f2c5b28d209bULL, 0xe76f02d2785c5abbULL, 0x4f2c2f1e5d743ac6ULL, 0xb96684a8f9a28e61ULL, 0xbb2215057a199356ULL, 0xff7bdcd8f586aed0ULL, },
+      { 0x6e6b11dad8a90237ULL, 0x142f2f4ea6d4c374ULL, 0xbfa81d83029ec0faULL, 0xa524d2082aac030dULL, 0x421ddc40535f78b3ULL, 0xc213bea5c91f03d8ULL, },
+      { 0x4b8cc1062c2a172aULL, 0x708c8a72ef8d8fd4ULL, 0x6f75529546ee8b59ULL, 0xd2fea4fd957ea18eULL, 0x8c474bb609f40287ULL, 0x936e07737dc64f6dULL, },
+      { 0x5ba5801ac5c9aeeeULL, 0x3986bb832613582bULL, 0x92c657741ea2902dULL, 0xb9e4b3d49fb11547ULL, 0xafb619b59ab7cab9ULL, 0xdffd1e7be8191190ULL, },
+      { 0x6b33083bb80510bfULL, 0x7b3186bf2f346125ULL, 0xc9cbe77e6be6e4c9ULL, 0x96347e0589f9c013ULL, 0xe0280dbea779d3b9ULL, 0xaa26eb2095a94e81ULL, },
+      { 0x2dbdf6a6e6583acdULL, 0xdffe08e9807ce903ULL, 0xce5fec949ab87cf7ULL, 0x0151dcd7a53488c3ULL, 0xf22e502fcdd4bca2ULL, 0x81415538ce493bd5ULL, },
+      { 0xea38aac7e917a569ULL, 0xfff0d1d2e18469b1ULL, 0xdd5cf7c945f22a3fULL, 0x65761fb2444e2267ULL, 0xc94c153f804a4a92ULL, 0xc46052028a20979aULL, },
+      { 0xe2a70c1fd215dbe7ULL, 0x64ae2d3a8cac0c16ULL, 0x7b661fe3b805ab70ULL, 0xab328000b197f37cULL, 0x92506fd4d86244d3ULL, 0x952d234ccb7e5f2aULL, },
+      { 0x10226c1e1f3733ddULL, 0x10480dd0f3f5b48cULL, 0x52f908853a4fa01cULL, 0x4daa4a8effda676cULL, 0x88111764983edba9ULL, 0xe2a46848a8d6f78bULL, },
+      { 0x1004ff04c252bfa1ULL, 0x3a91a99b2540a9f9ULL, 0xc6027c21cef76465ULL, 0xcd09809d6b9bbacdULL, 0x0aebc0915f75c1f2ULL, 0xac2aefcb5dfe300aULL, },
+      { 0xed8213e1a40d3fa7ULL, 0x530b8fb029a2fbd7ULL, 0x772939f73369efc2ULL, 0x538567bfbe0b117aULL, 0x6e6c12aa02b9a1ecULL, 0x82c952e37be11cb4ULL, },
+      { 0x59a1df3b035dd8a0ULL, 0xf50444dbc38bac29ULL, 0xf24992a6adf00edeULL, 0x2b9886e4fc08b272ULL, 0xc11b18bd25918c30ULL, 0xc6b3de56db4aef75ULL, },
+      { 0x8178de0c3a02696cULL, 0x0d18e0a92fe1941cULL, 0x0f7740145246fb8fULL, 0x186ef2c39acb4103ULL, 0x888c9ab2fc5b3437ULL, 0x96f18b1742aad751ULL, },
+      { 0x5cb440c41ae781ecULL, 0x9878962abc2c3953ULL, 0x7d21f446270f5d38ULL, 0x970db52e1743533bULL, 0xd15e6695e9fb0b3eULL, 0xe553be2769f4765eULL, },
+      { 0x22e6c855b8c44fbbULL, 0x8067c40f1c692f3dULL, 0x68d759e7a3fff997ULL, 0x5a43d43795f92ea2ULL, 0x7ef5f8c1b3a0771cULL, 0xae3511626ed559f0ULL, },
+      { 0x673e817dabf2b0feULL, 0x8f4b1d513adb0795ULL, 0x53c426a364dcb15aULL, 0x3b482d9dc36e244fULL, 0x796ecf6adfc25225ULL, 0x8455f5578672ad69ULL, },
+      { 0xfbd744a6c5338c12ULL, 0x52917f6e32b496f3ULL, 0x7fc9903fbba6dd61ULL, 0xd75b37a5230067e7ULL, 0xf3be171a27bf81daULL, 0xc90e78c7fcbee713ULL, },
+      { 0xa8df0ba03a89445fULL, 0xea9fb7db0649596fULL, 0x403f4d46b309c39eULL, 0xe1281d24c6f709e5ULL, 0x5a050b215eebc516ULL, 0x98bb4ee309f04d45ULL, },
+      { 0xf730674cc379fdb5ULL, 0x7b302f7ea6fb3ed2ULL, 0x14989be4222dd137ULL, 0xe72af3faf80453ceULL, 0xa6a99ee15afede53ULL, 0xe80b387fb9146d6cULL, },
+      { 0x77ce7c1d287002d4ULL, 0x666450a89740435dULL, 0x80acda113324758aULL, 0xded179c26d9ab828ULL, 0x58f8fde02c03a6c6ULL, 0xb045626fb50a35e7ULL, },
+    };
+
+    static constexpr int tlfloat_pow10tab_b_words = 10;
+    static constexpr int tlfloat_pow10tab_b_shift = 8;
+    static constexpr int tlfloat_pow10tab_b_min = -308;
+    static constexpr int tlfloat_pow10tab_b_max = 308;
+
+#ifndef __CUDA_ARCH__
+    static constexpr uint64_t tlfloat_pow10tab_b[][10] = {
+#else
+    static __device__ constexpr uint64_t tlfloat_pow10tab_b[][10] = {
+#endif
+      { 0x93993b42be0406deULL, 0x4c1bf06cc048fef3ULL, 0xd72ad24c01412affULL, 0x70bde27e070da0cdULL, 0x009707703ac739c5ULL, 0xd18c5cf62a18ea73ULL, 0x094fdccdb82fc378ULL, 0x2c8301a280f09421ULL, 0xd483564ced2020ebULL, 0xc3d885d568dc6308ULL, },
+      { 0x46d75b07d0f45c1bULL, 0xbce14fe1c8f4eb23ULL, 0xf8b20e4aad4af4c5ULL, 0x6f480aa1e5a6fdfcULL, 0x6aaa57092b49be6bULL, 0xbcf7adde59347921ULL, 0x740b244496b8019cULL, 0x3943fbd81f3ff519ULL, 0x144a5c350015516dULL, 0x826ee1f9d7ad07adULL, },
+      { 0x764a57c79aa23d63ULL, 0xb710f805ed5cd73bULL, 0x0f1a7feab4670995ULL, 0x445c59647a0008e0ULL, 0x20f0d6d24a815a47ULL, 0x88de9183f2087fd4ULL, 0x72f16374ad7f971cULL, 0x3e1e64b65aa83a33ULL, 0xf14c289abdc7d7bfULL, 0xadbc99be3dac8e12ULL, },
+      { 0xbd633ba42f021e95ULL, 0x64759d157ef60923ULL, 0xd72aa3bbea69bfd7ULL, 0x4dfd7385ab6a9015ULL, 0x182d9c58eb2fb273ULL, 0x2cacfd6ac48f60b9ULL, 0x74b22fa03aade074ULL, 0x5f805e893e6073aaULL, 0xd56b3218026490c2ULL, 0xe76ac225c9b31e5eULL, },
+      { 0xc4a7ab7ea25aa590ULL, 0x7e7b0c9f1f043205ULL, 0x8846ac61476fa498ULL, 0x7c2cb45dc72d1d8cULL, 0xcf3dc035e54872a9ULL, 0x21c49cf8b70e0448ULL, 0xd1db539d700f6e22ULL, 0x91baa9941b50dc05ULL, 0xf1f48258d01bed88ULL, 0x9a1fa0cb1b3d9c9eULL, },
+      { 0x252fbcba82c8288eULL, 0xd9258ef711726b1bULL, 0xed2dc593337b786cULL, 0x7f2bf115b4d4bbf2ULL, 0x461fcb0d421d6135ULL, 0x69dc07058361f176ULL, 0x9dee16bfc5544f17ULL, 0x0647d8162619a163ULL, 0x65643ffc859e79b1ULL, 0xcd4ad4d5118e7fadULL, },
+      { 0xdad72927dd58ea63ULL, 0xaa9ecb3031840231ULL, 0x2faa25dde32e6292ULL, 0xb0fe9618ceae347eULL, 0x265f65bdb7c78c8cULL, 0xf8f7e8b7bb4d72d1ULL, 0x95c007d45ca8f649ULL, 0x074eb62598c6c1a0ULL, 0x5a324e5c053054bdULL, 0x88b97967b6f4cdbaULL, },
+      { 0xb200e878b40792cbULL, 0xfa41dd02ae93f564ULL, 0xdeb7b2558395e5f5ULL, 0xeb9df2e3e49b243eULL, 0x0f910d2bc8ba6ffcULL, 0x5c233cbb8611b941ULL, 0xa13a9a0ae46bfdddULL, 0xc241ebcc8c13f13bULL, 0xd2dd853e0c23ad42ULL, 0xb61de7e28a6c1aecULL, },
+      { 0x83f2c68e66c29185ULL, 0x5fea440206b425faULL, 0x6cd8beb6986730f4ULL, 0xfd5ccaf5584c1960ULL, 0xf3b4e17a5d6a63c7ULL, 0x1b8c93ae34419ceeULL, 0x78c0a0dd92b20032ULL, 0x4b9c665f2b2657ffULL, 0x9dac14976825b0bcULL, 0xf2944d2a09faa7c9ULL, },
+      { 0xec3d4ae66378a80aULL, 0x64c0b682b1a868a8ULL, 0x59131a5218176c7dULL, 0x97cb91ecb604d1e5ULL, 0x4e662783d25b1688ULL, 0xc6683f2f0ca890bcULL, 0xe886ab5ed027153aULL, 0x54612adb731b2deaULL, 0x376f9acb2c01ae1cULL, 0xa18ebfd8754054a0ULL, },
+      { 0x1196c28968b47afdULL, 0xcb044caa52ad2c3dULL, 0xef67388a420a6125ULL, 0x5ebd20ce1ed1145eULL, 0x40c36be39475b0bfULL, 0x30ff3cddf8bdd7c4ULL, 0x11255ae59a676bbeULL, 0x0bab8017f5110db5ULL, 0x7597d5cf1e818ab3ULL, 0xd731c929fe54ed59ULL, },
+      { 0x81f73c7086492de5ULL, 0x86ddf87ca9293be6ULL, 0x9c3b01a938375cc3ULL, 0x07ab4b1be0ee8bf5ULL, 0xf198fa41bf216ed4ULL, 0xdbc9472d5dfad561ULL, 0x24506b8045ffcc84ULL, 0xe9c816f0734c4a34ULL, 0x6558dc634d526190ULL, 0x8f51c0751bd4eeeeULL, },
+      { 0x8f72752f201f4d38ULL, 0xcb98ec70ac5eebc4ULL, 0x4c00aa1aad597c0dULL, 0xbe1a3ad5e6cb9c48ULL, 0xe683bfdab8eada0dULL, 0x0a4cff7e35c0929fULL, 0x7ac0177da0b242caULL, 0xa81ffc81d2bb4d1cULL, 0xfd8d955c1c89f81fULL, 0xbee6b04ecec6a5f5ULL, },
+      { 0x998d25787f4bd664ULL, 0xd0851ae38819acc4ULL, 0xe89a5e9942e834dcULL, 0xfecc68400460fcb8ULL, 0x395f7465a1609211ULL, 0x2dc50d1859654e11ULL, 0xe0ada95a5210e171ULL, 0x1a178cd34102b290ULL, 0x92a78567b3f2baedULL, 0xfe47ad3103dd670fULL, },
+      { 0xd8870c5d09c48e9fULL, 0xfb73e9154c2a8a89ULL, 0x795d0d9434d691e1ULL, 0xe7b132524859788dULL, 0x1bdc7ceb6f7dab90ULL, 0x0e639813506a265fULL, 0x19c9d10368b4d7a0ULL, 0x86c95024efd83a42ULL, 0xaeb162d891bdf51aULL, 0xa959aaaf83dde101ULL, },
+      { 0x0e83494a339a32b3ULL, 0xab99bfc7fabd8f66ULL, 0xb032a6f258297a0cULL, 0xf6f8f5ceefa42ba3ULL, 0x4b9df664d315ccb9ULL, 0x10da5d0339e12146ULL, 0xe25df5a29828a886ULL, 0xf7c087ad37403734ULL, 0x3133efeecdb85117ULL, 0xe193032ca61dffc2ULL, },
+      { 0x5bf6faf44233cba6ULL, 0x2ee09b8adcf5a433ULL, 0xc690c7ffadc1bd21ULL, 0xc19a5095f7989ee2ULL, 0x0026a2492fc6ec65ULL, 0x3567054cbfceb217ULL, 0x28b7f875264b98beULL, 0x4d2a72d4f3a3161dULL, 0x35da5b3ed5d0b044ULL, 0x963b7666e08b1ceaULL, },
+      { 0x3044e282de3bdb03ULL, 0x3f8924aabcb84abeULL, 0x13a3c495e96b5e8dULL, 0x86d865fe9930072cULL, 0xaa2b95ef84195e05ULL, 0x5308c9edabd98ab6ULL, 0x5e94981df4c601eeULL, 0xf55b85a9519b570aULL, 0x6498cf8fcbe352f0ULL, 0xc81bf0c1ace30d6fULL, },
+      { 0x56abb3b43860f34eULL, 0x33f6c23794ffb85bULL, 0x98368f8b7cee96fdULL, 0x308339469ac2cbd2ULL, 0xf40a021c712258f0ULL, 0xeadbdd5b5c140a75ULL, 0xafd0c6b153b84314ULL, 0x343df57e37e8901cULL, 0x987b1d2f68f7dce7ULL, 0x8545c41771052a10ULL, },
+      { 0x129f8ab09598b7d4ULL, 0x3eb02d2284d8f82dULL, 0xbe1fef8f0f7df0ebULL, 0xaf804e1d67df1a9bULL, 0xa8f8ba3e12590c8dULL, 0xe81c6a1da8aa5328ULL, 0x73f7212544b16bd1ULL, 0x2b467b5c8a32fdeaULL, 0x7a3f2a748b09930bULL, 0xb184ced03a7b685fULL, },
+      { 0xfc2ba0a3377f238bULL, 0x0504c7d50b5e50ccULL, 0x68d11a6bcf3d17acULL, 0x88e0a13bdbe86dcaULL, 0x7078616bd96582b8ULL, 0xe30a46f29cf72836ULL, 0xb95fe077db095f77ULL, 0x06e6363ad35ce0f3ULL, 0x9b43b61435e04987ULL, 0xec7468aeebdcbe77ULL, },
+      { 0xcea2645af6c76e77ULL, 0x9913deab646878f8ULL, 0xc875ea938d785738ULL, 0xb92a08c26e505af4ULL, 0x6f9b4e40421f3393ULL, 0x10ba44ee29445d5dULL, 0x5d08bf732fa64db5ULL, 0x5d9c9665fa636456ULL, 0x24bcccf1d16e90c8ULL, 0x9d7a88c6f2de1223ULL, },
+      { 0xa0d42076c2f996bdULL, 0x870dc81b98262decULL, 0x081f5e59880a5fcdULL, 0x46538a610b68f0eaULL, 0x145fae2fd817c5e9ULL, 0xb6450eafaaca2959ULL, 0x2a9d31521b85471bULL, 0x352095413a10befdULL, 0xa40fe17dc61edc31ULL, 0xd1c2e49b662730a5ULL, },
+      { 0x64c6f608577a878bULL, 0x49689f18b4ae5a34ULL, 0xb31456558a0b4140ULL, 0x3adc0fbbf4fdff52ULL, 0xd89e00bd2ba012eaULL, 0xaa539669631c024bULL, 0x8c1e1bd76b3997b8ULL, 0x2e54c40b14f04035ULL, 0xfba00b7d79bdddbdULL, 0x8bb36b17c9b45bd9ULL, },
+      { 0xc74f52a88efa456dULL, 0x82873416921f64aeULL, 0x598313cd23e8421fULL, 0xf0358ca0b5930d81ULL, 0x4b98e49b38c36d78ULL, 0x2f6cabedfc8de886ULL, 0x5e35b9ad7ca165eeULL, 0xe967620fd0c737bcULL, 0x1a21e213c11ca650ULL, 0xba14d067082a8bc6ULL, },
+      { 0x177456f00be251fcULL, 0xad239e0f52592ba1ULL, 0x1de790dc6f280580ULL, 0x0286dad959129f32ULL, 0x80c01257f32e1db1ULL, 0x80b731768aedd33cULL, 0x00497686f5f7186fULL, 0x990d964296f78f8bULL, 0xf0ed75a5cc063f88ULL, 0xf7dc2855fd5b2632ULL, },
+      { 0x898c5e22bd9bc35bULL, 0x62a71727affc69aeULL, 0x9eb2a1e0cc093761ULL, 0xaedab82f530ba2d9ULL, 0x166fc3eaa14d74adULL, 0xb9b3d830002d5f7eULL, 0xa6122674e487e48bULL, 0x5bb234549d87b099ULL, 0xf36f416d721c34ffULL, 0xa513159fab67a776ULL, },
+      { 0xe5cfda8248755e96ULL, 0x43de20fb347e2f00ULL, 0x7af72d2739c6905eULL, 0xb29368487ed1875eULL, 0xbe20f0cc19951a11ULL, 0x29d7acd996db7011ULL, 0x597ccbbdacc05a1eULL, 0x61e3f8e9ec58a051ULL, 0x367253dff90ecd84ULL, 0xdbe107d6e1ad96e7ULL, },
+      { 0x3ada694d5c241701ULL, 0x9d2c506a90765b44ULL, 0x069b31ec671492b3ULL, 0x7d564f08a1289275ULL, 0xb601137bc104dd9dULL, 0x1a12f988cf837a21ULL, 0xa73ce5977fffd5c7ULL, 0xe047b8f37eae7cbeULL, 0xd546e90344cee865ULL, 0x927072a63d24e955ULL, },
+      { 0xb594e79ef106472fULL, 0xc019f1bf02ed335aULL, 0x3cdd8374f61df6dbULL, 0xc88aeb3bf4616c3fULL, 0x236627fcc8981067ULL, 0xc1c99071531e6c48ULL, 0x4662aea45a56c8d0ULL, 0x089f0f48752b60deULL, 0x9d4ad36b478aa7baULL, 0xc30e8ceff4930675ULL, },
+      { 0x9a5deb1533848ad9ULL, 0x8297dd4475610e34ULL, 0x271c282f8fe6b0b3ULL, 0x8a91b5bd3756db6cULL, 0x780b5cb254944b5fULL, 0x39704a6f16e68225ULL, 0x53d72d10313121ceULL, 0xa8c535dc6292ac58ULL, 0xfffda54022fec6eaULL, 0x81e85e8ec986c697ULL, },
+      { 0x529222085cd14ba0ULL, 0x9955d5bfa9c3d14aULL, 0x039a302bc8f717d5ULL, 0xbc380594b8609f62ULL, 0xd19bfd2ed34d2e0eULL, 0x7470b07bdbdd6f6aULL, 0x1c3bc6c894a4f636ULL, 0xd65ff6fb200ba1fdULL, 0x107610c61e2e74c2ULL, 0xad096dd2b3cd8e4cULL, },
+      { 0x90dc483e5c2fa138ULL, 0xc62cd74663bde01eULL, 0xc70d7d9be9ed3093ULL, 0x9dda74178086e657ULL, 0xf120b4300f932e0bULL, 0x7f624f25f9924c98ULL, 0x48a683cbd24f3db1ULL, 0x945e45345a01c1b3ULL, 0x4819d86f83712470ULL, 0xe67c1a2767e38a85ULL, },
+      { 0x473e47ec482ea504ULL, 0xac0735fa6d41ebb6ULL, 0xcbf0f239298c00f9ULL, 0x7b25880e7f1e877eULL, 0x6a06b8cc2df9f543ULL, 0xba6d2c506384a799ULL, 0x28bfb9b9b808e4deULL, 0xab170e70ba4ab2b8ULL, 0x5f70fd5ac983b20fULL, 0x9980aee9804d201aULL, },
+      { 0x7a671aadf939e0bbULL, 0xb2fa41af01eb10f3ULL, 0xb64385becdfc9cc3ULL, 0x69aaddab5123b0b5ULL, 0xba9c0589ef9e665eULL, 0xe2f36c8419675483ULL, 0x1dea7a75f221aff1ULL, 0x50412fbeb282b354ULL, 0xcb86569d04c4d380ULL, 0xcc771dfa4d2be7c1ULL, },
+      { 0xc320d34bfb489f16ULL, 0x39e5f8ad34979a60ULL, 0x0a53ecde6f6a3c61ULL, 0x409c8b575e60dbfdULL, 0xb2c0641fe51a523fULL, 0x1c4dfc8ce221d0daULL, 0x5cf27c814d02288cULL, 0x0aa0335433a9e1e9ULL, 0xfed0b415a439b813ULL, 0x882c790347ecebc2ULL, },
+      { 0xe8b3232d7ea84957ULL, 0x54e160097064cd4aULL, 0x40ef3fd631f6ad38ULL, 0x4136c137274d6372ULL, 0x2b873a226624d9d1ULL, 0xab685f3642651418ULL, 0x9db75714a765d4faULL, 0x68248d2bbd63d713ULL, 0x8f2c2a74a650214fULL, 0xb562178cd0332888ULL, },
+      { 0x05f02627081a6ce3ULL, 0xcd80cda16a3d6538ULL, 0x4dc1524668802327ULL, 0x6cfd4436ae6b88e0ULL, 0xa710ff2a64fdf1dbULL, 0x25e95f83e9c4d200ULL, 0x7fa948aa6044ce3dULL, 0x45a68390edf8bef4ULL, 0x25b6de1ff75b53cfULL, 0xf19a223cd893fda3ULL, },
+      { 0x226eb5c8e95044d4ULL, 0xd19a3c8227f5c3a4ULL, 0x7ddfeb2db7ec1455ULL, 0x3f5b51fc71c68c93ULL, 0xb446a09464273496ULL, 0xb70f6e752292d077ULL, 0x40740aea952f7796ULL, 0xa5f76bc163ee4c89ULL, 0x8b208f100fca6dbfULL, 0xa0e8234f3669a3b1ULL, },
+      { 0x4e6defdf431cbfc0ULL, 0xda2644942be132e9ULL, 0x7231204488b8edb9ULL, 0x9b9a111097bb912aULL, 0xd5eed14ad6652f7dULL, 0x6fa6fb44c272ee41ULL, 0x4f379f6f5652dc87ULL, 0x1fbb3f83c66d3226ULL, 0x61c16ece5045cfb8ULL, 0xd653dc0e74dd5f48ULL, },
+      { 0xb587cdc99f956275ULL, 0x71b5d8896dbd75f9ULL, 0x9dc13b2e7c005a06ULL, 0xd97c294dcc4772f4ULL, 0x5056e9879282cbfcULL, 0xa862fcc046fa7a58ULL, 0xfa4b51af0c94adc3ULL, 0x56d57be359b423c1ULL, 0x2872076ddc4be29aULL, 0x8ebdf2f98c352d88ULL, },
+      { 0xab67cb75acbf40fcULL, 0x102527c778194fd1ULL, 0xefc09f3d97f7a1c5ULL, 0xf9a457d51011dae2ULL, 0xc6a556b7df64226cULL, 0xf2f139f522e898e7ULL, 0x1ce7a5aaab271eddULL, 0x4797ee4fe00224dbULL, 0x9ef6147270ad3c7eULL, 0xbe21d0d7f098e34cULL, },
+      { 0x770c4ebb76a2c1c8ULL, 0xec9d5ff575b6238dULL, 0xe91ee3081842e635ULL, 0x5d3967d532bcf118ULL, 0x1fd3d7d77aa40f3dULL, 0x40d638f68c08c351ULL, 0x33986562b36ae5d5ULL, 0xb1f7226bf55e6e41ULL, 0x81a8d2e4f146cbd0ULL, 0xfd41713036808212ULL, },
+      { 0x749323000a4f41b8ULL, 0x473bcec9a70360c2ULL, 0xbf7db88b0740ccb5ULL, 0x6ec7e93413a773efULL, 0x0dfde3ff4da1393dULL, 0x56b93a123e04bfe3ULL, 0x4634b73733d2c9cbULL, 0x213ad2593b8870f1ULL, 0x787c77f8ac50e490ULL, 0xa8ab04d3b845b92aULL, },
+      { 0xa9b90d91958c2292ULL, 0xc0f961c4ba291711ULL, 0xf521dbb26228234aULL, 0xb811b0c1a93a6348ULL, 0xa2adf1a67844d655ULL, 0x442085473f54f3ccULL, 0x27cf324e15ee4aa1ULL, 0x715752edc55f8a24ULL, 0xa953ebfeb8e95622ULL, 0xe0aa61b77b892fe8ULL, },
+      { 0x2ca0e338517a7986ULL, 0x1f565e9d289860daULL, 0x70c3fa2d810652b1ULL, 0x59a6b6149ef8a201ULL, 0x28ddc4d1797fa991ULL, 0x00be86b6b2177d5aULL, 0x3591bdd10005d50bULL, 0x4bfc6fd704b99d84ULL, 0xf6d889dd7e368d58ULL, 0x95a087d929bceb99ULL, },
+      { 0x1438eeedc3badcc7ULL, 0xee1333f6c38070a8ULL, 0x120fbdce323109f0ULL, 0x01e155e77ec8b5fcULL, 0x2f42a76619edcd5fULL, 0x2a4a90a1535358c3ULL, 0x37492b414bc4b598ULL, 0x379fce8e4b073491ULL, 0xfbb2defe8d42c754ULL, 0xc74d924d00121269ULL, },
+      { 0x24da828a484a2068ULL, 0x1fb27736d5544681ULL, 0xc4d7969e11366426ULL, 0xd14be2768e2f91ffULL, 0x99884cd70e2cdef7ULL, 0xea7b51a471a6b985ULL, 0x04f9048697ffab48ULL, 0x5d2fa61943e8e638ULL, 0x57168094da6fa8b1ULL, 0x84bc530d3d4a441fULL, },
+      { 0x34bb43fbba3049edULL, 0x24aab42d9496eb2aULL, 0x5bd8335ff83824b2ULL, 0x027e63d7a5b21785ULL, 0x3ee9e87290962735ULL, 0x873a10026bff725fULL, 0x4caf74b4d25e06c5ULL, 0xdaeeb20ef1f894beULL, 0xc19329244f8d5187ULL, 0xb0cdbc6604063d12ULL, },
+      { 0x1954e10faa579a22ULL, 0x4a1d1c2ad6be0709ULL, 0x19abcc469015bfafULL, 0x159141fb949cccfdULL, 0x4aa6b3c93944817bULL, 0x76cdf235060f9c2cULL, 0x6be7cfd9f39dc1acULL, 0x4043f288eac1f31cULL, 0xc6f66efa80e1ca93ULL, 0xeb808eb2374c7766ULL, },
+      { 0x5bb91a74d33a63c7ULL, 0x7b390203f3b86af1ULL, 0x2762b69f515b497bULL, 0x9e4c2f8dd8d49b45ULL, 0x004d1004dd6b835eULL, 0xd5c25733c33a9ac6ULL, 0x5d5b347ddfa46fc8ULL, 0x81ab0d8b0e9bfd34ULL, 0x831356c6fd833983ULL, 0x9cd8211f0fcd34b6ULL, },
+      { 0x8f72c8edbd592fb0ULL, 0xa5729eef0ffc22d9ULL, 0xf001d130916d29fbULL, 0xda8daa9f51657a1fULL, 0x4f0c3155bb959c27ULL, 0xbd48add6b50dc082ULL, 0xbf4daf25cf526cfeULL, 0x0b0a1341e3240064ULL, 0x3bf2f1d0f016fa99ULL, 0xd0ea91e6f9c357b3ULL, },
+      { 0x67c01003531aa40aULL, 0xc2063b0ebd412f05ULL, 0x4b96bed6302e70b4ULL, 0x5d8179ee450f3086ULL, 0x1509a10228680295ULL, 0xcaac64f8d86be15aULL, 0x0947fbefe1b7e2e9ULL, 0x99f6b65165d787bfULL, 0x2591506b30320e73ULL, 0x8b2358ebdc628061ULL, },
+      { 0x0c471936775b3a90ULL, 0x8c38d3a44d0153d9ULL, 0xf63c413252f30d67ULL, 0xee06fd017abfcba6ULL, 0x38c57bb33d1a528eULL, 0xde4c9a75d49ced72ULL, 0x72ee7c6db7c3f534ULL, 0xb9addd2242c0eca1ULL, 0x31b38c43613ad8c0ULL, 0xb954e969312a2056ULL, },
+      { 0x7c746ab28f5bea73ULL, 0xe2c1c0a42d63b21fULL, 0x26c0757efe492f8dULL, 0xbd772a139ad8643eULL, 0xccaa87623370ebd1ULL, 0xd7d336a624ef527dULL, 0x3dde600e398b5683ULL, 0x8c03593e92bdc890ULL, 0xd12c17c29cc4b54cULL, 0xf6dc8b43ae9d1ca9ULL, },
+      { 0xcbcc9d2d4cf6dbd0ULL, 0x7c913acc65bf1edfULL, 0xff7114c1f068bffeULL, 0xf0813d0e57aa6807ULL, 0x2a2ccadc06f26af7ULL, 0xd1a9998d41fbf306ULL, 0x4386a5923e7dce52ULL, 0x80bb49885741e9baULL, 0x52d11260c316fb07ULL, 0xa468d89693ae278bULL, },
+      { 0x1f7eb62c9aa42c7dULL, 0xc45dfe36ce7fd8f3ULL, 0xf1aa20310caae3fcULL, 0x616451771409336bULL, 0x35ba3b4032fb4c9fULL, 0xcf8a4b471c3fc9bfULL, 0x3aeb55a9b798024eULL, 0x7cc0f25d2be49039ULL, 0x613f1afb305c73a3ULL, 0xdafe45f8de8361d5ULL, },
+      { 0xb4937360b8b1d0deULL, 0xbfc479a1d7285b04ULL, 0xe8a06313d87c1c5aULL, 0x1680c92aca0619c7ULL, 0x313bdf9fa5ec8665ULL, 0x36884d012b24c39eULL, 0xf11a8f9bab6492beULL, 0xfd9793fdf3731124ULL, 0x2b28e2b376b6d136ULL, 0x91d96d7c5cee8384ULL, },
+      { 0xff3fce29dcfaf74fULL, 0x47c02973f2ed9b0bULL, 0xf9effd8ba0396b1aULL, 0x5bb67642abba34edULL, 0xf6400514724d7f0cULL, 0xa6bee4494f198c95ULL, 0xeff0af0ca6a892b6ULL, 0xcc2e5dedabf5b166ULL, 0x668e1619ed1924f6ULL, 0xc2456454d538acc9ULL, },
+      { 0xa37639820e5bc9e4ULL, 0xd6caaf1650c29a29ULL, 0x721f9a0eb55dffeeULL, 0xe818ae6251beb71dULL, 0x3ccfdec3d6894b7aULL, 0xe81128e93c02243aULL, 0xa12ed90da9133657ULL, 0xca9e5f47967a440bULL, 0x512e5699bd8c3398ULL, 0x816265dc5c5e0075ULL, },
+      { 0x893e69b826af917cULL, 0x94a50bf0fd5c1c57ULL, 0x518b1d11e4f01c29ULL, 0x51b9f5a11cf73343ULL, 0x2bc94fb7e36b5176ULL, 0x6078bb96fd538119ULL, 0x3338310698ef81d0ULL, 0x4c492aee9c7af53fULL, 0x77a09961247cc265ULL, 0xac56faaded3d5826ULL, },
+      { 0x35f30a6e9105e1c2ULL, 0x5873d952a258cdc2ULL, 0x0052979e9e69768aULL, 0x8cf5cc58e47f1dceULL, 0xb12544df8810fd5bULL, 0xeb4b656a9f250f45ULL, 0xd54264c3e541eb1aULL, 0xaacbf4445008182cULL, 0x8b55c9475aafce92ULL, 0xe58e684839c90066ULL, },
+      { 0x676d003b3b55acb1ULL, 0x1d927d27a8712f7cULL, 0x64df98f9266da57aULL, 0x9b668ad0c24e3ba2ULL, 0xe58e24674f32edf6ULL, 0xe043c9a049563cdcULL, 0x4b6e89716b0e9811ULL, 0x197f663af4baa146ULL, 0xe4d3be3e99fb0215ULL, 0x98e260f2a3eedc16ULL, },
+      { 0xc751e5f1b28df015ULL, 0x594577badea87d3bULL, 0x46123ae0cf15bbcbULL, 0xc275ff93add1f422ULL, 0x61f1e99a53550635ULL, 0x64da13feebf6ccccULL, 0xf57e40ac81b2601eULL, 0xf5134bb2dc817d6bULL, 0x5458788f29be8fe8ULL, 0xcba44175d72a4d51ULL, },
+      { 0x9b28fe2eabc60057ULL, 0x4d84d005341cd6baULL, 0xc06e54ee7cae657bULL, 0x130a52320fbc872eULL, 0xcf7c8bcfc5ba45a5ULL, 0x9c620d4d4b8f483fULL, 0x7cf3af8129a0804bULL, 0xd877d7a0b3c4327aULL, 0x16af32f47c744fa0ULL, 0x87a00a0868afd92aULL, },
+      { 0x7bf7a3bf5f727a25ULL, 0x0485685b6222087dULL, 0xdaa2d558f06b9672ULL, 0xf75c60b9e183f2bdULL, 0x5f163dd00a32c735ULL, 0x892e4639703c335fULL, 0x82e3de17aaada1a2ULL, 0x34fa161874c113b2ULL, 0x847c2969d94d48c6ULL, 0xb4a708e778f2c3a7ULL, },
+      { 0xceb8b14f87192ff7ULL, 0x0cae1512ffbe6b79ULL, 0xfdc031255c2f9cc8ULL, 0xc425afa5bec93c3fULL, 0x43469a631bed9240ULL, 0xcc5fb9769c77beccULL, 0xccc2dbead48fd4c8ULL, 0x2a61c4a7d2eb9bb7ULL, 0x1d21f6b8f99c6e8dULL, 0xf0a0f94df95770bdULL, },
+      { 0xbc6d04806a9836c8ULL, 0x02a3d534a21a0648ULL, 0xf8df954fb20efbb5ULL, 0x245550e031bf74bcULL, 0xba463ad4d58d2b50ULL, 0xc955dcb289d490b9ULL, 0x96cc3f73ee26ba6cULL, 0xcb8f8f5372cb1b74ULL, 0x0fae6057b78ca9b6ULL, 0xa0423298c32163e6ULL, },
+      { 0x14aea3702f1c4febULL, 0x461abf7dbd582681ULL, 0x47c5771a0051ce18ULL, 0x01db4cdb740cd46fULL, 0x1ac583e5f01246b6ULL, 0x5c1e1f22c1ba2a6eULL, 0x5075afe90b329659ULL, 0x35ee5c11a06d0aa9ULL, 0x0ef9a8384e47ef31ULL, 0xd576d3d1420624d4ULL, },
+      { 0xa7beac48aad79e66ULL, 0xd95a7af2e3f29cc9ULL, 0x68a9a437a3371e57ULL, 0xdcdf690b6a65d634ULL, 0x0e088dcb0edc3ebeULL, 0x4df4646399b05339ULL, 0xa781f0fa7d50067bULL, 0x87debd0313647d61ULL, 0x05330724d6c577f6ULL, 0x8e2abdeb1a839351ULL, },
+      { 0xe74f5eece90b317eULL, 0xe1311c4d05aef2b9ULL, 0xe74d39a3b95bfc62ULL, 0x36da5638a66e850dULL, 0xc9607408eafa1e04ULL, 0xd21a5f08326cf2e5ULL, 0x0790568cccdcb9c6ULL, 0x434b5c927221c31dULL, 0xb1c0902950f72b95ULL, 0xbd5dbc692298da27ULL, },
+      { 0x3aa6232f7cce56d1ULL, 0x093528021c07b8b6ULL, 0x891042bb2eaba80dULL, 0x03bd991e2083f4c8ULL, 0x88019eb97f0560ddULL, 0x73c812a58f1c830bULL, 0xcf4f413a80136f60ULL, 0xb07fc160ac468febULL, 0xdc6d636237de9058ULL, 0xfc3c439f70e02e93ULL, },
+      { 0x754c4181708fca09ULL, 0x1d2c1b4b5682b8bbULL, 0xdde2f5aa8a7bd3e3ULL, 0x6446940f6d233b1eULL, 0xb6b391e501eea4f4ULL, 0x3f98a133eb4ec9a0ULL, 0x0f014e8ee077b29aULL, 0x8a3846282032b0d1ULL, 0x2c5325dc5dd80368ULL, 0xa7fd1314663f3e95ULL, },
+      { 0x5004e94e54bce421ULL, 0x8632e91d186fadf3ULL, 0x20e7b443facde172ULL, 0x4daa94cdba3aad12ULL, 0x8b0966323340bab5ULL, 0xc66326e8ce85a313ULL, 0x74c91e9453b9044aULL, 0x14e1752c50f6d125ULL, 0x9698a36c92dc97a5ULL, 0xdfc2b02aba7fdae3ULL, },
+      { 0xd01a341f1e47723eULL, 0x149552e15c534044ULL, 0xda4271c2d513597aULL, 0xd406fadf62a6a6f4ULL, 0xf05ede271a8801b2ULL, 0xbdfa00c4fa38be14ULL, 0xd95bc7a0d154f92dULL, 0x159cf81299ef542bULL, 0x7a0eec27962b4fdfULL, 0x95063912ba8f724fULL, },
+      { 0x29ea3e05cc83f5d6ULL, 0x5a1d5544c4df2e3fULL, 0x3e9bb7b4500673e7ULL, 0xcb342693649e3835ULL, 0xeda730e25a1b7c00ULL, 0x0c4966a3298305c5ULL, 0xa6359a7fcec9c7caULL, 0xabb9b95c42d4ea6fULL, 0x3ac15f22c8f22020ULL, 0xc68008ab6d1f017bULL, },
+      { 0xbbd576d2504ff01eULL, 0xe40be4e71becd6b0ULL, 0xe6927287014dd5aeULL, 0xaa9abfa1656538a9ULL, 0xe8dee8542a75f96fULL, 0xc3011790e2dfcf01ULL, 0x43653095c7b11804ULL, 0xd777c22c23aea640ULL, 0x9c0e73f8c92dd0e4ULL, 0x84336fc0bcd26de8ULL, },
+      { 0xf4bf368a75f026b6ULL, 0x1a5edc2c0c5b3fcfULL, 0xa7f820692ea4c162ULL, 0x0a1b0de30e44cf28ULL, 0x9e9d0738357b271dULL, 0x2018f31881087037ULL, 0x8652d11b8673f515ULL, 0xdbe4f6abe9c98966ULL, 0x42b0b9c99ddcce76ULL, 0xb01766c84bb380b7ULL, },
+      { 0x114645921b836178ULL, 0x9643ce782813fb22ULL, 0x0c81ad7abe094979ULL, 0xdcde59321f44fc7eULL, 0xc3c985f32e5f9ea4ULL, 0x2e78ff05825622dcULL, 0x5b72033701ec53e8ULL, 0x273842c204b66322ULL, 0x78d9b36a0d69453eULL, 0xea8db0304fa0a729ULL, },
+      { 0x469218875bc94accULL, 0xbefcd64f2e373befULL, 0x8cfac4970958937eULL, 0x2302287d827e3aa3ULL, 0xfcec25e8ef982204ULL, 0x467a610ed13ff9ccULL, 0x5c6b8850f6a6b7a1ULL, 0xdd630b8d07d1d029ULL, 0x367017f6a768294cULL, 0x9c3660f3670dcd51ULL, },
+      { 0x8f2683d5cbad95bbULL, 0xe8958bca3e82e342ULL, 0xbbab315865e21078ULL, 0x79ea41218d52a6ceULL, 0x06023d999362d683ULL, 0x8a00704b2bb6ff81ULL, 0xea8b4c37e00ae582ULL, 0x0750df98894f9578ULL, 0xfccf519cf1c7b728ULL, 0xd0131e499de46713ULL, },
+      { 0xfd224a8ee06034dbULL, 0x04ac1cdde18a477eULL, 0xf6e885028682dd27ULL, 0x35b4a34a611ace8bULL, 0x1d1a5d1d02ba9dd4ULL, 0x954b5bf6399589beULL, 0xfa20098f30bf4f5cULL, 0xdba7dd45e3d77155ULL, 0xf9bca3fcfc2685d3ULL, 0x8a93db53db087a0bULL, },
+      { 0xd42100705daca27dULL, 0x05ddd71fed31f9a8ULL, 0xa11733fb27e91affULL, 0x65eae64fae78ca83ULL, 0xbfd23cf949ed3709ULL, 0x462ed96258d3133dULL, 0xd0aabc1663306d36ULL, 0x61e382d404cc2516ULL, 0xa9458ea0fbc89c4aULL, 0xb895c8532316c898ULL, },
+      { 0x1d6274e940970cabULL, 0x541a6b681bcd87beULL, 0xe44d485aa04472e2ULL, 0x0d6cf0a5afd2caebULL, 0xa673f75004b8a70aULL, 0xd460b2bfdcaa817bULL, 0x1d5c0bb0f9079da2ULL, 0x144596201220f33bULL, 0xe100cb57fc5bbb37ULL, 0xf5ddf5cd73c04e50ULL, },
+      { 0x8615585721ce575dULL, 0xb49f7edf6f219e81ULL, 0x3c6af61c9186ee3eULL, 0xcef5af3aa123ee0dULL, 0x02a2fb5a00ec08f8ULL, 0xe68410da273c133aULL, 0xf5a5a1bae75aca09ULL, 0x22ea118263748b69ULL, 0x16da209e6a6f8c00ULL, 0xa3bf4b1dd2f960bcULL, },
+      { 0xe740ba741ec1b75aULL, 0x151c88a5da7379c0ULL, 0x9a18a96837d02e86ULL, 0x2daacbec34439afdULL, 0xda15fe07878d3f76ULL, 0x6d4bcbc10a80581fULL, 0xbac64846f3316d19ULL, 0xd456cf58df717b4bULL, 0x8b9030df53bbf500ULL, 0xda1c6df4a4ad38beULL, },
+      { 0xa7cae8c86e5245faULL, 0x0cf21977dba9034bULL, 0xd93a247834b0434cULL, 0xae197c5ddbfc2a1aULL, 0xf6a893978d5f9d83ULL, 0xfc00768d760d2c71ULL, 0xa480f82ce913bfa6ULL, 0xa19712c60d21c898ULL, 0x714375aa8b5ebaa8ULL, 0x914304110d2bc9acULL, },
+      { 0x5ea3e791f3e78511ULL, 0x420a21a03a6fd62fULL, 0xb943371b3b787917ULL, 0x1c5e30a0321cfe4aULL, 0x23afe3573c7d5d8aULL, 0xee4a976feef295e9ULL, 0xac2a01f23e80691dULL, 0x458dab2d00228a3dULL, 0xd223196aa9acec2eULL, 0xc17d0b2d3c702a7dULL, },
+      { 0x293f3742d4583d27ULL, 0xaf16e00b4c8a1aedULL, 0xc54f81dea55d05cfULL, 0x4a82ba3213e91eceULL, 0x73024b0932a4bf42ULL, 0xc08e1391f9740d0bULL, 0x654ce2b6dd83d367ULL, 0x7685c2298318fb07ULL, 0xf6ab90cf0e212007ULL, 0x80dcf75380a941f1ULL, },
+      { 0x28eabfe2d076d249ULL, 0xc412bca3a50f8865ULL, 0xc2585060ea99eb77ULL, 0x0bd44e1c427a31eeULL, 0x73b98b3910f3da13ULL, 0x6dbe5ab5cff5f76eULL, 0xcc09aec696484cc9ULL, 0x3a9cf01cd767a92fULL, 0xec9bb8c073f5eecdULL, 0xaba53f915b7e536aULL, },
+      { 0x92be17b58a4164bcULL, 0x29898490b3eaa366ULL, 0x1ea13c1ffc1b1f8eULL, 0x375bc07b455d90f2ULL, 0x002425dae925662dULL, 0xc8758791f6730175ULL, 0x8a11c66c98d04698ULL, 0x906aa99c5208b0f9ULL, 0x40f9800363ebcb8bULL, 0xe4a1ab8a6d311e06ULL, },
+      { 0xc5a509f399ad306dULL, 0x804a22e1dc3fdd70ULL, 0xa3ea59000ddc5772ULL, 0x4627a768ac251008ULL, 0x037597aeba589610ULL, 0x0186c6e5b42a88eaULL, 0x51cd8c96789368f6ULL, 0x91cd1622c78e54b2ULL, 0xb861c59729be55f2ULL, 0x9844b63d7ab5ed48ULL, },
+      { 0x0f7ca90ef2b8b29aULL, 0x155aed7a5b029bb3ULL, 0xfda2f70ee0cea7bdULL, 0xdf028302639d8001ULL, 0x9ffdf880d5e70631ULL, 0xcd44bc65285d6b03ULL, 0x1f27fdd5b24901acULL, 0xde7c3dc1e8bfcd2cULL, 0xa67f27be577ecf7bULL, 0xcad23e6684be2c04ULL, },
+      { 0x5f65b3632b4d24e2ULL, 0x2f4cc33c47df3da8ULL, 0xc827c6874c402e8aULL, 0x7673ba4eebe04525ULL, 0x31bd88055ce73a8cULL, 0x3d6b6532eb219134ULL, 0x87303c881defae98ULL, 0x6e14cac9629718d9ULL, 0xc26ced89d5755a24ULL, 0x87142be1232fd049ULL, },
+      { 0x300f85f24c14ef55ULL, 0x70d611cb3dda056aULL, 0xa759a0fded0e625fULL, 0xd986f15c9d9d5392ULL, 0x7255d0c7d6f07ae1ULL, 0x76a93bd81adfad0cULL, 0x6923e58fde5400e9ULL, 0x37886785070ce1a1ULL, 0xfa6e95201b817d83ULL, 0xb3ecbb2ac52df3b3ULL, },
+      { 0x39c7ced3a4d4075aULL, 0x3672f817bff2cc33ULL, 0xf7577ec4f61a4d7eULL, 0x57560b24d744d6acULL, 0xfc6d684405c26711ULL, 0xbaadb3c067d0f3fdULL, 0xd62ae9b8767dd7e5ULL, 0xa3de04b75910016bULL, 0x816e6097add448f5ULL, 0xefa8d1535be245b4ULL, },
+      { 0xb465999ebf6f7ab0ULL, 0x7e4633f0c66e6493ULL, 0x0d17720a7400f366ULL, 0x4992f607a0bb51ceULL, 0xfadac750d1a8c99fULL, 0xd3dc3ab95d87a1bfULL, 0xea2df4e8db6dca76ULL, 0x54173fe410caa058ULL, 0xe826179f7bfe47efULL, 0x9f9ced03e89cb1a8ULL, },
+      { 0xf0bddfdc218b67f7ULL, 0xda6ecbabd5139bb7ULL, 0x783b521bbd3835d2ULL, 0xbe1d975b03c47d5bULL, 0x099dbaebb2dc4cf1ULL, 0x974a7854922e55feULL, 0x0162065cb76650a1ULL, 0x3d5cc1c98f4c7a5cULL, 0xf760fcf2fba6ddb7ULL, 0xd49aaf865ea5186dULL, },
+      { 0x93f0c18b4c33f310ULL, 0x76e2e6ea79c2085fULL, 0xd40a73407d34d3fbULL, 0x9d9a6531c798d8a6ULL, 0x9cfbf56c76ca1dd1ULL, 0x186dba0d65b25ad3ULL, 0xddc757fed5597387ULL, 0x7ea4258f47a83fe6ULL, 0x7cfddf7613c0f1e2ULL, 0x8d9820ac94f90a09ULL, },
+      { 0xc62c3332e60fc200ULL, 0x1d8cbe68c65bb16eULL, 0x03696621370e76f4ULL, 0xdccf07cc9c1f9bffULL, 0xab8e4fb17940e7f5ULL, 0x72f750cc311cd005ULL, 0xb731be00598874e4ULL, 0xf415bb7c525b525fULL, 0xda1a081a8f8009a8ULL, 0xbc9a723102cb529bULL, },
+      { 0xc2135a79744f1c9cULL, 0x621b6760f1d59906ULL, 0x122c7f4c050eaab1ULL, 0x78d6fe242165366cULL, 0x55e1f101c1d8fdfeULL, 0x5385e9f1869c500fULL, 0x424449020861b4e2ULL, 0xc412c3d53b6be2a6ULL, 0x3b1e093e2b80d804ULL, 0xfb382367cd3c4d88ULL, },
+      { 0x2482308b181e6e5cULL, 0xe1ab9b316d67b536ULL, 0x92193091adcd781cULL, 0x338073802896abf2ULL, 0x58a0044f32b0cd16ULL, 0xc637c4f63b73bea4ULL, 0x1e17ea27f1dbb9daULL, 0x1d60ec34cb40152cULL, 0x34a6c319cb9b745eULL, 0xa74fd4b7cef2b10eULL, },
+      { 0x52952d0c5a09bcf5ULL, 0x280a711e0c79ed49ULL, 0xd2f789770b43c7ebULL, 0x6aa054b794f0bd96ULL, 0x4408cb1f8ba8686cULL, 0x3ce4207691f15138ULL, 0x86bcb3eaee192b16ULL, 0xb1aec406278058f9ULL, 0xaefaf4be779e7e4eULL, 0xdedbed8ef95d278bULL, },
+      { 0x01ca7f4f76ff868eULL, 0x24d0aecb70bfc1d9ULL, 0xbdbe8fcf4d60f17aULL, 0xb9b53cc27af52b66ULL, 0x806d1cfce10a7f77ULL, 0x96de90c566db6075ULL, 0x99aac30e9babeff5ULL, 0x9e782e84f2725aa3ULL, 0x31bf6aa8d2667e6dULL, 0x946c896ecc31288cULL, },
+      { 0x31c1f48497e269e7ULL, 0x624cf27473fb5de0ULL, 0xa06baeabcabefdafULL, 0x10c89621fca04c3cULL, 0x7a227f3c39123667ULL, 0x1194c1d5778bc5ffULL, 0xbd8dedc27216d44cULL, 0x519c0b491b26ae23ULL, 0xc3f00cd7665903b3ULL, 0xc5b353017898122aULL, },
+      { 0x684d7c68b3157b2eULL, 0x3a0401a13b06ff2dULL, 0x4f112fd8aa0c7137ULL, 0xd65a2a663581a771ULL, 0xc7e1aa67a68147c0ULL, 0xa098c1564751ca5dULL, 0xc24d4749994490cbULL, 0xf5538cca90717f72ULL, 0xe1511fda1b57fc78ULL, 0x83ab199fc2d30440ULL, },
+      { 0x7cc9df694ea32cb1ULL, 0xab38707e44422915ULL, 0xc84d189179b30ac3ULL, 0x7018fa8493c04689ULL, 0xf8f9651ffda8a961ULL, 0x8d6f56c317dc59f0ULL, 0x5ccf22cb794e106cULL, 0x93440e0e5135a4fdULL, 0x4b787b18650d30dbULL, 0xaf61cd345d147d8aULL, },
+      { 0x38f5f243bb9a3c25ULL, 0x03f1753385670916ULL, 0xaddea0ff943cc704ULL, 0x9dc02edbcac2d4ddULL, 0x589267e135c6ea89ULL, 0x66159c9ea899ceedULL, 0x8e80f4c646bc25c0ULL, 0x109c910308aa9675ULL, 0xd0834d6cb6b2dfa2ULL, 0xe99bcc25dc25b15cULL, },
+      { 0xb19e4758cedf911bULL, 0x78b5193ce56190c8ULL, 0xcb7dee1e39fd10aeULL, 0x65d58e689a3e3c5dULL, 0xfd338e90aafe058aULL, 0xbddecc6ffd4fc63eULL, 0x69182c768ee1a444ULL, 0xb8fc052193c43de6ULL, 0xb9f0173145f23a6fULL, 0x9b9547973f23dc5dULL, },
+      { 0xa441382a04c0dc74ULL, 0xa3981bbbc44723d1ULL, 0x9758ac1fe8e0f074ULL, 0xdb51d2063569f568ULL, 0x6fc1a4f614cffccaULL, 0xe5cb60f2412eceb2ULL, 0xd4cb6cf9bcf92702ULL, 0xa0ef76fead45d647ULL, 0x2de5d15446d888a9ULL, 0xcf3c88dd40eca933ULL, },
+      { 0x69c53c25e7125b2fULL, 0xbefbae3cdd15eb01ULL, 0x4fce21148d3bd999ULL, 0xc771278277f4d2ddULL, 0x508e40e4765ecdeaULL, 0xac8d03c7b7f5c170ULL, 0x59307bdc209c17c0ULL, 0xcfff911e9a064b1aULL, 0x5192b69547e85905ULL, 0x8a04f1b68be2ce59ULL, },
+      { 0xd033b6390caed1c6ULL, 0x49fc8ba1d517c35dULL, 0x1b2b831acf277cf1ULL, 0xe80fce233e5969feULL, 0x892d39428a7750b6ULL, 0xbd128478dc9a6d3fULL, 0x49808de35adbca20ULL, 0x3810d4ff7300a55bULL, 0x1e4dbbc75d0b625bULL, 0xb7d76c58c5498c2cULL, },
+      { 0x9ce7c264a7b03625ULL, 0x84e4d66070b5583dULL, 0x314e6d7292acddf5ULL, 0xc39414fd0c83a540ULL, 0xcfb2975bdbb5bc6cULL, 0x32a84dfaa75b1002ULL, 0x5d13eb8c8838df3aULL, 0x7a14877ce68dabceULL, 0x819993c8fb840bb0ULL, 0xf4e066e371a66e73ULL, },
+      { 0x8432d6d36bbfcff6ULL, 0xba3d199ff8076a24ULL, 0x39af048837ed9c25ULL, 0x52d3c83ce8b5a18fULL, 0xa96b6ba7f9c33e0dULL, 0xfa94af11d4f28ec3ULL, 0xe7ba688f4b849902ULL, 0x1e7bf3c6a2152e10ULL, 0x2353bffa929aadcfULL, 0xa3166c805afec1d7ULL, },
+      { 0x6b23d1bd12fe0332ULL, 0xe80d5fc385a91ee3ULL, 0x530933e19f135de8ULL, 0xc9632ebc33d529a4ULL, 0xc0fa83197e12bdccULL, 0x01a9e0918348cbdcULL, 0x9a5d33433f66e007ULL, 0x972898918b360e60ULL, 0xd8d66a665d13d8f9ULL, 0xd93b7ed909a8353eULL, },
+      { 0xc846d726dd8d0bb3ULL, 0x40a718a5bbe12937ULL, 0x945cebd52b1ac3d0ULL, 0x94a0ba66b885864cULL, 0x5dbf2e12a52dab52ULL, 0x35d769bbc9d86f6bULL, 0x04e5880dc94bf498ULL, 0x452ce2cbbd1cbceeULL, 0x47ad28493359e0ccULL, 0x90ad35c3b0109353ULL, },
+      { 0x268fde4eeed881f7ULL, 0xc941893ea62ed457ULL, 0xd4babf909318b68aULL, 0xf46a7001ceefcd35ULL, 0x1720c72b745fb98fULL, 0x451b7e133dda82dbULL, 0x486bd625d41f0078ULL, 0xac595ca58f386b9dULL, 0xaf74d57d3d4afff3ULL, 0xc0b580a33962e766ULL, },
+      { 0xe492f10b41ef72eeULL, 0xd55975e323e50abbULL, 0x03a4358dd841519cULL, 0xc9f804542f2dd85dULL, 0x6ae2c98eed3739e5ULL, 0x01fd5e8ee44e6a24ULL, 0x1ac2a5901b680e8cULL, 0x1c64b962be735cb0ULL, 0x8cd5d5e8b0f068e0ULL, 0x80581265ba684a05ULL, },
+      { 0xe002e1c174650152ULL, 0x62a7002da8903463ULL, 0xc375d1b80012cc78ULL, 0x065fb05a59bb38f6ULL, 0x9803feeae1c77cdcULL, 0xa9e81d3a77da6801ULL, 0xa68c6d6ffebf3112ULL, 0x7751d7963d53d1e3ULL, 0xccb357fea80a7519ULL, 0xaaf43bbf349769baULL, },
+      { 0x7df980e5ad189153ULL, 0xe52af334a2103ee8ULL, 0x2ad76fce9847a0c1ULL, 0xe9b168fb446a7611ULL, 0x6cab992d4df62f5cULL, 0x70bd9a797a385204ULL, 0x24451368b11b1a78ULL, 0x81fd60ce2cb03bdcULL, 0x1a09a007e0ee79a3ULL, 0xe3b5e2f135ac5a99ULL, },
+      { 0x5aa42d980935ee19ULL, 0x67bfc50357cd5e06ULL, 0x78737cbdba95cdcdULL, 0x19e8698f4021f0ceULL, 0x3a5effdab5438b91ULL, 0x38d78cd94cb51798ULL, 0x5f0bec60ff548636ULL, 0xea7a5a5576a98e6aULL, 0xaf8a8295446c757fULL, 0x97a7ae21a78a9bd0ULL, },
+      { 0x3430bc56d4da964aULL, 0x537abd757a5c2e5eULL, 0xe6a575fe7082d2d4ULL, 0x84b5b1d48914aca0ULL, 0xfacfd0d9cf4910b6ULL, 0xeb67ead2a0bb4b6eULL, 0xad49dda6df59a704ULL, 0x431a58e9040343a7ULL, 0x7ad54a0b2e5649d0ULL, 0xca0113ec1351fa6eULL, },
+      { 0x28d5b47137aa7443ULL, 0x6fd8a72ae5ad0e39ULL, 0xda35ff407f2ed1f2ULL, 0xb62e87606f3ae270ULL, 0xe42349eb6cb05a38ULL, 0x257ce322a1934e33ULL, 0x95f9da5efba7b33eULL, 0xf4624b4b09b004c2ULL, 0xdb83bf06e6a68e2bULL, 0x8688ddf81c0604baULL, },
+      { 0xfc645aa1040ff2eeULL, 0xad9f3168fdc9b460ULL, 0x7d807ba743320f5eULL, 0x85deccc40c7cdacaULL, 0x23398044e2e56d74ULL, 0x8e56e4c540522b3bULL, 0xdb9625dfbdc56c62ULL, 0x31d11732d717adb9ULL, 0x6fc990e8e203299fULL, 0xb3332d8fc366dc9bULL, },
+      { 0xa2c9367c688c80d8ULL, 0xd1c6d4ff44758767ULL, 0x6f1cb4dc5125bb1bULL, 0x2834e93df87d6079ULL, 0x38a57a19772eb808ULL, 0xc2f59ac9f80c222eULL, 0xf5050c495fcf5b1bULL, 0xe537e2d6ad1c776bULL, 0xf55c7a0ba7c7c28aULL, 0xeeb1a9440234d5ebULL, },
+      { 0xc0ffe69f21f54335ULL, 0xd519a8b7d4596732ULL, 0x78a2827a68ea688eULL, 0x863b78e5ae1cbf16ULL, 0x0679afd8392f5de9ULL, 0x1c6b2a3885fee0f3ULL, 0x143a73df63f25789ULL, 0xccbad476d987f1abULL, 0x5521875e1aa2e7caULL, 0x9ef851e02ace7ee3ULL, },
+      { 0x8d2dbabbe5b24e2dULL, 0xa226448659dceb2bULL, 0x556f18703815a6a5ULL, 0x53adba17014b609dULL, 0x12c2e30462ead4a6ULL, 0x6ec51c7eef6db9a7ULL, 0x0f964dad0b8dca92ULL, 0x4915ecea6eae7336ULL, 0xfc3bbc7ffc6194abULL, 0xd3bf6e42b6f967d8ULL, },
+      { 0x468549673ebbaec0ULL, 0x30b5056fa4e9ba30ULL, 0x3a063e8a2ac56ff3ULL, 0xbbed75ed9873962dULL, 0xb43b6df28bf5df97ULL, 0xa0514603279f79b3ULL, 0x3ec91ce112847ebfULL, 0x10286ff9f88afb10ULL, 0x0fb8bac6b1d04b35ULL, 0x8d061aa16beb1afeULL, },
+      { 0xcfb31db705d9da70ULL, 0xa5abc26c983b52faULL, 0x3a968c5b43fc131fULL, 0x6eb48823faf6869dULL, 0x402d031a6fd3992cULL, 0xb76db6a4e27c18a7ULL, 0x4575fd2fe8287dc6ULL, 0x9717eae95fb5c02bULL, 0xf124fc15622d2a75ULL, 0xbbd7f15f0723d7afULL, },
+      { 0xd0b813e881b2d32bULL, 0x246c475c251609f2ULL, 0xc17cf40199608858ULL, 0x31199f7e514ef4c8ULL, 0x706022200204c907ULL, 0x2f5e5d22c6665375ULL, 0x12d4fa2d968cfadaULL, 0x6ae6c52b37bb4a2cULL, 0x9d411bfcdd2814a6ULL, 0xfa350f738573f7eeULL, },
+      { 0xf4a685dd0cc95234ULL, 0x8f2eff1cabab0cccULL, 0xd006c4372a3601bbULL, 0xc5a27c0e10ea1703ULL, 0x1cbfe31367780155ULL, 0x9e569319a4c9261bULL, 0x6af618a92822e64fULL, 0xdfa0caf49f5d8b0bULL, 0x54b6811709ab40e3ULL, 0xa6a34904f316a518ULL, },
+      { 0x104c983070f07ab9ULL, 0xdb6edc7b13430fadULL, 0xadbdf6c2c68648b2ULL, 0x1a007a3af6dfaee4ULL, 0xc17f6e4bcccaaa34ULL, 0x76381b19cad2fb18ULL, 0x3012d3a12bd582a2ULL, 0x44eb3294f99b273bULL, 0x16eff82dc1a013b9ULL, 0xddf618edcda3367fULL, },
+      { 0xa3550fa7dc62b98fULL, 0x956a531e209842a4ULL, 0xa9f517570ad4ea2eULL, 0x47e59dad397ec1d1ULL, 0x406337cc15c55d87ULL, 0x41e51af40ac0240eULL, 0xca04498e7b994305ULL, 0xba52cb9ad0ea77a4ULL, 0x2aa9e049e9e6497eULL, 0x93d3784941bee811ULL, },
+      { 0x4c03494f1ac4bd4dULL, 0x4b9efe1ad7f40f4fULL, 0x0e9df23c48e396cfULL, 0xc66e6400adb10713ULL, 0x1ebc38d0f3c1d05dULL, 0x123c4e8a357045baULL, 0x14497a9a38a33bedULL, 0x3f069146e80e4f8dULL, 0x1cc58ae481f959aeULL, 0xc4e770748964966fULL, },
+      { 0xd875c6607727e709ULL, 0xcf8b26343eac9088ULL, 0xfac655b61e09b81fULL, 0xaffa22767119488bULL, 0x8b56c2e07bf3f264ULL, 0x62bff65d33cccd11ULL, 0xc3f9b8c19b95292bULL, 0xecb1ae331d8efc37ULL, 0x8aa938392d9df0f5ULL, 0x83235018b940c80bULL, },
+      { 0xad971b40b9ab3aa8ULL, 0xbfce45647347e70cULL, 0x15eeaf05d96e340eULL, 0xa6ab512e780a8f4aULL, 0x81a17ef33fda6fabULL, 0x151e20e3e4d5a238ULL, 0x09a51bcd906b713bULL, 0xfcf876ee137fcdc6ULL, 0x2e20c7e54d09e009ULL, 0xaeaceee84c8628ffULL, },
+      { 0x17c4b00be35f39e1ULL, 0x7364eea33be24530ULL, 0xe67eda92fb65c138ULL, 0x685d1b652870cc05ULL, 0xd5db28eba0d44f4eULL, 0x44c0079250bb61d3ULL, 0xf5a41b267f727b38ULL, 0xda36b1f02d01706aULL, 0xd7ffda81feb7fd74ULL, 0xe8aae1908f9d93aeULL, },
+      { 0x559bd0dabf31e358ULL, 0x1913284b4b6fd6b3ULL, 0xde1c9ceac34bd785ULL, 0x8fe8c181b0e0c313ULL, 0x24877980318bb293ULL, 0x565c340b5f1a7bf0ULL, 0x549b6a04d8d18a38ULL, 0x4f717fedec0c5b5fULL, 0x6e7e6d43e87e470dULL, 0x9af4d45e90b41503ULL, },
+      { 0x0bb8bbca4a8e5e3bULL, 0x3e05cf4e40885d3fULL, 0x61807a483db28250ULL, 0x1b00e4e7ae771121ULL, 0x471a34206fae2512ULL, 0x1616b471726593e9ULL, 0x25027e42f8795c8bULL, 0x670c93ccf1c9eacfULL, 0x19bc4931b8ef7855ULL, 0xce66d0bcbe827675ULL, },
+      { 0xd8d2fcce8eee4202ULL, 0xfac4999d8e488056ULL, 0xbfaa62b53acafbabULL, 0x79a14a155a5a3199ULL, 0xc33223e0ec21f51cULL, 0x9c5e017916920040ULL, 0xcb70ba2e94520766ULL, 0x71d565e91ca158f9ULL, 0xf03746e9b74a4bf3ULL, 0x89769b7b5332d644ULL, },
+      { 0xcfc64e0b3549cf1cULL, 0x8c42ff56ecc3dfa8ULL, 0x969d0e534e5986b8ULL, 0xe89c4e93bce0d07bULL, 0x346cb1b33834822aULL, 0x0ad2bb621fbffc35ULL, 0xcd99abc968ab614fULL, 0xb6d6a24f58bbd4aaULL, 0xc05e3125168367caULL, 0xb719d4aed1968ba4ULL, },
+      { 0x0cde728693dfa933ULL, 0xdd47758276dff251ULL, 0x834ce6b40a8ad59bULL, 0x60a6ae7f7a4bbfe0ULL, 0xd341008791694300ULL, 0x53dc9707fa03ab25ULL, 0x460218c73a5c8394ULL, 0x950128fb6265994eULL, 0x8ce9858a94a7712cULL, 0xf3e3dd76e58d62bbULL, },
+      { 0x592798c8ab001617ULL, 0xfdc0701fb549bdefULL, 0xe9f1487ffee31fd1ULL, 0x8ea3ad1f09efb19bULL, 0x2aefc95cab4b93a2ULL, 0x465780d834387813ULL, 0x1cc64b9b44847769ULL, 0xfbd6634b61388c23ULL, 0x145dde67412fecccULL, 0xa26e3c09d82bf2eeULL, },
+      { 0x57356218ad03e60dULL, 0xda1c37299ae60244ULL, 0x69e6e91f6f8ccf34ULL, 0x4d889a0dbcb4694aULL, 0x3e8cd9201bcb859fULL, 0xa3f2f1042ede578fULL, 0x355008e66c574a91ULL, 0xef01e08a03baf528ULL, 0x00d42ad707089b9dULL, 0xd85b77b5dba74296ULL, },
+      { 0xd0f75b8f8ae64fa6ULL, 0x754c1c4afa989d2dULL, 0x7bf7d0d2dfb1c863ULL, 0x1d1f3c11d95096e9ULL, 0x9689364a67df16b9ULL, 0xfd02d30786e3662bULL, 0xb6f660cb010eb1d3ULL, 0x19c2f7ea77223cccULL, 0x78ada0d373e1c36fULL, 0x901801f44d74c3f4ULL, },
+      { 0xcb74b932e341b413ULL, 0xd11264122f0fecf2ULL, 0x662608f003dee9e1ULL, 0x1781bb8600187448ULL, 0xed7863812c173da2ULL, 0x68bc24eb9941e988ULL, 0x199caf21d05bb2efULL, 0x7de105259a6a9f00ULL, 0xa35ad71630029298ULL, 0xbfeec3e1b7dc6a18ULL, },
+      { 0x2085ec6db31d2d82ULL, 0xdf62d8df4867b69aULL, 0xd7e6db5208ee74c8ULL, 0x8a36a7fcf64205d2ULL, 0x74438abb885effe6ULL, 0x3ea55aef47a4566aULL, 0x0dccc3f50056d55bULL, 0x87d48ed04ca7cdc9ULL, 0x1c0d7ed99b142de1ULL, 0xffa76d0a4117c681ULL, },
+      { 0xeaaf896de7a1c058ULL, 0xf6ed363a9e93c660ULL, 0x89daf6a8ac9c3f26ULL, 0x05ccad8eac86eedfULL, 0xe6a387f0f423ada9ULL, 0xf75eef772ada331bULL, 0x2b1601fd5afbec7fULL, 0x321cc5538069e73dULL, 0x4bce9a85cc3f0929ULL, 0xaa43ee7a72495c4dULL, },
+      { 0xe0fccddbdb0fe47bULL, 0x3ef074a2f37ccdaeULL, 0x38ba8a372cb829c9ULL, 0x2571146a9d3d84f1ULL, 0xef81650d2f92a065ULL, 0x05cb502472323621ULL, 0xacca45d05f363405ULL, 0x65e787dc61aaded6ULL, 0xf1da150e36637ccaULL, 0xe2cb0d80cb80136eULL, },
+      { 0xd00102d5eea73b3aULL, 0x8e6cda88b0276af3ULL, 0x75891bbbeb451047ULL, 0x79b651a914587182ULL, 0xa020b7fbd0618419ULL, 0xf8a09078f63453d3ULL, 0xef743747192c2416ULL, 0x883ff32d20bf2716ULL, 0x38aed1a8ee33e85fULL, 0x970b47f77af691f9ULL, },
+      { 0x20dcdc80bc2b4bf1ULL, 0x2642db0e7d10a98cULL, 0x5ac1d7e789ee5c76ULL, 0x27cb3f0574013ccfULL, 0x5d573355f4be8021ULL, 0x07ae22f002c4d095ULL, 0x815b55d11485fba1ULL, 0x7a7c8392b157cdd1ULL, 0x0542b8af493f97ffULL, 0xc930c1272796b079ULL, },
+      { 0x6937336780c59b7dULL, 0xec65fe332645bae4ULL, 0x0d6ae3bda185e044ULL, 0xa13c4b09a040a508ULL, 0xacdba9001137a554ULL, 0xd58c28be6ca7f9d9ULL, 0x83a54192e4ca6c36ULL, 0x8ec36176a135c445ULL, 0x05c6c5460fa5230eULL, 0x85fe1fb891d325dfULL, },
+      { 0x7e19471deac9a355ULL, 0x8966ada283089de2ULL, 0x093e86fa4db2b9daULL, 0xc7a44f843a7524baULL, 0x178fa954f233c77aULL, 0x837638cf2a6818cbULL, 0x63cc749e7e7811c1ULL, 0xffba76cea0713798ULL, 0x6fc237eb5bc8500dULL, 0xb27a5f504f4a4e08ULL, },
+      { 0x2ce771ddd431f4b4ULL, 0xe1d03ea0f542833cULL, 0x22f107c6e2a5a94aULL, 0x4a73c292c5a68833ULL, 0x52b4982410275df0ULL, 0xcdb32481dc964a39ULL, 0xda94c7096517c71dULL, 0x8da0b903e5e1af39ULL, 0xe478f1b3c65fb5c9ULL, 0xedbb8017ff97971dULL, },
+      { 0x61d18932a337d0e4ULL, 0xc58a60c6d15cc02dULL, 0x30f1792fd6ee6b2cULL, 0xcefe5e6e978e0f20ULL, 0x465401bb2691ccedULL, 0x0a096ab2f803c112ULL, 0xd3d164d74b4f95bcULL, 0x501212984f5713dcULL, 0xa223596d4f7d6333ULL, 0x9e54607dc3ab1db8ULL, },
+      { 0x060569f07cb7f7eaULL, 0x6e107947936c94d9ULL, 0x51e034f3f7c58b3aULL, 0x6417007d5c05f6efULL, 0x7727456d4bfc3f6dULL, 0x27af7108b1f61b4dULL, 0x3cc989f641901259ULL, 0xe3dc76b5d28587eaULL, 0x1c6c6ea5d1ed36d3ULL, 0xd2e50f1c29b08d8cULL, },
+      { 0x68af10f6a3f60e04ULL, 0xdcea530b85b933f7ULL, 0x4ef57c593e05f27fULL, 0xf263d083ba8eef29ULL, 0x78cc5f761e2f6891ULL, 0x02b91398df90b54eULL, 0x4b792704dbef76a0ULL, 0x9c4208db4c4c16a7ULL, 0x21c4399794dd78c7ULL, 0x8c74ab2db124c02eULL, },
+      { 0xa237d1e2cac760eaULL, 0x038681f10646483fULL, 0x00e3ec69fc98ec76ULL, 0x2468a82fc64a3310ULL, 0x3292057123d9e4c9ULL, 0x9bcaaf1b953e917dULL, 0xdf90cfab5f4edcafULL, 0xbc0cdec48af0f15bULL, 0x580823024c12037bULL, 0xbb1639237ca6075eULL, },
+      { 0xb5574fc3894ce1cfULL, 0x007c1b483c138d17ULL, 0xaa813188a53d3f5aULL, 0xeb5dc5852d94538cULL, 0x2a469c0b5b17107fULL, 0x2116c10d094d77d3ULL, 0x57d38c04e20aafe3ULL, 0x2119a10a7d3c739eULL, 0x607a402c7a585de9ULL, 0xf93306adf1dce042ULL, },
+      { 0x0b1d762820c24ed1ULL, 0x907d8ebaa4c427e0ULL, 0x3cf6650855dd9f49ULL, 0x1916c3e8c6535e82ULL, 0x3271882039f9e170ULL, 0x7215f8efcaa3a96cULL, 0xe29327fa099322f5ULL, 0x046b6581ece7ab44ULL, 0xdf6b56aa22b1e1acULL, 0xa5f76f43922a7792ULL, },
+      { 0xbd1350878451bb84ULL, 0xe86c13163ccfd62fULL, 0x100b47d24ab207f6ULL, 0x192a52a04373599aULL, 0xe6847efc763628baULL, 0x61cf025442b60f0eULL, 0x79823c6853e66c15ULL, 0xf99f325ac0cc3dd9ULL, 0xc5e1349d3be4232eULL, 0xdd113151caf3ffd7ULL, },
+      { 0x53457e2a5965079cULL, 0x2b2b14401e691ceaULL, 0x787d0653daf26085ULL, 0x51fcdb5dba1d3831ULL, 0xbbf80adacd8d373aULL, 0xba8db938c6d3ccddULL, 0xc47ad6f505207f38ULL, 0x0c435de519a653eeULL, 0xbb6ecfd8bf5ff377ULL, 0x933b04fea794ada4ULL, },
+      { 0x63010f84cb992636ULL, 0x741bbf8338f823d1ULL, 0x9b0b17b534d374fcULL, 0x81d97e0bba699a36ULL, 0xc89e2bfd4412170eULL, 0x3f2711a0bb66c0a8ULL, 0x0b429cbf3bab4782ULL, 0x0f7d7043be6f86fcULL, 0xe717ca40e1233784ULL, 0xc41c602ae7db8ceeULL, },
+      { 0xe510ecbd645e59fdULL, 0x5db32438c92d4057ULL, 0xd88047261fef9c29ULL, 0x4cc4123d052c87deULL, 0x73e2f2db220762b4ULL, 0xb0e8a2af5cfa09feULL, 0xf6eff4506d987c62ULL, 0x1149bba033fdb78cULL, 0x047d8b35207385b0ULL, 0x829c129aa034679fULL, },
+      { 0x9de02a0fbd983bdeULL, 0xcb805b5881d84b87ULL, 0xd844d005ad67a0caULL, 0xe34d00561700b170ULL, 0x41bc60ea117daeaaULL, 0x55d0ad5045ee1caaULL, 0xc88fd1fbe26d0e96ULL, 0x9ee339d6486548caULL, 0xdb3dc0f0c3ea6891ULL, 0xadf8cb22f6621010ULL, },
+      { 0x90899089f981843bULL, 0xb0c054226e004c09ULL, 0x238ebce776b09087ULL, 0x3b1b600aae4c56a8ULL, 0x7c7b0064e754c31eULL, 0x2751255586e28120ULL, 0xa56105ac21c07125ULL, 0xdf320254f6376692ULL, 0xbf86bef8ef8b1489ULL, 0xe7baef6f272c1265ULL, },
+      { 0x0274f1217ff5dc8eULL, 0xc271f9e56252db78ULL, 0x53793dd399c07268ULL, 0x1b89b6f63d5f2145ULL, 0x315a147dff32966dULL, 0xa01faf5aa470de5aULL, 0x3c370bb767a202e9ULL, 0xb557d96126196ab8ULL, 0x10cebdbfdb917d4eULL, 0x9a55069e05cc29f8ULL, },
+      { 0xd1db9b5b5c7424e1ULL, 0x5287fdac01df29fbULL, 0x70a5f6ab200adbb1ULL, 0xccad17cf967e617bULL, 0x2b5cae78995ef2dbULL, 0x1d4781f0f34a6b5cULL, 0xa21e4a24e62a800eULL, 0x19615f0f32828827ULL, 0x30eadcfbf1d6e879ULL, 0xcd91f503de9b8516ULL, },
+      { 0x303310a51e71302aULL, 0x69fa80a81192d50eULL, 0x5290487d68290ecdULL, 0x62006cb71c117425ULL, 0x0c4fbc5e9448c2cfULL, 0xc4dd49e3e3fef5fbULL, 0x0f5236207c594634ULL, 0xcfd787f46b47a5b3ULL, 0x7142b7ebbd7518adULL, 0x88e8d80a329bc801ULL, },
+      { 0x465e61ca3d377301ULL, 0x4b0c289562a456fdULL, 0x9c842b9d2a52d390ULL, 0xa78a4fb698066601ULL, 0xde06bc614c638139ULL, 0x4be8769934b6b339ULL, 0x8080127034fdac5dULL, 0x6f99bd192544d5dcULL, 0x64c8c76632799132ULL, 0xb65d008ad373efe0ULL, },
+      { 0x8e3eba61e1b760fcULL, 0x4a0c35f33fa4baecULL, 0xf28263b6f80e50ecULL, 0x7eb1c69ee0cba1bbULL, 0xcef6acceafb4ee34ULL, 0x45bb6b6ebf4d4fc1ULL, 0x437a07707f7f08f0ULL, 0xe4e424f3158561abULL, 0x6732f110916c8904ULL, 0xf2e8587a23ee21d0ULL, },
+      { 0x2e0bcbbb4788119dULL, 0x5f8a9bb7f03e9d8dULL, 0x4763988088ff2986ULL, 0xd8b6cee2821a1d7dULL, 0x5f8258dd49821cf1ULL, 0x67172c8b53f17fefULL, 0xdc191afda8b62825ULL, 0xb942b170c965b3b2ULL, 0xec8d45d98b1edfd2ULL, 0xa1c6b906b0e645d2ULL, },
+      { 0x826f351716d30878ULL, 0x383dfe07019a3de2ULL, 0x09212e5d870a8582ULL, 0x3aa9b9800519316fULL, 0xe1a4a59d2433b7a9ULL, 0xa01a52a6c5d453ddULL, 0x9912d3eebe82fcbcULL, 0xe331046e431f8bb9ULL, 0x9f96cd6e020b3ee0ULL, 0xd77c579be092a01cULL, },
+      { 0xa64cd9da0a24b721ULL, 0xacaa188371645b99ULL, 0x100be3151aaf81cbULL, 0x2b2f9ac188062a64ULL, 0x23697faf94866593ULL, 0x4229177c322ec867ULL, 0xeac2057d4f1367c6ULL, 0x00fbba34597a4d86ULL, 0xa63ef45fee2a89e6ULL, 0x8f8368039229787aULL, },
+      { 0x38df9f34c54fe8cbULL, 0x6a8087eaf8be881cULL, 0x715bfe5471656fe5ULL, 0xf74e627ce3c365d5ULL, 0x3b76ee1c17670253ULL, 0x86d44cfabe222002ULL, 0xc4d7631e297d5e89ULL, 0x9aa907f3fa59029eULL, 0xee05d5462dd74543ULL, 0xbf28d4147f66cee9ULL, },
+      { 0xbbc9c259f3a2efbfULL, 0x69f70feeaef8470bULL, 0x4a9db31936d11201ULL, 0x11f724187d1e69dfULL, 0xf54f40bc9d5d884cULL, 0xfd8d24ba69c376bfULL, 0xc8418edec1bfc762ULL, 0xfa5a6c5bd696fa76ULL, 0x53f6fd1311b2899eULL, 0xfe9fc648b8bcb407ULL, },
+      { 0x62f9180044be3d53ULL, 0xd8686e701ae0f478ULL, 0x8a19d2798187c034ULL, 0x0365464fd5fb08c5ULL, 0x3d30984442488cc3ULL, 0xc77166a18279495eULL, 0xe95c73b344a86499ULL, 0xc87d20fe02fce979ULL, 0xf229c14f3573a40cULL, 0xa9945706d144eaadULL, },
+      { 0x066fa39aa45da422ULL, 0x5d02473ebfcb4098ULL, 0xb513d79eac7c0affULL, 0x10da035d043dc844ULL, 0x5d05b1c39259e2adULL, 0x2eea708a88de137aULL, 0xff9d4cac442a567aULL, 0xee142eca8b477f90ULL, 0xcee54dcd4d41d085ULL, 0xe1e12a3e6a99af41ULL, },
+      { 0x6b8b715c839bf575ULL, 0x023c8a80b486972eULL, 0xe58e308b0e146769ULL, 0x48b7ebf02e32a127ULL, 0x26069a4267eef1d0ULL, 0x6bcc6d0aa3c9fc37ULL, 0xbf6eb1cd5f63bb9bULL, 0x5b84f0798beae243ULL, 0x5bb98dda883da82eULL, 0x966f8317f271cc5cULL, },
+      { 0x243197f7363f7a3dULL, 0xfc4cb653296fa174ULL, 0x2796341043fe459bULL, 0x3498744c0d487fbeULL, 0xfc7a60ba51a1d84bULL, 0x67752bfbb16e849dULL, 0xc2b93c80ad958c00ULL, 0xa3abc997cde697dbULL, 0xb3d728166cb7fe33ULL, 0xc86145394c9544caULL, },
+      { 0x3a1ebe90abcd9538ULL, 0x832cf07567d339d4ULL, 0x6ad0b829e2c1238eULL, 0xb64206fe2d649b78ULL, 0x197a57c855637174ULL, 0x74a104cf5e82cd5bULL, 0xd31f7cb6ffc3e1d3ULL, 0xd2b17e716f5893a0ULL, 0x718e8c4ea73abf7cULL, 0x8573f08e5ca085e5ULL, },
+      { 0xa173043aae1ea9a3ULL, 0x46c593d87590e98cULL, 0x6ad69e7b313c7347ULL, 0xd381e054db1eb842ULL, 0xfead6508137f5f86ULL, 0xc7344ef5890c16acULL, 0x57909acf9a01cf7fULL, 0x6285304789c3a764ULL, 0x71ef9e01bdd430dfULL, 0xb1c24fa710dc2db2ULL, },
+      { 0x92b9bbb439fefea9ULL, 0x3fa3ea7f03fe31a1ULL, 0x8070bb96374c77b2ULL, 0xb2f55e3caf53a2bfULL, 0xd4137b48436032f4ULL, 0xea95e8d97356266aULL, 0xd8c9752c51074d79ULL, 0xdbe1327651498631ULL, 0x2a6df1ff26b962bbULL, 0xecc654c8778146c1ULL, },
+      { 0x43fd6b704e79a1bbULL, 0xeb7d74806e43c058ULL, 0x745e9078308ffdc3ULL, 0x3a04b9ca4525c30dULL, 0xe45a657b24965130ULL, 0x37fb4a58b988538eULL, 0x72e83cfd2ff43b4cULL, 0xffa031e9be0f3517ULL, 0x8d1156b05c6bf826ULL, 0x9db1182da26c8d9cULL, },
+      { 0xf0a7fa4e53d6183eULL, 0x23a58556433b67eeULL, 0x287f85169cd323f2ULL, 0xc1552e45b829e3adULL, 0xdd677b54a00d61a1ULL, 0x670df46ba6b7d875ULL, 0x5f510488d78aba3aULL, 0x8666c26667fe6b1bULL, 0x0c7ebb060e68db49ULL, 0xd20b912986ec4cf6ULL, },
+      { 0x2f9e56379c8f8fbeULL, 0x16dc9531d002642fULL, 0x05f120e6a3abb35cULL, 0x8ae57dc68e69b1bbULL, 0x3487797bdf1512f8ULL, 0x78ba4f26757093dfULL, 0x443743257aead72aULL, 0x277b4a5a503af76fULL, 0x910da033ad938849ULL, 0x8be3d1b6173fe1dcULL, },
+      { 0xe7856fa2e38cb6f1ULL, 0xe99f43eb0db9de3dULL, 0x8d40fd32f26368ebULL, 0xaab6bea869785630ULL, 0x16a58a06b7a7f1aaULL, 0x797e677602d74eddULL, 0xc2128f2ea34808c6ULL, 0xfc04a362cebfd40dULL, 0x9d73779f54ae8b47ULL, 0xba5548af8687c83dULL, },
+      { 0x03c5cb9e819233b5ULL, 0x2698283b909fd93dULL, 0xbab14a600a01f15aULL, 0xfec69bde56c1c5bfULL, 0x84af279fc8fcc449ULL, 0x8d1adff3d2437014ULL, 0x2a40c63132f6f0c1ULL, 0xd8771ee084acb13eULL, 0x28e928ba4463c4b4ULL, 0xf8320803881be5d3ULL, },
+      { 0xbf046633a6ab701dULL, 0xd7ff8c65c60f74d3ULL, 0x23781638619bf89dULL, 0xe198e3381ea251daULL, 0x4c70ce2382b60c5aULL, 0x2b0bff4bbeaa9fc1ULL, 0x64c74170d21ecfbaULL, 0x0b404dff8f300f22ULL, 0x49cf26a1e26c815bULL, 0xa54c46bc29b18d1aULL, },
+      { 0x9e1941504165c83cULL, 0x3e054ed0d45340e5ULL, 0x70d42efbe31ec93cULL, 0x16c683039d72e389ULL, 0x4e1b6b9f481d00fbULL, 0x5f7b18aba620825eULL, 0xe32dc47609375cb9ULL, 0x13dc125f8d2fb895ULL, 0x6f59cbfe59507f2aULL, 0xdc2d35c6820b403fULL, },
+      { 0xe84f76e0601a27b2ULL, 0xd2d79f450c617db3ULL, 0x529db24c9875e1c8ULL, 0x7e6092e61f97c1dfULL, 0x0f2405ffa957a5f2ULL, 0xc37ec3574d865a2aULL, 0xc232a659be624500ULL, 0xb801d92d4ed3ded1ULL, 0xd83f27ea8192ceceULL, 0x92a32eec329f0e92ULL, },
+      { 0x620265a27f69e3aeULL, 0xb446b0f63a0cfca8ULL, 0x3647a126478e1df8ULL, 0xf4c4e5493d294dd8ULL, 0xa542538647861578ULL, 0x70d26ab95e18dee2ULL, 0xf9a2c5db7c9910d5ULL, 0x5f9931461adc30f2ULL, 0x312273ee64663849ULL, 0xc352214bbcdb23fdULL, },
+      { 0x4d9da4ccea28a841ULL, 0x5bb051bf51068a03ULL, 0xe53ecfd6a2637201ULL, 0xe4e7cf8b8b960306ULL, 0x90c580b98a2524cfULL, 0x682951b8b35feed4ULL, 0xea471df1fa2c39a0ULL, 0xc02869c2cad7ff64ULL, 0x79eae1b076ff9cf6ULL, 0x821560950d4fa87cULL, },
+      { 0x5f01ce766ef244deULL, 0xc1a7471fddc98779ULL, 0x54be90de38400146ULL, 0x9e8a2f39cd0b87d7ULL, 0xc1f2e0037213c04fULL, 0xdb3167237cee1acfULL, 0x5dc3be31276a6671ULL, 0xbf9f229df55fc589ULL, 0x7aaaea36a1bb683fULL, 0xad456123fe301921ULL, },
+      { 0xf0c850048b91a0b4ULL, 0x5314b04d6ae0ff49ULL, 0xcb268ae256308114ULL, 0x7e0a8c49af5a0b21ULL, 0x7646b4ae24d7e84aULL, 0xa9554b91cc1e9d2aULL, 0xbc365819d386108bULL, 0xb2a54237d23864baULL, 0x712f15384a5e8a5bULL, 0xe6cbf4c16944015bULL, },
+      { 0xbc09255e9c1c97d7ULL, 0x125994aefb62e9f3ULL, 0x7c6c442c3eefc932ULL, 0x47d12e70dfb05d64ULL, 0x1c166c3c6635315eULL, 0x1b5c63b9a1748e82ULL, 0x712aa699e2746cf2ULL, 0xdf89128af8ae7e1dULL, 0x794209cebafefff2ULL, 0x99b5ddaaf92bd7c3ULL, },
+      { 0x86b650418cf5e5acULL, 0x7d01fc97de4c626eULL, 0x43dcfc3695da85b8ULL, 0xec9679e0dea1ccf8ULL, 0xfa7cd7cc406ea58fULL, 0x8437f64c68a66f43ULL, 0x1567cd1703b06b27ULL, 0x7a5db799ea82a52dULL, 0xd0d97dde065004b8ULL, 0xccbdf4cf54893561ULL, },
+      { 0x2071d1aabebdf3d5ULL, 0xcadce477bbc69901ULL, 0x82272d8b3b9ed078ULL, 0x295f1bda9209fdafULL, 0x087aa81bf510d4f4ULL, 0xe840d83e0b9dbf22ULL, 0x00f247b394158aacULL, 0xa2c94133caf984b2ULL, 0x8620594cffdf8500ULL, 0x885ba6cbc88068c1ULL, },
+      { 0x9d327357ea3e3905ULL, 0xc38c0042aeb53a41ULL, 0x8da8d49c83e9be00ULL, 0x835b36c995d369a7ULL, 0xea625a02d25deb1dULL, 0x3c43d210806518faULL, 0xf9d4281accdb0adaULL, 0xdcf3d42ce07c6032ULL, 0x93927a1754fc50b1ULL, 0xb5a0ef232721b935ULL, },
+      { 0x2c4c510c872b61afULL, 0x99a7830ca4015c2dULL, 0x7a7ac2c7e2f25dcaULL, 0x0322478fa9661c0aULL, 0x59f0bc66b2dcb94dULL, 0xb7e08f7eda4661deULL, 0xda108d9c8fd55434ULL, 0x731bc9048f2ce2caULL, 0xdbf13e2f57d0e7daULL, 0xf1edd6e0975cbc22ULL, },
+      { 0x43b3cd65c052d9d9ULL, 0xdf498010518ab56bULL, 0x11f2b9d08b7347efULL, 0x2521860cb167c3f3ULL, 0xe44da23809bfa96dULL, 0xb529ae1174ab4cc8ULL, 0x3655958ea923b9a3ULL, 0xf133819411384488ULL, 0x56ffb3120383d8e4ULL, 0xa11fe2c404caed2aULL, },
+      { 0x17d03c691fb70876ULL, 0xdd8bb40ff2e15f77ULL, 0x0097c421c5f5db92ULL, 0x6ca301ca8b965e65ULL, 0x2aec19c6cfd93731ULL, 0xd13f3529d0c84b5bULL, 0x8e1352e7a6d8cc0dULL, 0x3c1d1598f9fd3855ULL, 0x174d2faf1b96d0e9ULL, 0xd69e1d9cd5086c3dULL, },
+      { 0x26249f8aff6628b7ULL, 0x4b5fae62639129edULL, 0xdc6fdff7db85311aULL, 0x272d808abfaa996aULL, 0xdac324f98045cd3cULL, 0xdba76b702e8f7f37ULL, 0xdf11442639d118a5ULL, 0xa1c42683d0656c53ULL, 0x7b025b82ef3ca359ULL, 0x8eef6752cf4ee4e1ULL, },
+      { 0x9e2bbffe89eddba0ULL, 0x4a43c396646951b4ULL, 0x9a20f47625b85d15ULL, 0x78a22988c8675a61ULL, 0xb63cf4ce28b9779dULL, 0x9ea68ddec5bef34eULL, 0xce194a0de2d131a0ULL, 0xa396c6c399caa471ULL, 0x562349e699223c2aULL, 0xbe63b0683268299aULL, },
+      { 0x0a00ffdac13432e4ULL, 0x3ddebf5f6bc82623ULL, 0x3b90b7e8a1344e5dULL, 0xed691f6d3e2ffc71ULL, 0xbde6d05b8d4bc2c3ULL, 0x24c9ed0e279ecb1cULL, 0xe795b0e3128808f0ULL, 0xc2e9050200c75a9dULL, 0xe5108e19f2584ec1ULL, 0xfd992f6d51d91dfcULL, },
+      { 0xbaa80df826a03f5eULL, 0xcf0984392f415a18ULL, 0x6c4f4c36d2aae746ULL, 0x0508dfb22c4163fbULL, 0xb13603b5cc433685ULL, 0xa33de03413476ef3ULL, 0xc61e8a1830c2315bULL, 0x86ebfba61ee58790ULL, 0xcdab05191b560991ULL, 0xa8e574a8d061c9a4ULL, },
+      { 0xfe2578f776221e9aULL, 0x580f9bdca04dd4fcULL, 0xbc082181eae079cbULL, 0x7b30980d3d27aafdULL, 0xc959c5a1ec602e8bULL, 0x2e49f8ece062e637ULL, 0x9e87b9e0f1c30522ULL, 0xd515269f0e10bfdcULL, 0xaeffd599a5f9b6a0ULL, 0xe0f838305182d6caULL, },
+      { 0x6f2b7f4b1da5c7c0ULL, 0x4a09f14b29563e2dULL, 0x518a7c4b11bf7e00ULL, 0x2a0c9ea1fd011177ULL, 0xf98138f0f7fbd480ULL, 0x8781e15cab1c0e25ULL, 0xca6925dc48b53c43ULL, 0x8d62ec01fea1b843ULL, 0x8bb528e1cd732a45ULL, 0x95d45edcb7b042b3ULL, },
+      { 0xf974747498fdb4adULL, 0xa3a927969933c79cULL, 0x746faf2f75770ff5ULL, 0x90d9be32114e6b63ULL, 0xfbd9515d188fdbc5ULL, 0x46fbff2008473650ULL, 0x85aa526b90d8f209ULL, 0xc41ebe8a3b82c080ULL, 0x93119c579c205ad2ULL, 0xc7929f44f2c12023ULL, },
+      { 0xf53143b6367ec44fULL, 0xaf0bd02475dc2118ULL, 0x7305f785a0e15f5bULL, 0x45f6051534bdd68cULL, 0x5f98718ad8a3482cULL, 0x8be24c0225bfcdc0ULL, 0x0ad0cfc40449afdaULL, 0xfd6b7c1b2937d14cULL, 0xaeb31d5b99dfda41ULL, 0x84ea4fe5ed41e4a0ULL, },
+      { 0x19f334238f62f893ULL, 0xefb3b9b7173b0282ULL, 0x7e763d6eda82b216ULL, 0x48f8e4c63421720eULL, 0xd0ec7d143ca526faULL, 0x32be72d42f7acf4bULL, 0x226dad1ae7ad2e2bULL, 0xe3207d62aef952f4ULL, 0xd45fa86b6b5d72c9ULL, 0xb10afdcf7ba4bbe1ULL, },
+      { 0xe456d11a65c91df5ULL, 0xc0e4ada4a594fe25ULL, 0x1dee8662d6737f2bULL, 0x4140b7c15c14bd10ULL, 0x505a8705ef37e856ULL, 0x2f938eb972b2cfe3ULL, 0xc77b0220b8d9c1e5ULL, 0x3b9b60bbc3db011dULL, 0x4a9b90187e5007beULL, 0xebd2264f9c7e3813ULL, },
+      { 0xf31c110727d28f20ULL, 0x81407a6e5b46f018ULL, 0xef1754b4ac94e312ULL, 0xd23adc82b75bb52eULL, 0x7869855ba635fffdULL, 0x3552540e5c7dd46aULL, 0x3c30d16a6140fcaaULL, 0x29d84d4e0e1f4450ULL, 0xb8e6abb3814d5d01ULL, 0x9d0e78416ad789fbULL, },
+      { 0x205ad75211603ba8ULL, 0xdf43337c1ebc5050ULL, 0x381314572a5807e7ULL, 0x046b0649e5a38e74ULL, 0x80fa99403fe09aa3ULL, 0x780b07b16c775749ULL, 0x8030edd3f26fb9dcULL, 0xc91a42c017dd1a67ULL, 0xb63a5bacf750a501ULL, 0xd132f3828f49b096ULL, },
+      { 0x87c9f5a76d011b37ULL, 0x5c2c84488803e05dULL, 0x42379c32cf476845ULL, 0xbde20ce90bc4d5b9ULL, 0x50910d9cfdf551a1ULL, 0xc1d912527361e324ULL, 0xe427bb39b6d75a06ULL, 0x776dcb9d05025110ULL, 0x2ad617fd083fe77dULL, 0x8b538d9ff0ff7fd8ULL, },
+      { 0xbac283581c0c64c4ULL, 0x622ff47382bf90ccULL, 0x4588a45dec2c3cf0ULL, 0xe36d84a35e2f649cULL, 0xc3a8f8301e2b4206ULL, 0xabbb1b5ccd67abc2ULL, 0xcd08a989ef9605daULL, 0x488a1169dfb19b39ULL, 0x9f2c1a984561fa53ULL, 0xb9951f351d5463e3ULL, },
+      { 0xcc54a77a1a6acdbfULL, 0x64b4508a1412fdc3ULL, 0x0fcc7b7c99e416c6ULL, 0x31ebbb92e536dc52ULL, 0xb7406b96f854046bULL, 0x448b2c4202b50777ULL, 0xeab00089dab96bbdULL, 0x0d13eef4f43cae06ULL, 0x4383820ec4364157ULL, 0xf7321261d9fed8c7ULL, },
+      { 0xe9887dc3d450d505ULL, 0x08cf00bfd11be75aULL, 0x928d135b25af5c06ULL, 0x7740ca3eb8d9702aULL, 0xade4dbcfe4a72140ULL, 0xe061586bcbfa7c41ULL, 0x4fb97dbaaae43039ULL, 0xf6ee769cff803f9aULL, 0xff44aacc927d4b23ULL, 0xa4a1ceb7f46f5c50ULL, },
+      { 0x11ff0743253c2747ULL, 0x45ebc8bd4fc80af4ULL, 0x0ab7cbe3c7c1f7cfULL, 0x7a4749088563692cULL, 0x781f5a86d329b2ebULL, 0xc255ee88cb3420e9ULL, 0x74e156060ccc878eULL, 0x8aaf10d423950e05ULL, 0x163dad04efdc0896ULL, 0xdb4a25587fb97449ULL, },
+      { 0x3f87bdb8bb3419b4ULL, 0x86afcf8790abe2f7ULL, 0x3e4ad3e3a6dd4150ULL, 0xd31b1d6ee119f83cULL, 0xd5e2cdd40ca46194ULL, 0x22dcdb0d1bf7d91eULL, 0x001683e66d43083aULL, 0xcf17b7c8e57b9e67ULL, 0xa8e3f75ffc83bb7fULL, 0x920bf56fbfad622dULL, },
+      { 0x9025d92d014ea24dULL, 0x90a159b76619c583ULL, 0x759be9f376da336fULL, 0xc5254612110e2464ULL, 0x73a81eac6850ec2bULL, 0x9dd4f96f5dfe13d7ULL, 0x88a67aa5aa78841aULL, 0x76644e33b8140389ULL, 0x99d5bd7601b445a4ULL, 0xc288b2ff10e12c58ULL, },
+      { 0x0db6c7ec2aba424aULL, 0x43e3e1693301e5f3ULL, 0xed9e9057f4301b98ULL, 0x5c5a4ef5f76ac45dULL, 0x798dd14213c972ffULL, 0x58bfeb4488ef2576ULL, 0x8832770822be0efdULL, 0x26e50729796f6f14ULL, 0xcab34b527ef38df7ULL, 0x818f39782b2330b5ULL, },
+      { 0x3285c5b04561d5a9ULL, 0xfd33d1da8a119c1bULL, 0xa05bd822e97de617ULL, 0xc481e73c6fd21b38ULL, 0xf17683131697de11ULL, 0xc71e63df1436a2f7ULL, 0x65e285efecf928d0ULL, 0x1b8d8faae1eaeb03ULL, 0xc726dee126f5f98cULL, 0xac92b02bcdd91a8bULL, },
+      { 0x24796eda5fd325a3ULL, 0xa6a36ab52e3083cdULL, 0x721dd60fd4c3b10bULL, 0x034d9a0a62276366ULL, 0x5e22fd66e5aa8c0fULL, 0x47f629a7c94c6871ULL, 0xbd520fe3dae3d413ULL, 0x3a7fa2fad0bc5ba7ULL, 0x225540edeefc1b89ULL, 0xe5ddf0882495a848ULL, },
+      { 0xf32b69e992612544ULL, 0x37d684dc830e905dULL, 0x524fe0777a8f3bacULL, 0xd0f79705c37128a6ULL, 0x9e60f6818480875eULL, 0x34d15fc43fdf5f22ULL, 0x2dda05c5c3a205f8ULL, 0xb7b8bbfe2bd09dc4ULL, 0x464ba4f695b19397ULL, 0x991758db758eabb2ULL, },
+      { 0xedcaf8f254f08d3dULL, 0x7c2e871fdbc537fcULL, 0x867fc2fc44ae3660ULL, 0x16bdc951bcc5a928ULL, 0x6b2bab0b45cb97dbULL, 0xa936d10dbe554d35ULL, 0x437db701ca0df55dULL, 0x627613579066aaabULL, 0x71fa79da362b92f9ULL, 0xcbeacf3cbe05d93cULL, },
+      { 0x2d225db621b5260dULL, 0x4c4589e48782fde8ULL, 0x31fd15a8681214bbULL, 0xe28a690089286131ULL, 0x2ec04c17b4df171fULL, 0x7d8d53c7d737f674ULL, 0x1cb1bfdd168adf30ULL, 0x15a1dc66ea48d3e8ULL, 0x30df40768abb464dULL, 0x87cf07294f6165e3ULL, },
+      { 0x23264269dcf8165eULL, 0x1f9bb61597d5d293ULL, 0x7b706b15ccc22e89ULL, 0x29c20ace1b2cd107ULL, 0xd7063d55fc536e47ULL, 0x42ad6b79a0e4eb51ULL, 0x670358a17b3b97a1ULL, 0x2b6bf8da6ceccfaaULL, 0xb20f63f3d070efd9ULL, 0xb4e59faef8d26d96ULL, },
+      { 0x79ec8ed9911ec963ULL, 0x7da27f585444960aULL, 0x0adb6ae3b5b69e95ULL, 0xdd9b6de44b644301ULL, 0x643daf4f63f8c75bULL, 0x231e228e156c04d9ULL, 0xace308518ca688bdULL, 0x3dd0bc736c508277ULL, 0x457e53336b7a7256ULL, 0xf0f4579ebf698db2ULL, },
+      { 0xa19efe0488723591ULL, 0x428e6600593c8b9dULL, 0xb42aff9707d3fae6ULL, 0xe8a1a1c882ed6276ULL, 0x20a73f7e10e4c763ULL, 0x843c6d7dd9123a59ULL, 0x15ff3fc2a1dfc6e4ULL, 0xd86d309db0f82402ULL, 0xb183fac3c6352fd6ULL, 0xa079b88fabeff946ULL, },
+      { 0xca5b0930fbdb2810ULL, 0x33d2b7860c4bbeccULL, 0xd197ffbe3f155dc1ULL, 0x16ee8c5d38e57ffbULL, 0xd4ef4fa401720389ULL, 0x666c7e4c481cb28aULL, 0x23ab37b4f2b4f38aULL, 0x11bb5d1d4fc8f196ULL, 0x3a213db1b8f78973ULL, 0xd5c0c8cb6b5e36dfULL, },
+      { 0xc0cbf15d6945b6f3ULL, 0x90b3c0d7888cebd1ULL, 0x23352d6884338ae5ULL, 0x1733623bf9410124ULL, 0x9e453c4dceeaaf74ULL, 0x33d0f777bc4ccba2ULL, 0xc4dd5b36ed58bdd4ULL, 0x0f8545e3c5deb495ULL, 0xb15ea57cc5157534ULL, 0x8e5bff43f9aae14cULL, },
+      { 0x1c42489dff659bd4ULL, 0x6eee7c8d25107a75ULL, 0x235b8566a34efe84ULL, 0xd6e39fe4b1f3a80fULL, 0xcb4c99331cdfaf54ULL, 0x1c3e4bd307a0bb37ULL, 0xed7e365031152037ULL, 0xe63d4b76f09961a7ULL, 0x3aecb50c68d74512ULL, 0xbd9f580a4d40d0b0ULL, },
+      { 0x3fcc363b761782c9ULL, 0x1b9b9cb1d1749672ULL, 0xde73dbe7af56f7c5ULL, 0x9b4b27cd3ef1447aULL, 0x506073fec9bd8eeaULL, 0x7ac6ea9ce6f97d34ULL, 0x8e20880711a99a79ULL, 0x3e9da01ae87d8089ULL, 0x6578c2e5043333dfULL, 0xfc93a75fa4df4aa8ULL, },
+      { 0x31607580b700c8d3ULL, 0x2bfa1813eec43e9fULL, 0xf6c962aad88aee51ULL, 0x4dda9b983f3de4adULL, 0x67c461534172cddcULL, 0x3c7380f4cfa202d8ULL, 0xd4e6b199776cf73eULL, 0x4ff385e3621f3ac0ULL, 0xaa1bdf44cc6f1f9eULL, 0xa83746a5afd66971ULL, },
+      { 0x49fee1ea672f96ffULL, 0x84e089a55bbcca1fULL, 0xfb3a3c6c697e7500ULL, 0x9f1222c4e41315b0ULL, 0xede7dff8efe2a504ULL, 0x254311e470046349ULL, 0x071092cbe2cbb693ULL, 0x7ed37ddded7859d6ULL, 0x2ca81531bc7c600aULL, 0xe010365dc056c17eULL, },
+      { 0x05643619b49d31e5ULL, 0xcdded54c50abe053ULL, 0x7f67757587ef1771ULL, 0xb6d34c8be5fe2b95ULL, 0xc6a1e2684c270adfULL, 0x268f60a51fb0de26ULL, 0x95c9c30fd042ecd8ULL, 0x172507b8fa338af4ULL, 0xd8bad2e43650e8c7ULL, 0x9539daa01ff04892ULL, },
+      { 0x0bef864bfbc45839ULL, 0xa52b5e1e4bd84584ULL, 0xb9b7983f292e1b59ULL, 0xb2a68e8a60972535ULL, 0x98537900ed41c2e2ULL, 0xa7624eaece8a67b7ULL, 0x26d0b50ba144a25fULL, 0xdd301c781786b5e2ULL, 0xace5561305f883e5ULL, 0xc6c4ce6d6f0b85b5ULL, },
+      { 0x582e7f1762d2e310ULL, 0x0c26c312d32b7659ULL, 0x1e21056b6c5d2c78ULL, 0x7b4fbd1013dcbc0cULL, 0x559fee83ea0145e9ULL, 0xbd0637a58172dcc5ULL, 0x2da93d86a1127600ULL, 0xea8438f6cb3b7b89ULL, 0x9f6276830eb400d0ULL, 0x84613d2c4cb7dd84ULL, },
+      { 0xd9143212d0ac5a0bULL, 0x2d84b3a6a690f165ULL, 0x87e01d6a586fe6a3ULL, 0x050d1b370a8b9a01ULL, 0xa027c54acc447038ULL, 0x101659c69fe57a32ULL, 0xf68979c0825b0975ULL, 0x690d080b45383d29ULL, 0xe84862f6d228cac6ULL, 0xb0546905cddeb146ULL, },
+      { 0xab7a614463b14438ULL, 0xe5b91e01c91f8996ULL, 0x133e4f64d81b9eb4ULL, 0x1ebd95c7f24f7ae1ULL, 0x9400d9dd636fd22cULL, 0xe9f70799a276ec8cULL, 0xbfb6f9aa58d60e17ULL, 0x977f3e81b0afcf43ULL, 0x7ad81b74e3fc8448ULL, 0xeadef3a8af18c39cULL, },
+      { 0xff0c1f4ee9159273ULL, 0x973e89f5368b6bf0ULL, 0x1a219e43e70590b4ULL, 0xaa693a0db433383fULL, 0x58f172af3f680619ULL, 0x46f7e46d6391aed6ULL, 0xb97564f60e87070bULL, 0x8e40e0d914f21c42ULL, 0x8b6bf0027125b23dULL, 0x9c6c800b748159aeULL, },
+      { 0xd40929f59db4b3b7ULL, 0xfef4c41c202b1213ULL, 0xcfcdc69debaba8f2ULL, 0xbc5faf1e51597c23ULL, 0xf33513d5ece37307ULL, 0x2f11eaa3bc7a5b52ULL, 0xc96e09fcba6b2c6eULL, 0xc23d95cdf83b9c16ULL, 0xb909ab42ed5b8049ULL, 0xd05b353ff2e908e4ULL, },
+      { 0xc9c6f0f0afda0685ULL, 0x0d7a2679f607fdb8ULL, 0xdfd43fdec4d8be29ULL, 0xfe5e842d2a75df77ULL, 0x7220db9bbc4fbd55ULL, 0xde244b3f76bbe318ULL, 0x42039ff5c1014b56ULL, 0xf39062f6e33696caULL, 0xeb268978b3c5ec09ULL, 0x8ac3de5130aa85caULL, },
+      { 0x02e314479a9d1b52ULL, 0x0703e028bb4d7845ULL, 0xbb9e5f8ec9886ef0ULL, 0xffe9c27e143dc2a9ULL, 0x1876005af6efa18bULL, 0x1a29f86c2138b9fdULL, 0xed3491e867b318b7ULL, 0x538a30f4bfe56662ULL, 0x456e9e094283bb25ULL, 0xb8d5bbe70e108517ULL, },
+      { 0xf42ae24ded317f23ULL, 0xbc1a5c7d1da80134ULL, 0x6e8a1ff3e3c59fa5ULL, 0x4591fb34e72f64e6ULL, 0x4129d80087704213ULL, 0x4b7f787e4563b417ULL, 0x06327d06d5168228ULL, 0x5abd79818b19cb35ULL, 0x501c2ef471379a44ULL, 0xf63324b794576d8eULL, },
+      { 0x026b8cd545e7bad9ULL, 0xfd0154d0e163a88eULL, 0x17c00af67801eadfULL, 0x13010ab918e98879ULL, 0x8ebff93750232e52ULL, 0x2752b492d607275dULL, 0x8e5729ec75c8705aULL, 0xe4c9da74d539499aULL, 0x36520ebfd24986fdULL, 0xa3f80680e9a4423fULL, },
+      { 0x3bf8dd0e5986615dULL, 0xb157408a288c574bULL, 0x788b753eb8e9164dULL, 0x25cd1dc6c9e99606ULL, 0xd7e121b4402db949ULL, 0x4ae07c4e4f5a3c77ULL, 0x36dd6f9ba15dbeb3ULL, 0x1072a66bb40fc679ULL, 0x8ffba43f92e3186aULL, 0xda67ff154bdfe0f9ULL, },
+      { 0x2f7c79c68b2e5812ULL, 0xe3d994573dfb7b2fULL, 0x7d0c3a149f71cfbbULL, 0x6b702ab89039215cULL, 0x5a46b89d646856c8ULL, 0x707e5c45880a6202ULL, 0xb8d8524f53b96691ULL, 0x4828b0ae4a40c63aULL, 0xbf5f8129cbd10287ULL, 0x917557e7d2c49e94ULL, },
+      { 0xd822611428575e4fULL, 0x3c53c5297f84d9b1ULL, 0x0200ec1926eeabf2ULL, 0x9aa1f09b698fd4dbULL, 0x9ae9b046cd843db5ULL, 0x3b1e0e2326867175ULL, 0x3f3b4395768cf951ULL, 0x7daedc2eb97458fdULL, 0x067b1b7972101a45ULL, 0xc1c0146dcb247ab6ULL, },
+      { 0xeccb81bb416e23daULL, 0xca98c254c4154b04ULL, 0x9058e0ae7643bedbULL, 0x9ec9b32532afaea6ULL, 0x4807e783bf96caaeULL, 0xcff710b3c5643a89ULL, 0x680a4936996fc633ULL, 0xdefd094887f7bc41ULL, 0x14018ba3ae154465ULL, 0x81099cb4b894ef5dULL, },
+      { 0x8819d019b7ecd55aULL, 0xc2a9842759d6f17eULL, 0xd7da6cf36b7670fcULL, 0xe26ca1bf83b83272ULL, 0xf15d285e554b4bf2ULL, 0x46c6647c4a0c71d3ULL, 0x7e112ab60ad20323ULL, 0x32fc599b34f58080ULL, 0xd3917ea3f3cf6e47ULL, 0xabe0b77b94da450aULL, },
+      { 0x887f13a71e9c8bdcULL, 0x8332724adec2be2eULL, 0xd85d304e0772f04eULL, 0x8603c6a944713c2bULL, 0x6a72524eaa9827e8ULL, 0x96570a1ec94feaddULL, 0xe3773cee10a604b3ULL, 0x7f30eaaf8ae7d838ULL, 0xb6e85941d090e599ULL, 0xe4f0e1c52efe4137ULL, },
+      { 0x65306eeebe9c4ff6ULL, 0x5e9537cc652f383cULL, 0xdfec11457ca2a65aULL, 0x87e6daf97c43ccfaULL, 0x59fee814372b8d64ULL, 0x4b346358bcb3b86eULL, 0xdcc7c3d8d309aa56ULL, 0xf365efa2e7f3ace3ULL, 0xdb68138d8d6dfc05ULL, 0x9879778634f686b4ULL, },
+      { 0x13c2109e9af3128aULL, 0x8d7f38d109521e64ULL, 0x38e14156a3823475ULL, 0x1cd0ec4818fa7d4bULL, 0x79f6af23bf79559eULL, 0x4cba5de56dc41dfeULL, 0x2ed7123c0762c9eeULL, 0xe56bac2d00285c0cULL, 0x0d6f61dc3725299dULL, 0xcb18836aa242f5feULL, },
+      { 0x43d56540502c4580ULL, 0xb567b23714bc5b3eULL, 0xc1fa6a106084ee87ULL, 0x797f5b6f6b86fcabULL, 0x40d6b6f4dfcdad02ULL, 0xee987af774fe39bbULL, 0x22abe521117a68a6ULL, 0x3cef37cae3ee889fULL, 0x5e08af5910730fbfULL, 0x8742f88c9d3c54d0ULL, },
+      { 0xc7ff99568459f56eULL, 0xdeac3330cb76c55cULL, 0xe4466e1f4137bf00ULL, 0x5bbc0d952fcec537ULL, 0x4ce57020b7ce40ccULL, 0xf98c19ebb98ce182ULL, 0xcbd83c0b728a39eeULL, 0x404ac7648a16b265ULL, 0x5d9456ec0b0a2ad3ULL, 0xb42b116643d4a4c3ULL, },
+      { 0xfcb69b852ad7bb3fULL, 0xc0fc2faf31ac2f2fULL, 0x8d67d74dc1e1f9e9ULL, 0xa07a04078b731f20ULL, 0x653f2b943ac8e876ULL, 0x1225e718daef841dULL, 0x5576c8bac379570eULL, 0x9437397e4b85aca9ULL, 0xbbee9237dad76a3aULL, 0xeffbd9aa2f839798ULL, },
+      { 0xa3b52eaa11be199aULL, 0x023add9d2c4b2eecULL, 0x466e4e6a79447cb0ULL, 0x4b45565456a3e61fULL, 0xaec003fdfbef80ddULL, 0x53d4f384f3bcabe4ULL, 0x772b5020a674c3d7ULL, 0x3e864d9620effa4dULL, 0xe62865a82d75f1dcULL, 0x9fd439b8362619ffULL, },
+      { 0x47a6b3a994434649ULL, 0xea3adc4d2578f9dfULL, 0x989a5c599f353711ULL, 0x82cf91e73cfd457cULL, 0x343f7e562fd40ef9ULL, 0xca15da7cdd7c0e90ULL, 0xad029e194c080e47ULL, 0x6c6b01f361b865ccULL, 0x0b8cc7a0b24de000ULL, 0xd4e4583b4aa39a37ULL, },
+      { 0xf540aeafbaf7335eULL, 0x41ca4170a4d38688ULL, 0xa15d03e202f5fc65ULL, 0x2813c1cec4b0f17fULL, 0x44c8d7c4fafa4519ULL, 0x964ace972ff90774ULL, 0x2c1f1232dfa98b6aULL, 0x28666b8c81058fa9ULL, 0xfedaf4534aeff206ULL, 0x8dc92f39a90025deULL, },
+      { 0xa4d8b141c578f7e2ULL, 0x1036d09ca0073699ULL, 0x7db5eae7298de282ULL, 0x735fe7c36c454f2aULL, 0xd2dce862e2b0386aULL, 0x002035fac7288cb8ULL, 0x0a7a2de78c124328ULL, 0x406fac9dc2310e38ULL, 0xc8676da7eebe8b03ULL, 0xbcdbca29256a9199ULL, },
+      { 0x4e673eb5d66a5724ULL, 0xaee2e1b3207031b8ULL, 0x9f463278d6b67111ULL, 0xf433af68b1c45eabULL, 0x82e08b1ef5d996e1ULL, 0xc70b5d719e421af3ULL, 0x08668a8d95ec06deULL, 0x3287b4d423b261e9ULL, 0xd7a843d21fa7f2dfULL, 0xfb8f2d086b6e978cULL, },
+      { 0x4e80622cdb69810aULL, 0xaaf9d3ccac686144ULL, 0xf33901fd7edf46d5ULL, 0xec47b16e2e1d92baULL, 0x010a46b279b0d098ULL, 0x23a275afcb852a52ULL, 0x52e33e0aa74bff6aULL, 0x35bcaaba794277c7ULL, 0x80f4184b7fedfe3eULL, 0xa789cc4370708a84ULL, },
+      { 0x245f0abad1aedf5dULL, 0xfb14c07bd7244a41ULL, 0xbe3cf265a125c072ULL, 0xc7dceb82d1ee0dc7ULL, 0x553bb01a3cbb613cULL, 0xbbc79f7526954399ULL, 0xdb23772786e4af13ULL, 0xf8afc55480cd78d4ULL, 0x32162dde3b67bea2ULL, 0xdf2923cef7b89554ULL, },
+      { 0x1d31ec0c7d271865ULL, 0xfa7a9c9d40110fb9ULL, 0x90bbd31ebf1469f7ULL, 0xd82503204fa398e0ULL, 0x7b4014de090a1facULL, 0x9d8c813cd8b0c6b2ULL, 0xaf02de6e8bc74a58ULL, 0xf979d0bb30cc03d5ULL, 0xd5fd736c0956d331ULL, 0x949ff5bd2b49a551ULL, },
+      { 0x355870b2076fb96eULL, 0x13e5f5e2f2cd381aULL, 0x494fabe37d55f9d1ULL, 0x05ff81bb563fc526ULL, 0x65cbb725175476d7ULL, 0xa3e080bc7f2a86f3ULL, 0xf9dd7728af879109ULL, 0xed5b7fda51607a98ULL, 0xbda6faef0e216042ULL, 0xc5f7d1d6f9f7ef7bULL, },
+      { 0x2c45d553ae797997ULL, 0x0dd65f60795ba496ULL, 0xd0d0565c191ca2eeULL, 0x6d0d1e60797a445dULL, 0x9ef4f12c112909b6ULL, 0x13b8bf455e46366eULL, 0x4bb8452b3752144aULL, 0x1fff97f4c24daab4ULL, 0x481bcc0e9953a3c0ULL, 0x83d8b7cf1b92f824ULL, },
+      { 0x08b0d5e71a1aaa5eULL, 0x621018c46f1d872cULL, 0x07f85bf6c9aa5150ULL, 0xd32919e2da88941dULL, 0x275b6d55e52bb9b6ULL, 0x2fe4357156f973c5ULL, 0xf2bc88e0661831f4ULL, 0x4fa34bd426a1ab38ULL, 0xf1e2108b88b75547ULL, 0xaf9e90870fa63543ULL, },
+      { 0x1dfe2c4e2a1fd68aULL, 0x6b8e89397907915dULL, 0xeb9a9efd4d9e6d07ULL, 0x21cad4feba45c340ULL, 0x1842666b71bee674ULL, 0x0b650b97dca07688ULL, 0x3c93e2e0fe0368eeULL, 0x76e8224216588313ULL, 0xf9566950033955f7ULL, 0xe9ecbbcffcc2d702ULL, },
+      { 0xeb3e3067038a3461ULL, 0x96935535104fa33aULL, 0x93e91a22fbcc8b0dULL, 0x3795cf2fa8420212ULL, 0xa4962bd2c498564bULL, 0x5a0b567a1f17af4eULL, 0xd925b2b4faca8d2bULL, 0x02816ae32e2d9b4bULL, 0xa3a18d21040b0424ULL, 0x9bcb2edeca165e6fULL, },
+      { 0x77638860be8390c7ULL, 0xc331dcfcfef8e75fULL, 0xc2632cbf5742617cULL, 0x583ff377534d4eaeULL, 0x4a1cc55d6104e574ULL, 0x2bb4360100d7fcaaULL, 0xa339fc48285cbbb5ULL, 0x6cbe0e005a7cc091ULL, 0x16b7783798460542ULL, 0xcf84557b5076eaf6ULL, },
+      { 0x1d3b06594f8fd0a5ULL, 0x9d2201ba67c62da1ULL, 0xab4a579f7da64c95ULL, 0x4e91202a587aebb4ULL, 0x04a9736e55f29678ULL, 0x9165731ba7bc4884ULL, 0xd63bb5b2b09982fcULL, 0x1fff1aa6e8e261b1ULL, 0xa588c90162decef5ULL, 0x8a34c330676749dfULL, },
+      { 0xce73cdf40991a68fULL, 0x4c4350a4f63155b4ULL, 0x4d1422d86a53599eULL, 0x67524c7f7838da86ULL, 0x3c9c2684d8adaf98ULL, 0xa4165529b2398baaULL, 0xa4eccd4a98d2ca80ULL, 0x0433bd7928491ef8ULL, 0xe93a7ff66519ed6eULL, 0xb8171df8f95f18e5ULL, },
+      { 0x6cb92ce53073d8eeULL, 0x69753311a52fa563ULL, 0x9dcaf7064d2d1a15ULL, 0x917c30ed5beea86bULL, 0xf8dfb53f1a5319d5ULL, 0x4e5a905609925cb5ULL, 0x09628ec1647cf84eULL, 0x767236c879dcd88fULL, 0x44d073a560a5e22dULL, 0xf5353df47dd75e8bULL, },
+      { 0x9064e8adde845ab6ULL, 0x8d458383fd4277c0ULL, 0xb164bd1c013511fbULL, 0x1170266144a1d527ULL, 0x9294030c2fc3b82dULL, 0xc6cb0623f18ddda7ULL, 0xc43380353318e4c4ULL, 0xeb0e32ea5d581f78ULL, 0x5c9d14c5b6a13bb5ULL, 0xa34eed61bc4b1ff9ULL, },
+      { 0xeddff5c3600498dbULL, 0xee8cf7290ce77a0cULL, 0xfd7b1c7700eddd40ULL, 0xdc43411943b307d5ULL, 0x4628bee7c8b0d71aULL, 0x354824302cb9572cULL, 0x6e7ad89a55416d56ULL, 0xeef183849aee88f7ULL, 0x5d1d4fd85b05f4c2ULL, 0xd986c20b686da869ULL, },
+      { 0x89de42d3534e34beULL, 0x6007ad0c6732a5e1ULL, 0x7931e2b7577a5ef3ULL, 0xa66f7c0e63f2466eULL, 0xd02f7656b2ffbbabULL, 0x17a436d02e7174f9ULL, 0xd390ac3f6ea531b5ULL, 0xc691a9b9ce754c6dULL, 0x0cd9706b0dd8c534ULL, 0x90df55b39672e80aULL, },
+      { 0x92e314e7c98a9458ULL, 0xb0af4b5736e50817ULL, 0x9845008cd06cb6abULL, 0xb7781e0c33704bd1ULL, 0x59647b6a03225bddULL, 0x3478addf02c2bc17ULL, 0xb66b4ae36686bea7ULL, 0x4a5b7c51ec4fa58eULL, 0xa5cc46e5bdb1491fULL, 0xc0f844c1b0af3720ULL, },
+      { 0x5e04f46631880ca6ULL, 0x17944a4e1bec4b79ULL, 0x5aa8e73857e1289dULL, 0x1fe08c50a93c4e98ULL, 0x9e1f5c26f65a40fdULL, 0x46b7a37450cafeaeULL, 0xcbe82325aca1a395ULL, 0xf4ba452b9b6c475aULL, 0xc8d3214c535bce9aULL, 0x808489bc08472359ULL, },
+      { 0x9f11ef8effc9d335ULL, 0x4aae42dbdc91dd3eULL, 0x219639e20f93e8e4ULL, 0x191637c7a38a6376ULL, 0xdc368b1ef82ce45bULL, 0xc023398ac3d52f1fULL, 0x2ad3408e9e80932bULL, 0x9687d6323d708e5fULL, 0xc2f29c2da72a8c6aULL, 0xab2f76554779611dULL, },
+      { 0xf843e30972973332ULL, 0x883ab91bc6436b0aULL, 0x64a0e12022fddfccULL, 0x78361b36f1ba8254ULL, 0xcae24d033085b53cULL, 0x2cb408f489eeb885ULL, 0xd2913583ce72a8e3ULL, 0x394ac3f772fda7c1ULL, 0xf8262a092a54b73aULL, 0xe404c77b64789006ULL, },
+      { 0x6057eeead4ba317dULL, 0x2a296bf953fcf308ULL, 0x414961b7503c302eULL, 0xc79c63bf9fef4e43ULL, 0x3fe133f881abe1beULL, 0x9e77190c0937c89dULL, 0x337e2e53d0623650ULL, 0x0cc29f5bd83b5668ULL, 0xe763d110debfab53ULL, 0x97dc39029ff6db68ULL, },
+      { 0x0a87203bc0090e7bULL, 0x65fe18520677cfd2ULL, 0xaf5340ca6c2abf9eULL, 0x59e5b08d91cbf7c3ULL, 0x49670b283358f5e2ULL, 0xd1a72bc3393ca18aULL, 0xb1e2f47598ca9fc9ULL, 0xbb85c7277a7a8607ULL, 0x9551433f5c7dcce2ULL, 0xca47107870f87f9aULL, },
+      { 0x8682306f5b8ea5a5ULL, 0x94bd35905e58add0ULL, 0xda9d91c72240b81aULL, 0x79685d1473ed717eULL, 0x481766756c227be1ULL, 0x0413cd170faee5b0ULL, 0x63bff1a5f4876c54ULL, 0xb9643e928cb287dfULL, 0xf113d18b979eb696ULL, 0x86b77a6022eb58e8ULL, },
+      { 0x8a77ea2d84a01253ULL, 0x4f54c42185d1995bULL, 0x80fb62ca6e76e072ULL, 0x412db13310440498ULL, 0xf9d7cd156bd4cc1fULL, 0x6a84aac633903030ULL, 0x271c2ff622f449a9ULL, 0x306a310e783fe8e7ULL, 0xf5c9f98c56c9f477ULL, 0xb3714381d1bd71a2ULL, },
+      { 0x8370c51d750593b7ULL, 0x949c34e8efa5d294ULL, 0x0e7ea4b38eea028bULL, 0x0eefb6f54851d02bULL, 0x068377cd36d4d05bULL, 0xb11707ca8a886b2bULL, 0x3ce390a65d171274ULL, 0xbe1c03223e3867eaULL, 0x43769bca3ffdff15ULL, 0xef045bf98ddc002dULL, },
+      { 0x1ff59622013c9508ULL, 0xe0bf91cf0927fe00ULL, 0x0699e3cff200163fULL, 0x6636aed71dae0db1ULL, 0x482d75f0d6c555ceULL, 0x76d798ce9ab09e8aULL, 0x9f855c9864e639d5ULL, 0x257261546827afabULL, 0xeddb8bd5b1dd7ed8ULL, 0x9f2f658cea3b24bcULL, },
+      { 0x1b4cd7d2dfcbfe00ULL, 0x438e6833a85a768aULL, 0x7532bb176a7732d5ULL, 0x189124858ff0fdfbULL, 0xff7e8041dc109029ULL, 0x8fc91a80c2e5fdd7ULL, 0x02153d19f88d6c20ULL, 0xd5304b26272e0447ULL, 0x00d22e620ec380f5ULL, 0xd408cb010da5d8e8ULL, },
+      { 0xf83936563c4e0ca8ULL, 0x1026511d8eff5f05ULL, 0x705e0822bfc5cb36ULL, 0xdb9b1a15ae0f4fb9ULL, 0xbfbf23d8340ec472ULL, 0x7e66fc9d7f272fc5ULL, 0xdc628f87c4589f17ULL, 0x2bfb20990dedb270ULL, 0xac63454249b771c8ULL, 0x8d36f6971766349cULL, },
+      { 0x2080e6371cb42095ULL, 0xc377c6bc26d4de2eULL, 0x84396dc4d0ab7b33ULL, 0xa93ffedff941ca3fULL, 0x7eae865931369909ULL, 0x6c7071725158a524ULL, 0x49245cf985eea6b7ULL, 0x4a0ad081b987938aULL, 0x41a8bcd577f7a7d8ULL, 0xbc1905f3e898cca2ULL, },
+      { 0xe4afcb62db752083ULL, 0x0304e690ad24cdafULL, 0x8381abb532fe6341ULL, 0x95ca0bb38c2ff45dULL, 0xddce234edee7e820ULL, 0x74f8c80dd18c3ba7ULL, 0x5d108da0223a3d5fULL, 0x842dc41b89ca32c7ULL, 0x31c0368ccb2c5757ULL, 0xfa8bbf517f29408aULL, },
+      { 0xbc5f7fd87ac90addULL, 0x9a57c17fb08da860ULL, 0xf22c3f4705668d3eULL, 0xb1e18621d364461aULL, 0x9834265791e1cf28ULL, 0x04e663ac16d51215ULL, 0x5e2d7403972f6f2bULL, 0x20305d0244e091baULL, 0x2de38123a1c3cffcULL, 0xa6dd04c8d2ce9fdeULL, },
+      { 0xb45a59b3394f9eabULL, 0xf90f7125dd5b62e4ULL, 0x9e0e0e74597380adULL, 0xca20f80c5390f1fbULL, 0xa575a3b4615c99cdULL, 0x78a2d1deaf37c1a9ULL, 0x825b397e11354a97ULL, 0xb171e37a76c65371ULL, 0x1463ef488d5226cbULL, 0xde42ff8d37cad87fULL, },
+      { 0x9dac37fd368ddd25ULL, 0xc4bb4a812e06cf83ULL, 0x64faca7ac512bd50ULL, 0xe37c6afdd4e40892ULL, 0xb3a4349ff1397879ULL, 0xe8a6b9c1bb8d6fbdULL, 0x982b64e953ac4e27ULL, 0x45efb05f20cf48b3ULL, 0x4b4de34e0ebc3e06ULL, 0x9406af8f83fd6265ULL, },
+      { 0xa51cb5b9c93cf7aeULL, 0x87c8c8f41e145817ULL, 0xabf0082fd583706eULL, 0xe4efe156455a87e8ULL, 0x1e669d31d0bd682cULL, 0x59cd74957d02432eULL, 0x1c0b623f2299cb95ULL, 0xa42303e570b87e7fULL, 0x9e98cb984f0d3050ULL, 0xc52ba8a6aeb15d92ULL, },
+      { 0x1f06d395e5306fddULL, 0x24dc168d21474978ULL, 0x3951d85b808d3dc7ULL, 0x87e7dbbc82a782caULL, 0x59e95d7c1dabfdc8ULL, 0xb3dc3b626e1758b1ULL, 0xf81e8a916ca9106bULL, 0xe8a94db92ca5841fULL, 0xe79e236bf8bf47a8ULL, 0x8350bf3c91575a87ULL, },
+      { 0x56f0bdf9e8a50002ULL, 0x2dc2d98026287a32ULL, 0x343b11091f631d80ULL, 0xe878e6ddeb2da0d2ULL, 0x6843bc8ae5f5ffdaULL, 0x49e83129b28a1c84ULL, 0xf73aec8b34d883c2ULL, 0xb7d1f78b317fae11ULL, 0xe3187c34500d9ab3ULL, 0xaee973911228abcaULL, },
+      { 0x9ee435a7355bf9e4ULL, 0x353f37bae5217a6fULL, 0x04e46874cbd174daULL, 0x0b676876a66dfdb3ULL, 0x5757dc0dd46c87c9ULL, 0xbc1a50909f029444ULL, 0x49ce2be1d65f0a25ULL, 0x5ad05b84c7c4be7dULL, 0x598eec7d41754c09ULL, 0xe8fb7dc2dec0a404ULL, },
+      { 0xc277ded869a4fd3cULL, 0x630dbf49901d80b1ULL, 0x89b995376b175418ULL, 0x518bcb756ca1f670ULL, 0xe7973a663836ffb6ULL, 0xf70b888660d34946ULL, 0xe752a5fb23fc74c4ULL, 0x660bdfd108ba7989ULL, 0xe393a9c032fb0c34ULL, 0x9b2a840f28a1638fULL, },
+      { 0x3b2d324c69a75d44ULL, 0xf05788d4fd98d935ULL, 0x9c8c0d9077ecce4dULL, 0x2cba0316ecf72da5ULL, 0x0583c8fe05b57dc3ULL, 0xddddc0dfbb0d6f2cULL, 0x71aad59046c74249ULL, 0x8263ca5cbc774bd9ULL, 0x492512d4f2ead2cbULL, 0xceae534f34362de4ULL, },
+      { 0xa6b84b64c841eba0ULL, 0x1a84512119d80feaULL, 0x285bd6313c8bb150ULL, 0x8fd47f719c1895fcULL, 0x9b315382c49275a4ULL, 0xa4ad1c1c7fdce9b9ULL, 0xb62593291c768919ULL, 0xc098e6ed0bfbd6f6ULL, 0x6c83ad1260ff20f4ULL, 0x89a63ba4c497b50eULL, },
+      { 0xbf0d37b3ff9afe50ULL, 0x088e1fc9bff8fefdULL, 0xb2cad04dd8d5f898ULL, 0x3f1c86229394796bULL, 0xbc32d0857fdd4186ULL, 0x3480fcf7dd9707e2ULL, 0xfad3d6bb39dfd932ULL, 0x0fd924be26af7592ULL, 0x68e1eb75340122d4ULL, 0xb759449f52a711b2ULL, },
+      { 0x4878d516829c25deULL, 0x586b3d63fc392403ULL, 0x2ee8efa581891320ULL, 0x171edeb23e0e8127ULL, 0x5eabddc580bbf51cULL, 0xada80215bc062c1bULL, 0xcd5140f638d331b3ULL, 0xddee7f83569c8b33ULL, 0x1f4bf6653cd3b977ULL, 0xf4385d0975edbabeULL, },
+      { 0x790c0220e8f0ea8aULL, 0xf904a16e256d8390ULL, 0x64822d873d4584f7ULL, 0x791d963cf9e43fbcULL, 0x62702807d10d8cfaULL, 0x5191a70f9e339aa9ULL, 0xc0eaff3755a2ddcdULL, 0xf53e94d1b2357c32ULL, 0x87a601586bd3f698ULL, 0xa2a682a5da57c0bdULL, },
+      { 0x6ee9918eb6ac8cecULL, 0xa8841c3bf52e17a8ULL, 0x696b3c695df185b9ULL, 0xb19b7d79e6b3e8deULL, 0x2d841994d48af09dULL, 0xf7a7ba9898b3b1f2ULL, 0x39f87391a061c7ddULL, 0x4d0525af79e132c3ULL, 0x5ae1b25946117390ULL, 0xd8a66d4a505de96bULL, },
+      { 0x0e42132539a47d37ULL, 0x0c1ec3eb3e8e0a80ULL, 0xe83184600e906d64ULL, 0x47d7c1375d35bafbULL, 0xe0e47572dfadea99ULL, 0xfefde89b01e51068ULL, 0xd4c94a9da0693e0cULL, 0xe7317d62209b6a93ULL, 0x7132d332e3f204d4ULL, 0x9049ee32db23d21cULL, },
+      { 0x231bb409bd2f7b29ULL, 0x4e21885de07dff83ULL, 0x46e7e44227c7792aULL, 0x996c8440ac86a8a5ULL, 0x55f3dff45e1bdf17ULL, 0x7a730e52e6e74360ULL, 0x9b03537708b1648fULL, 0xa23e2ed27766e8ccULL, 0xfa911155fefb5308ULL, 0xc0314325637a1939ULL, },
+      { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8000000000000000ULL, },
+      { 0xcf80200000000000ULL, 0x33ee57da70eb7305ULL, 0xca18c242a5f0fb1bULL, 0xbb01f9e94dce0d7bULL, 0xccd604d64e2ddab2ULL, 0x5a6b43a2a6c495b8ULL, 0xae780c7fea81c788ULL, 0x851e4cbf3de2f98aULL, 0xddbb901b98feeab7ULL, 0xaa7eebfb9df9de8dULL, },
+      { 0x9994e2bd75fd1f6dULL, 0x261fe034af3fe38aULL, 0x07cafb1af42d48c9ULL, 0x549d5d6f25948477ULL, 0x74a24bbae09b3399ULL, 0x0b9a1d7d634df2d8ULL, 0x422d38ea3584cde4ULL, 0x9c6583981d134cbaULL, 0xcc655c54bc5058f8ULL, 0xe319a0aea60e91c6ULL, },
+      { 0x22c4f7ef1410dd3fULL, 0xccec040ff24f6fa5ULL, 0x8a2c7dc42b346b54ULL, 0xfef8bcb0c43b216fULL, 0x4d963d164f347476ULL, 0x790955debadbbb83ULL, 0x7ced4bde6b367155ULL, 0xb0d7ba426777344dULL, 0x6c8d3fca02ca6de6ULL, 0x973f9ca8cd00a68cULL, },
+      { 0x5480643ee80d7eaaULL, 0x52a22f1246e7f13bULL, 0xd78016e010459004ULL, 0x8187a351927d3cc8ULL, 0x4a9cf154d24daa37ULL, 0x253069a5c329f9afULL, 0xd6f4b6d27bd1c61cULL, 0x526b988275249b0fULL, 0x650d3d28f18b50ceULL, 0xc976758681750c17ULL, },
+      { 0x149804b61dbfe5b4ULL, 0x86b301109a28bfe9ULL, 0x58eff7386e4eea7aULL, 0x1cb381df8e7e2622ULL, 0x6b25772eade5ee2fULL, 0xc7b2ab3e451b3e08ULL, 0xb8a89f2441e0083fULL, 0xecff2e2c1eae9db9ULL, 0x085bccd5c05ee9f9ULL, 0x862c8c0eeb856ecbULL, },
+      { 0x0157956afb989611ULL, 0xdbfe8b9393886628ULL, 0xa07379c0587acc1dULL, 0xd4b542cc135042aaULL, 0x9195f5f997a43a58ULL, 0x4f0cb5b821dad78eULL, 0x0badb504e5728cb4ULL, 0x7704bd1bb5a5802fULL, 0x4257ac3b4c1d7794ULL, 0xb2b8353b3993a7e4ULL, },
+      { 0x4fc52d4b5b4ce371ULL, 0x617997431210a4bdULL, 0xfe3fb916652e0ea7ULL, 0x0340fef6cda9aac2ULL, 0x3b94889af844b2a9ULL, 0xa0f174e327921d03ULL, 0xbf34ff7963028cd9ULL, 0xc20578fa3851488bULL, 0x2d4070f33b21ab7bULL, 0xee0ddd84924ab88cULL, },
+      { 0x53b7d77cd8c6be71ULL, 0x836230af908b40a7ULL, 0x22771e50f30278c9ULL, 0x928e61d08e2d6942ULL, 0x1b93cf2ee5ca6f7eULL, 0x8b21c11eb962b1b6ULL, 0x77154ce2bcba1964ULL, 0x6a3197bbebe3034fULL, 0xa74d28ce329ace52ULL, 0x9e8b3b5dc53d5de4ULL, },
+      { 0xe82a41b49794afc4ULL, 0xe879ea0cb27607d5ULL, 0x403d1bfa69d447f8ULL, 0x3d0b8a1ac065b10bULL, 0x971cf7fbcef2c146ULL, 0x1bfedf3a72c6fcc2ULL, 0xe701f7bc8d1a0383ULL, 0x03baa2f38e35464fULL, 0x3f50c802040f4cccULL, 0xd32e203241f4806fULL, },
+      { 0xc6ddd033112087a4ULL, 0xdda94df29edef223ULL, 0x8a55b99cf816eb7cULL, 0x0e41e7377dd46166ULL, 0xcb8136603ca815e1ULL, 0x3a3c029775f0bbc7ULL, 0x126d388625960d50ULL, 0xaef839a8a7f6a14cULL, 0x5dfed09922680a06ULL, 0x8ca554c020a1f0a6ULL, },
+      { 0x73f9caec97937031ULL, 0xf28fb9585f592f3fULL, 0xd0f00ece6f23dd06ULL, 0x30462982e79bf63cULL, 0x8749f1268da70ca6ULL, 0x242a31e92e389631ULL, 0x10e980a1c0ccfd83ULL, 0x6fc5802cde0b3272ULL, 0x4c808753bb22fef8ULL, 0xbb570a9a9bd977ccULL, },
+      { 0x11b36604956f5b40ULL, 0x58ec2b1ebf794e0eULL, 0xeab7718da969d570ULL, 0x5150cddcf00c895aULL, 0x21b71cc33d5d6448ULL, 0x79b6709cee8b1b63ULL, 0x7c9361e0fab6d091ULL, 0xf02c90b784b4227aULL, 0xfdd08c4da13655ecULL, 0xf9895d25d88b5a8aULL, },
+      { 0x8c996111a8aa5128ULL, 0xb6eee50ab59b6cd1ULL, 0x50d2bfe0dc5c3215ULL, 0x406c0514f25a42c2ULL, 0xaa9627d4a07c3e08ULL, 0x693038e326f394eeULL, 0x0c7a3cbe3d82a042ULL, 0xfca81f202c5d111aULL, 0x50e3660235410f98ULL, 0xa630ef7d5699fe45ULL, },
+      { 0xeed099677c8c97c3ULL, 0xfbbf6452718931b9ULL, 0x631ed48d70d801eeULL, 0x0a1b88af8dfd3a15ULL, 0x358359813545ec85ULL, 0x3ac56bdd8342772eULL, 0x134ca67a679b84aeULL, 0x8909e424a112a3cdULL, 0x95aa118ec1d08317ULL, 0xdd5dc8a2bf27f3f7ULL, },
+      { 0x6e7a0b0afc4c8e67ULL, 0x0d123c9d47dd7191ULL, 0x2cbdb50d6afc4886ULL, 0x5734bf6db3ed5bc7ULL, 0x4b8cc1062c2a172aULL, 0x708c8a72ef8d8fd4ULL, 0x6f75529546ee8b59ULL, 0xd2fea4fd957ea18eULL, 0x8c474bb609f40287ULL, 0x936e07737dc64f6dULL, },
+      { 0x50376d8dc86bf968ULL, 0x427aba16a9ee9d72ULL, 0x8092c808df0f983aULL, 0x2db0d164ea315c84ULL, 0xea38aac7e917a569ULL, 0xfff0d1d2e18469b1ULL, 0xdd5cf7c945f22a3fULL, 0x65761fb2444e2267ULL, 0xc94c153f804a4a92ULL, 0xc46052028a20979aULL, },
+      { 0x90ef0d7f5de2d222ULL, 0xb740d2690b91ffcdULL, 0x8f2f23d976c120b8ULL, 0x9a4b98aeb80dd9bfULL, 0xed8213e1a40d3fa7ULL, 0x530b8fb029a2fbd7ULL, 0x772939f73369efc2ULL, 0x538567bfbe0b117aULL, 0x6e6c12aa02b9a1ecULL, 0x82c952e37be11cb4ULL, },
+      { 0xf59bbf9146b89ef8ULL, 0xfa0e317da8986604ULL, 0xdb084a6784dbb915ULL, 0xf53497c7ef917890ULL, 0x22e6c855b8c44fbbULL, 0x8067c40f1c692f3dULL, 0x68d759e7a3fff997ULL, 0x5a43d43795f92ea2ULL, 0x7ef5f8c1b3a0771cULL, 0xae3511626ed559f0ULL, },
+      { 0xda8e692abdaf1ae5ULL, 0x16c7741eeb53dec2ULL, 0x6f43d5baecc19f7eULL, 0xf1ae47dcc762a30fULL, 0xf730674cc379fdb5ULL, 0x7b302f7ea6fb3ed2ULL, 0x14989be4222dd137ULL, 0xe72af3faf80453ceULL, 0xa6a99ee15afede53ULL, 0xe80b387fb9146d6cULL, },
+      { 0x8ddfc10d855f42fbULL, 0x7a92dd9693943511ULL, 0x7cc17bb790c2c7ccULL, 0xfc50835ae2985044ULL, 0x68a97e9c455dca71ULL, 0x5a9f068667b0e097ULL, 0xcfaa6d78e5e39523ULL, 0x2fe1131ff8085857ULL, 0xd485d0ed8a3fa8c1ULL, 0x9a8a7ef0fed3ab22ULL, },
+      { 0xe5d682525a93600fULL, 0x01b5f0c696573ec1ULL, 0x07a7de4e9471dd6fULL, 0xfab7564b02eaac15ULL, 0x56b8e23961d5aa1eULL, 0x02ef236bf894ab04ULL, 0xe1996d0c1cdcf9c3ULL, 0x86752f4a96adf95eULL, 0x0d9d3049b2a0cd21ULL, 0xcdd92dd7170ae5e5ULL, },
+      { 0xd03d45a5ced6751eULL, 0x8ead4bbde06c898dULL, 0x9e064fda259e7367ULL, 0xbe63b6cceac29a49ULL, 0x5a61ebf7fd343994ULL, 0x1484192ba5154bc8ULL, 0x99bac10f8861138cULL, 0x74406583c63e4dacULL, 0xc280eca418909592ULL, 0x8918471615361460ULL, },
+      { 0x5a345c18a9df6119ULL, 0x0e24030512fb2033ULL, 0x9fa13f3ccc934709ULL, 0xf0d2129fb653a4daULL, 0x906095339b3e504cULL, 0xd96c0195b2670bc0ULL, 0xfc86e27c0bf3dfaeULL, 0x363e72b00ae0f17bULL, 0xdf874de552fc5789ULL, 0xb69c2f0f5f3a0b54ULL, },
+      { 0xe1dc533d062dec70ULL, 0x99768f97ca13b5aeULL, 0xde892206933d187cULL, 0x4dac5cab4d896797ULL, 0x057ed77e2b0440aeULL, 0x913eedfd51a29391ULL, 0x4984be52e26b0f7bULL, 0x966f387895e13e43ULL, 0xd9bff7621230c809ULL, 0xf33c80e873a56036ULL, },
+      { 0x19e7ee4f3c3d4d28ULL, 0x9d55845c277aac7aULL, 0xac30f627b50a0333ULL, 0x6fbe1fd22795e3ccULL, 0x714c2a9bc817f045ULL, 0x45aed00d8fd1b199ULL, 0xc06838864934fbd6ULL, 0x0d594dc6f3d6c26cULL, 0x2ddf440204f6bb30ULL, 0xa1fec5996bf607b9ULL, },
+      { 0xabe422501b92c2feULL, 0xfc707056ca867dfaULL, 0xd644b3e9ab78832fULL, 0xf04156f0897c7b32ULL, 0x4d72070fccf29c15ULL, 0x6b69982573ccaef4ULL, 0xda580f93e9fe4022ULL, 0x355aa2dd78c73d3fULL, 0xeeb19b86645e5bb2ULL, 0xd7c6ffe276b6e924ULL, },
+      { 0x4a7cd147d3eb6d6bULL, 0x9ae30a4c96c451f8ULL, 0xd3e2d91008e309ffULL, 0x0633d0d2a1d1ab5fULL, 0xd53090a12e156208ULL, 0xe00364340279494cULL, 0x57e8fea2ce51e5eeULL, 0x34ccebf541338ed4ULL, 0x7f84c551e6b97575ULL, 0x8fb520c6167551f0ULL, },
+      { 0xdf4e0f5b47086afbULL, 0xf0bb899e4ed332efULL, 0x488c655be5df2a4fULL, 0x325cdb257c1aef3dULL, 0x8013ff7881b73c52ULL, 0xe856b534e4b06be7ULL, 0x3dcee9ea5e97b0f6ULL, 0x5c25d4fc4f03c04aULL, 0xa4caa35c124b70f0ULL, 0xbf6b0ec461889065ULL, },
+      { 0xb9915af30cd1cdc1ULL, 0x7770526cd4263283ULL, 0x3cf4b1077caa5055ULL, 0x416351ed0ce5295bULL, 0x2a17afb699a91d2eULL, 0x9188121dd9a3d260ULL, 0x4d34c3142fd17e5aULL, 0xcd4746b82fc55874ULL, 0x8c9a8bf67a3ab7b1ULL, 0xfef7fde63023dd8eULL, },
+      { 0x8c9e908fc35d1f65ULL, 0x9b2f07a3077bb743ULL, 0xc2793ba84736bde7ULL, 0xab9e657423d55a51ULL, 0x86a68f276743e56cULL, 0x9366900c31ea30ebULL, 0xe1c25d9fc629b971ULL, 0x300c1344a6573d58ULL, 0x4f1a16fffe5058c0ULL, 0xa9cf17b213d2b53eULL, },
+      { 0xfc12ea81d8959e91ULL, 0xad19af2770ddd19dULL, 0xe3f80a37f8a48913ULL, 0x6fb1ddc15d1a546aULL, 0x9e51a5da140da032ULL, 0xf5a64fabedaac224ULL, 0xbab0e49d4a0ba8a1ULL, 0x12e619e678ed5c35ULL, 0xc870ab059985efbeULL, 0xe22f6c63d8cc42e4ULL, },
+      { 0x479adb9c174df73fULL, 0x441cd8b0460d2abfULL, 0x35fbdab262df61c0ULL, 0xd54759925092b445ULL, 0x0c3f77471b93102aULL, 0x98ab274a132284c8ULL, 0x412e0901a7bb6c7dULL, 0x072b211aceb5055eULL, 0x0c7c2892305f4e12ULL, 0x96a3a1d17faf211aULL, },
+      { 0xd9e6961a1c063e38ULL, 0x55a771261f4b7095ULL, 0xc343c4361cc4f73bULL, 0xec03c3654367b360ULL, 0x18066c2cb3ff8259ULL, 0xd48b6f256d88ace4ULL, 0x13fb80b2d5662ec4ULL, 0x3de8049523b663aaULL, 0x986bf9a7f18d688eULL, 0xc8a6b1b611aefe4dULL, },
+      { 0x0a7e480922797cb9ULL, 0x67bd1d73fe7c12cfULL, 0x709dc501f7ff834eULL, 0xeffe0e4760cf72feULL, 0xf5eb255288d96aa0ULL, 0x70822e0e2b6a4a4aULL, 0x49479e220bf0ea13ULL, 0xa80db96e84e62995ULL, 0xee137dd7c7b17cdeULL, 0x85a22d049bbf5c4eULL, },
+      { 0xe34b817f8fb753b7ULL, 0x263e5bde0c362476ULL, 0xb4f818099472eedbULL, 0x5b7e2643bfbdc9beULL, 0x14cb36db255878b4ULL, 0x7c6f32fbf3277b8aULL, 0xd273419ef080d206ULL, 0xc1e74d371fa35515ULL, 0x0ad343f9eb902de5ULL, 0xb1ffe5ccdefbfcffULL, },
+      { 0x9a061aecb2091368ULL, 0xa07ddba3db85e224ULL, 0xf6accce5e50b4d37ULL, 0xc1b7636d722e1fffULL, 0x64d6b872c0da07deULL, 0xa8d6cb07fbf8ffc2ULL, 0xe97f1ccf9c74e69bULL, 0xdde301e2817bc264ULL, 0x16e3902f4d4ce3a0ULL, 0xed185d4405344657ULL, },
+      { 0xfdecb1b5dd08fe0eULL, 0xc5d8d66b67234a19ULL, 0xcb4b8318c64e75e6ULL, 0x5444aca67b3bd4f0ULL, 0xa86985d2058ca312ULL, 0x34375a29d67072c0ULL, 0xb41c8c215b2b69efULL, 0x1ca4ee06caf98972ULL, 0x7de583e3da8891deULL, 0x9de7ba7b79bf84ecULL, },
+      { 0xf408737d26d25017ULL, 0x00e4059ab23f7c5dULL, 0x447cfccd88cdf48cULL, 0x389803f7276161ecULL, 0x65a665759c8ca518ULL, 0xf39b2b8f5beca46eULL, 0x350bc1ede3f2bbefULL, 0xfdfdf9833c33e44fULL, 0x6d5c650bfebae672ULL, 0xd25456e566e70ec8ULL, },
+      { 0xf0ecc2a9ad4d87ffULL, 0x15e8015b73384632ULL, 0xe16af33cad7e8957ULL, 0x6f7d8d301926155eULL, 0x3aa914844d0b7759ULL, 0x40e902c72ad0b6f9ULL, 0x231bf2f3e7f0f214ULL, 0x0cc25ec2ceab3a4eULL, 0x459b28e4b662e96cULL, 0x8c144919417ee219ULL, },
+      { 0xd8032d0c3b8f5611ULL, 0xc01e106bf08a86d5ULL, 0x406f4be24b772de7ULL, 0x0743a6f1a0f05fdeULL, 0x419374b183c7ea63ULL, 0x50de7326606e3c73ULL, 0x2047b07b0a34f3ecULL, 0xdcb7e937cbb264b1ULL, 0x207c0183d51541f3ULL, 0xba95d74e1ab707a3ULL, },
+      { 0x3610083b31c27300ULL, 0xd467f031ced6eaaaULL, 0x145a6c1a4132bf5aULL, 0xb51d17869cc6e02fULL, 0x51fb0b799f355619ULL, 0xf8f48f6caa694e7fULL, 0x5715ba277e15b77dULL, 0xf732fd745b2b9915ULL, 0xe70e5c19f5d779a2ULL, 0xf88805718dc30081ULL, },
+      { 0xba2cc4f86e675015ULL, 0xca5c6a4a657e4b37ULL, 0x8065a06d0a38c4a5ULL, 0x0afc4205240d6951ULL, 0x0ec91870b9a12f62ULL, 0xd95db01c2aa26c59ULL, 0xf343e13262c283cdULL, 0x9e946641bc556b08ULL, 0x2152771df2d247fbULL, 0xa5858ba939c1d77cULL, },
+      { 0xd2e6df606a12b75bULL, 0x28b39508f442fe66ULL, 0xfc9cc31622934dd3ULL, 0xe961fcb13faee7b6ULL, 0xfceca86380f53d14ULL, 0xdfb8f4b7015a234bULL, 0xd64821f728926f6eULL, 0x614db178df4ee8dfULL, 0x70475a872c10a078ULL, 0xdc797e1ac9dbc5c4ULL, },
+      { 0x571845cf8422c290ULL, 0xac5f194f45d1dcfbULL, 0xabd1cfd5e29919baULL, 0xd5757256a9ef36ceULL, 0xf229e3def93b801aULL, 0x5abfa44f1339f08bULL, 0x75fea6baa5a8b4acULL, 0x24d10cd43e037606ULL, 0x115b197ad9ab0a69ULL, 0x92d5fcc6152a3b3eULL, },
+      { 0x1cb9e108838c8572ULL, 0xc80c055610dc59aeULL, 0x64c2983ac24d5c04ULL, 0xfb3ab12d5a588354ULL, 0xf0fc22fa1b4d6c3dULL, 0x76d83f9a37dae221ULL, 0x1d3dfb9818c95f4fULL, 0x58916d85dd5ffe93ULL, 0x5981cb2f25afe34cULL, 0xc395cd116a035f28ULL, },
+      { 0x2fcfff566cec8154ULL, 0x35c25285495d63b3ULL, 0x3118cde502e21391ULL, 0xdba40dfff3fe8683ULL, 0x2d49f5cfb5096045ULL, 0xc646f4b92a6ea17dULL, 0xce1d6fe41146e0c1ULL, 0xbe3c4355cb264040ULL, 0x19a76f4102cd61d2ULL, 0x824272333ec93cbeULL, },
+      { 0x717a290fb981c12bULL, 0x0703e385b067fd72ULL, 0xa760b5e40687a418ULL, 0x4faf484d7da6de29ULL, 0xf04db243eb0e2ee2ULL, 0x9466a9b9a3e9bd18ULL, 0xbddca75597e25f61ULL, 0xde0856c28f2e48aeULL, 0x78f0feab3c0e2d6fULL, 0xad81693a868ee057ULL, },
+      { 0x9ab8499898740bc4ULL, 0x2bc8031d684f6245ULL, 0xfd9fb1c765034708ULL, 0xf439b4397d07a68cULL, 0x42573763d591e9c5ULL, 0xe298bdb9061e3c52ULL, 0xa6fe0558e756761fULL, 0x490a041d597a77caULL, 0x6b4bbe113a53ef59ULL, 0xe71beb05f96b70e4ULL, },
+      { 0xdb9d42adf94e9661ULL, 0x38b4c7b1c1ef3aa1ULL, 0x0aec0818c8cc1139ULL, 0xc5bc5512d4e16599ULL, 0x82aa0a9efe641109ULL, 0x0c915efb53d327e5ULL, 0xc5979de24818df5cULL, 0xdfd1d02625d13c1eULL, 0xf7c905a69bf37dc9ULL, 0x99eb1ed96c4db8deULL, },
+      { 0xbb50da23e4e0d1ddULL, 0x9ad4fa65dba7fa27ULL, 0x0fc03edc3c844b53ULL, 0x83c86ee7cf5b10fdULL, 0x50a907f057a1fcceULL, 0x04a200eb8618a52fULL, 0x7227b9322b61d426ULL, 0xfba1ef01ab4235e5ULL, 0x41535adf2c861302ULL, 0xcd04e42f5d865c12ULL, },
+      { 0x60d9cb2e11dd0b42ULL, 0x19f8db2d85fb1a23ULL, 0xfe12fb697247a11bULL, 0x135fd9c485e572b9ULL, 0xa62e5d38ce095301ULL, 0x08baead11a83cbcbULL, 0xbb0e85a40bd35ff6ULL, 0x037652d8dbd675bcULL, 0x5332178cb1f42f5bULL, 0x888ae4ecc332927fULL, },
+      { 0x6289e24110d2ece0ULL, 0xb7b46aa8c4db9697ULL, 0xe870bf25daa88a93ULL, 0x5137b3bf06a0e48cULL, 0xae802ad9c4676abfULL, 0x54781b5cb24cdcb8ULL, 0x8c5553c1684aa09dULL, 0xb3ca7e4dacec1e0dULL, 0xe487e851f6c974f4ULL, 0xb5dfdc7f357bcf62ULL, },
+      { 0xc3c4a21e8545cb25ULL, 0xe6a0ce9beb333a65ULL, 0x3a63bca66015573cULL, 0x556927f9182e71d2ULL, 0xbc2d4ec463995ebbULL, 0x750cc368309eb8b0ULL, 0x1ebac25fe536ff84ULL, 0xc0ede685084e213fULL, 0x798a22726717559aULL, 0xf241a8848484a11cULL, },
+      { 0xf66e20c6de06e9bcULL, 0x68a6eaf5c9cb1826ULL, 0x4467fe2eb74ec4daULL, 0xc24c022cd6c31a2dULL, 0xc86fc486209a1f1bULL, 0x25517bc55bb7926aULL, 0x4069f2ee5750ee47ULL, 0x35a4579ac2be3094ULL, 0x40f3cbe09c853780ULL, 0xa157b58952c9e4a9ULL, },
+      { 0x83d96301b6d4c8e1ULL, 0x60f5ca7a3d89de68ULL, 0xf99306dc782e2f7aULL, 0x35f67e76e047c8f9ULL, 0x3f4346982f5a1a18ULL, 0x229921b07e013ae4ULL, 0x938d935fe06a6735ULL, 0xc2c5b8d990023d95ULL, 0x68398b318265c56aULL, 0xd6e878e5458a4585ULL, },
+      { 0xc3d752f55dd7cfbaULL, 0xabd09a3bee2ff167ULL, 0x2d0ccd04e58b66bcULL, 0x7de482b47860ba8cULL, 0x297bd82caf7f6e87ULL, 0xed2ed76e954d156fULL, 0x1d3788f2a3f15bffULL, 0x17be0e3f66d36227ULL, 0xceef211936bf3d6cULL, 0x8f20ecce628d60f0ULL, },
+      { 0x41597012033293f3ULL, 0x1bb7b84a4ca3a31dULL, 0x45709f612e08a315ULL, 0x01eabd3043a594d5ULL, 0x4b8a2b41346f9048ULL, 0x88afcd9693ddff8bULL, 0xc3ec126ef3370026ULL, 0x1e1de43b5c17121cULL, 0x9c6001c8c973bb0eULL, 0xbea5a6cb0405d6edULL, },
+      { 0xd1cb2c201d9459c2ULL, 0xd123a5361b66b781ULL, 0x984990ae9089fc54ULL, 0xeb3e54867f7a01d8ULL, 0x74fc1bed33a48b6bULL, 0xf380ca92cb6126f0ULL, 0xf5a71abcb84e2265ULL, 0xce9abee7dcb96b02ULL, 0xd581562117f8e330ULL, 0xfdf10c10b588dafdULL, },
+      { 0x650a105a2f29e824ULL, 0x23a21be079d83e69ULL, 0xf542086bbccd3d5eULL, 0x11671ef6e93bf0d7ULL, 0x382e2f8c199e4f29ULL, 0xbf71bb4c790d8184ULL, 0xf520f0f26f8b1e98ULL, 0x85b825e9789b4a46ULL, 0xb4af7b34f9180973ULL, 0xa91ff8bce6e5166dULL, },
+      { 0xe9523d0da0e5285aULL, 0xc134b852619ef7edULL, 0x30279432a8f292d7ULL, 0xfe18ecb2481e302eULL, 0x04fbd16c155efa22ULL, 0x9d9f5d2e3362c76dULL, 0x926fb33c175b326dULL, 0xce8600a4c98ddfddULL, 0x9ca51f81f4ec5014ULL, 0xe14629a0e4b37af9ULL, },
+      { 0xc73443fa2909f18bULL, 0x8ce581d41a46e95cULL, 0x7f98031d76f0fcb2ULL, 0xdcb226ab9d2baff4ULL, 0x782c6521c371fdd3ULL, 0x0fed77ab5ad39a06ULL, 0xbe3db2aa6a0c895fULL, 0xf7ea3918ae24b70fULL, 0x1f5b0da954305bbfULL, 0x960847d628152b4fULL, },
+      { 0xb692c9e1451076e9ULL, 0xbc7f45757f93c4c5ULL, 0x04469ebd25929af8ULL, 0x1f67fe6ec0f643e1ULL, 0x6e5a6cbba871337bULL, 0x139b607c35e1ac65ULL, 0x16c48193d206089dULL, 0x22d7772568018a02ULL, 0x3feea14386e83251ULL, 0xc7d7c4294556a6faULL, },
+      { 0x57680fe951e86d02ULL, 0x3ca09a456fb5b2d0ULL, 0x37b4d7bcd9259d4bULL, 0x698b248bd14cc7e9ULL, 0x4d5abe6dc1c33728ULL, 0x9896ec41aa1b45ebULL, 0x4cc2ad86f45ada95ULL, 0x2a401295aacc094eULL, 0xdb9278960081ac9bULL, 0x85185cad714d448cULL, },
+      { 0x9c5cbbb6d014e5bcULL, 0xdf384b6dad804ce9ULL, 0xbf9b9037ac0f1c00ULL, 0x9984733ae85f4836ULL, 0x2b5b0598d235b819ULL, 0xa23cb61d4e761864ULL, 0x7c4f561e933c14d4ULL, 0xeea4a43b2888144aULL, 0x6226e1134dc6c888ULL, 0xb1485471f16603b5ULL, },
+      { 0x5bfb94b52bf0acdeULL, 0x71588c1c1c75be9dULL, 0xb648d60e5616e666ULL, 0x1588b95800fc64a6ULL, 0xdb21cded5970e040ULL, 0xf2fea3d741a60e20ULL, 0x5fe307cf204610b6ULL, 0x5cec6dc9f0a0cbddULL, 0x2cbe8f5547386c57ULL, 0xec23da31be70b07fULL, },
+      { 0x5a96312491fa5159ULL, 0x4e5fd483f6339167ULL, 0x3631862aacb078feULL, 0x48a6f02aaf6b02d5ULL, 0xf86a1bb75d0fa474ULL, 0x80cfc9c4fad00a50ULL, 0x1d5132d936ee2e52ULL, 0xd6572864da482690ULL, 0x2c7bfa9d3453097dULL, 0x9d44e2376f1da23cULL, },
+      { 0x78da1261d65fb478ULL, 0x3865244a55e616d6ULL, 0x2b9f4fb5b85f0f6aULL, 0xc7d7a8a2fa0ebaaeULL, 0x4f4c727ef53dae06ULL, 0x7b6c77f64183c491ULL, 0x6b10ff197514c8c8ULL, 0xb90af4b7d4c19f29ULL, 0xbf10473f22f21c7fULL, 0xd17b6e31eca39a41ULL, },
+      { 0xb4f76673d0d8f408ULL, 0xb4595bfdd13c86c5ULL, 0xaa4cbdf049aaa9cbULL, 0x9d8444d099a04e68ULL, 0x79309f2e1b32cc33ULL, 0x0d7052f7aac4e914ULL, 0x077eec55fd64a408ULL, 0x1ecc2143e4df3731ULL, 0xb4eaf8d471994482ULL, 0x8b83d307972925e2ULL, },
+      { 0xa5bfba8869d1fb11ULL, 0xb87b268313543f89ULL, 0x72867657f9a65bfdULL, 0xa275a46611dfd333ULL, 0xd604af17aa972458ULL, 0x1b038548e54844b3ULL, 0xa7d7f362c9a9c7f0ULL, 0x991ba3f487d197d5ULL, 0x70c2dd8cb19bc205ULL, 0xb9d56b40165b3d15ULL, },
+      { 0x4af2b627e91d89a3ULL, 0x1292f95cfbc467e3ULL, 0x75243ec86339bdb2ULL, 0x056e5ff0a93799c1ULL, 0xf00730fa77a816faULL, 0x0c822da97c4486c9ULL, 0x57e475a982cd3099ULL, 0x8b19ec965a6c2a00ULL, 0x4f0a6f1951bdbc0bULL, 0xf787b721d189b17bULL, },
+      { 0x5f8adc653c232a65ULL, 0xa28485ebf15e0265ULL, 0xd68f73703ffc91a1ULL, 0x4beb7622d2f56736ULL, 0x6abe0b188162bf74ULL, 0xbf54f701bd4f8f7aULL, 0x25f3839e437a3082ULL, 0xa24dc5886ba154a7ULL, 0xcf76010ca0f8b16eULL, 0xa4dad89577b700a4ULL, },
+      { 0xa7f68c721da4ada5ULL, 0x942c6979b74ee1d0ULL, 0x37dbb5b7e51baf6bULL, 0xd3f5330574b6303bULL, 0x79cf21a0f9690df8ULL, 0x79182a970a5269a6ULL, 0xe1b8bcb2a8707828ULL, 0xe709e8590d543fb5ULL, 0x2fb15df42b3fc166ULL, 0xdb961f01905e41e5ULL, },
+      { 0xaa39df225bd25b51ULL, 0xc1c4b83b0d3c0df0ULL, 0x42cda492d046ab8aULL, 0x9abca058569f2ad5ULL, 0x4ba70f8390577df7ULL, 0x1755b6810d8c516cULL, 0x2504d747cae613c0ULL, 0x3900a3af8859ad8fULL, 0xb034645cfb8ddb70ULL, 0x923e8ee4eecbe123ULL, },
+      { 0xec12680e3efae124ULL, 0x4b7712d8996666a8ULL, 0x886fe40ce2771b5dULL, 0xd2b73d7442feeba8ULL, 0x923d0a135dbd0d25ULL, 0x613493321538ae3eULL, 0xa4c54afe4161eaabULL, 0xc1b464c06aa9e79fULL, 0xf49d6a3654be96b2ULL, 0xc2cc18fb0c049248ULL, },
+      { 0x4b7ea52bb6460a6aULL, 0xcb04326685b17b8cULL, 0x9a55d141cb6e4538ULL, 0x20e825b950d508e0ULL, 0x50187ef05dba664aULL, 0x3e580c778bd8b140ULL, 0xe80b3aa95bd51616ULL, 0x82eb02159175b7d2ULL, 0xa077334014f6514cULL, 0x81bc1c9bd2cb32c0ULL, },
+      { 0xf86eab0eeb82c435ULL, 0x2dfcec84a14142c7ULL, 0x4ad98552ce92b38fULL, 0x9fb2f760b351ec23ULL, 0x2714448b30ef5e8fULL, 0xd7a275a116491c6fULL, 0xc67cc7846f8d746dULL, 0x46268f57137f56a0ULL, 0x079f66cb1eb0297cULL, 0xacce7a5980dd8a97ULL, },
+      { 0x6abb57b9c72297edULL, 0x730dc20768f78155ULL, 0x06d8d082dd2e7094ULL, 0xd1e82f25433e42c1ULL, 0x066817616176b078ULL, 0x6f6c60c50a4f0598ULL, 0xc0a0f6b28f42d5a8ULL, 0x676d5b07713508b2ULL, 0xded666166a90399bULL, 0xe62d9456160bec6fULL, },
+      { 0x2d3c884a86ea1dc7ULL, 0xb9e2b4002ba506edULL, 0x8eabbcddb287b9dfULL, 0x120f32b9f5ec8513ULL, 0x5c159888f1d3e89fULL, 0xccf7075fd9262493ULL, 0x582adb0367955670ULL, 0x68f0c227ed2e84ebULL, 0x6121aa9d9d8618afULL, 0x994c631e40e8d9eeULL, },
+      { 0x9bf04ad74dc99bb5ULL, 0x66170b9571440db7ULL, 0xc06924215938575fULL, 0x68dfea0f8b85102eULL, 0x596919ecfef17bd0ULL, 0xc31bb5b91b9d5755ULL, 0xe40cd1c8843dcac6ULL, 0xa057e45c0bd0783eULL, 0x387361034614a920ULL, 0xcc31757556f401dcULL, },
+      { 0x363218aa0af0fad4ULL, 0x00965905fcf88890ULL, 0x7bd0dadf12854379ULL, 0x5cf1090fc8e64840ULL, 0x41123e7283fca933ULL, 0xca8560dc683c43bdULL, 0x0e15b5084bf4b535ULL, 0xcc375016bbe673afULL, 0xa83e5aee79414026ULL, 0x87fe1491d4d158dbULL, },
+      { 0xe4bd57d2eca01a7bULL, 0xb8e0721b1712b1a6ULL, 0x7fd6c7636f245b45ULL, 0x6cb93ee58a735990ULL, 0x525ebc478fe973c4ULL, 0x7ea127f8093c288bULL, 0xb34d6cbf626d6dc2ULL, 0x0e159f18eb8f93d6ULL, 0x273045916d2c17b6ULL, 0xb5244c25bc0ab8b9ULL, },
+      { 0x283d6e9f576dda62ULL, 0x43b0f589408f6270ULL, 0x196901aecabe3b7aULL, 0x71975c7c381f7c53ULL, 0x51281067f87b728aULL, 0xe24da3b2fdcffd9aULL, 0xd47d0afcbd26dd88ULL, 0x0472d034988f68bbULL, 0x4c5d3a8190991662ULL, 0xf147d2d1cb6e1214ULL, },
+      { 0xb88697f52b66d7a3ULL, 0x863f470fdb140464ULL, 0x8894f3bcf4d549faULL, 0xb15443a753bf1465ULL, 0x4f5e9166be46445cULL, 0x83a26d1289e5e947ULL, 0x30f437c7c00edc0bULL, 0x239b972fd05de0b3ULL, 0x96660e225702e92bULL, 0xa0b151c329300e87ULL, },
+      { 0xe1e8595cb0ba2825ULL, 0xace2edbc5a0f404aULL, 0x2beb9bb42162124dULL, 0xbb6ca0db26d1386aULL, 0x8301f18587ebd8f0ULL, 0x8a62cd761ee9d6d4ULL, 0xd2ba3bf6c4d4c426ULL, 0xb6885f6993ccc7f3ULL, 0x71cc4017a37fbc1fULL, 0xd60ad7651cf62f8bULL, },
+      { 0xa2653967794ef5c8ULL, 0x8e73f28ca21a6808ULL, 0xbcbd0818cbe177efULL, 0xe795fc162e6842b5ULL, 0x68716b7ad8b598c4ULL, 0x7f68086589c617e1ULL, 0x9742b13aa031a63eULL, 0x985b4d632ebc4162ULL, 0xeb7beb0c51a2bf3eULL, 0x8e8d51ad7d704f2fULL, },
+      { 0xeb02210674e72a21ULL, 0x5d5d6c3a98a402f6ULL, 0x200015a8cef19180ULL, 0x1a9a4f28a13cc9c9ULL, 0x0f7ba6d11dcfa22fULL, 0xe83c5f8958c2fb56ULL, 0x749982700c69dc5fULL, 0x00ad490c074b8ae9ULL, 0x8b292ab3624fc023ULL, 0xbde10a667e62ef2cULL, },
+      { 0x83d49eeb5272043dULL, 0x7ac88dd14a03c069ULL, 0xe6c776c575b1e71bULL, 0xd36a78d8840a7a29ULL, 0xf9b1b3cd28ed3930ULL, 0x4a3d2163d45fc9bbULL, 0xe0345345bee9f79eULL, 0xe26b4f89bd705795ULL, 0xc50ba87fb97e0936ULL, 0xfceb2966c77b10bcULL, },
+      { 0x17871a2a048d213aULL, 0xac0eb260bf6fdd2dULL, 0x53b04fdc3df0fd2bULL, 0x3bab8a28a5291829ULL, 0x1c998bef07dc965eULL, 0x1d5bf37392724499ULL, 0x63a1bf8c0ae89f79ULL, 0x3a34fe34ab0ad3a9ULL, 0x89952b0ccd6dc85fULL, 0xa8718e6116b3ed92ULL, },
+      { 0x892daf79ab557c9eULL, 0xdd7dd48900ae4e2dULL, 0xa3efd1d88f68fe07ULL, 0xf55f03cb23336815ULL, 0xd43594840008d2d9ULL, 0x898f62fae9d7bf88ULL, 0x780083d2603de2b8ULL, 0x0a567a12e9801239ULL, 0x08816b0fb38bcbd4ULL, 0xe05dd76cb3b0dd1fULL, },
+      { 0x02f8b2970505ff4cULL, 0xaf08b600fa927708ULL, 0x152a84cd3c6bddccULL, 0xf048b1606e0f15b1ULL, 0xcb28b8b995c69d13ULL, 0x3af30fb43c2f1f55ULL, 0x9a9962c730515f4eULL, 0xd429a4442795295aULL, 0xe413fa2ee362dfbbULL, 0x956d8e10e20b6fdcULL, },
+      { 0xcf6eefa39b70375dULL, 0x2bfe6450c70f6534ULL, 0xd6569c025611ad31ULL, 0xab7daf6941e8b1f0ULL, 0xfcfa42f0f40e9bd6ULL, 0x8080a6b42e71a661ULL, 0x6908c33091f88086ULL, 0x09c95de6d72ae224ULL, 0x702f97800532fa55ULL, 0xc709ac0324e95b1eULL, },
+      { 0x5025c46d193745bbULL, 0xaf34f5eeec7e267fULL, 0x0f477fc20e0c6464ULL, 0x04f9eccaf0242f23ULL, 0xa2e2204129bd0c5eULL, 0xe84aa9800511e045ULL, 0x653ee4140700c36dULL, 0x8f0f2f9cf81beaaeULL, 0x6381c30e830a9f4eULL, 0x848f1a764244df43ULL, },
+      { 0xe2701a1e27c2b5bcULL, 0x3051f41b1c3f86f7ULL, 0x1856a1ae09aba4b1ULL, 0x9270aa23ca4906c1ULL, 0x081a4a06b6694b2cULL, 0xb78a9a631f117e4fULL, 0x73d0fac0cf357596ULL, 0x20fd4d3f9834c52aULL, 0x4ff0c8a67ab611a2ULL, 0xb09180666b3a0133ULL, },
+      { 0xc3a82343f1cda5a4ULL, 0xeffec2dd7d0bec63ULL, 0x0c4795f047030721ULL, 0x1c769b81a249f2a3ULL, 0x1e28e6f8f318af35ULL, 0x35cd7f0314572999ULL, 0x63481d9dd98ce1d4ULL, 0x8ff0ddc809e7341aULL, 0x8a39cd0b9c326819ULL, 0xeb305348a4338dedULL, },
+      { 0x89e2e569982d9df9ULL, 0x39a88b1941c76afaULL, 0x7d8ae0d496e5fc91ULL, 0xac6f992a36bd89c9ULL, 0x384d1559a655cb84ULL, 0xe7f5b26729196d61ULL, 0xafb9363e69efb451ULL, 0x098907a8b3834c51ULL, 0xb670da942bf1169eULL, 0x9ca2b1e3c0c2961eULL, },
+      { 0x03957c584209163bULL, 0x4807ad81d1d78d15ULL, 0x14ac4fb819bdfae2ULL, 0xc1ea4223b50e090eULL, 0xfb7eb0dc8d6c14f8ULL, 0x2ce24cbbd79f2805ULL, 0xfff6114669695bf1ULL, 0xf76ad3e9813edbc4ULL, 0xfc49479a58428829ULL, 0xd0a3653033267a74ULL, },
+      { 0x527f30169c174213ULL, 0x7957936915ff3cf9ULL, 0x0dd1956eb6ad79e9ULL, 0x6662f0f824f94dfbULL, 0x5b357904dad46e93ULL, 0xbcc0dd8dfec7d53dULL, 0x90cdd0278223ff2dULL, 0xb80e844ad629508aULL, 0xb9f5167eaf41df16ULL, 0x8af3f1f0de8808d5ULL, },
+      { 0x0db250b691281a1cULL, 0x4cf8f18708dfea08ULL, 0x5b63a9a4754c6c58ULL, 0x69db1b76bd4b683cULL, 0x388ebf8f8d248b2cULL, 0x62ba1989b850d51eULL, 0x701cc48d92ccd152ULL, 0xa9b4ba6c7ba821b9ULL, 0xdce516f3263be0f6ULL, 0xb915c5a314b2d76dULL, },
+      { 0x020b686de0c5bf18ULL, 0x589d4c6389d39e0fULL, 0x210469cc3f207c3bULL, 0x6f214cc446ba206eULL, 0xc2d24a497a9bcb57ULL, 0xfbe1c9a5f191907aULL, 0xe2b46ddfdad29831ULL, 0x7bc7c275b4130620ULL, 0x4bbed412caf1c2dcULL, 0xf6887124f1fede88ULL, },
+      { 0x390f78bc0467467bULL, 0x4a5a732511aeaacdULL, 0xeb6c40c3a0ffaefcULL, 0x0e60d6a7923a5bf6ULL, 0x6db4b32108f41e94ULL, 0xbd1e35bd942e6535ULL, 0xe374dc7c9ff509acULL, 0xfbe226010f92a8f7ULL, 0xeab2c29e8271176eULL, 0xa430d58bc8a88302ULL, },
+      { 0xf2291e74e5637964ULL, 0x41d9a837b3e426c4ULL, 0x031ac6f3507ab105ULL, 0xef1db8abf66f283bULL, 0xd25029e17e683217ULL, 0xa51e0b49cd33b790ULL, 0x663df1563b48ea42ULL, 0x3e6af50015b24d79ULL, 0x3c2e5273eaf9d4aaULL, 0xdab3aa64468f20c9ULL, },
+      { 0xdb3ad9578fe86b10ULL, 0x9a67533e6608e7efULL, 0x1026e6373dbaae52ULL, 0x1700fe886a2c2944ULL, 0x9d4cd557d626490cULL, 0x0da9b16e9d80b9c7ULL, 0xdfe898c32541039fULL, 0x480f857b1d7d7f9cULL, 0x9163ce4a0ac33f42ULL, 0x91a7bd2e56bd89afULL, },
+      { 0x08f2e9eaf0437ee5ULL, 0x97209ba5f7f79208ULL, 0x374e401058f53423ULL, 0x069981abc486dc78ULL, 0x4ee429d358fd6269ULL, 0xf875b7b86f21329cULL, 0x70ec9deb636a9b6bULL, 0xf569ccb3a39f1eecULL, 0xfe1d062db4d90e7cULL, 0xc20334e80cd53d27ULL, },
+      { 0x07c411e67cb093d6ULL, 0xb707201c1d853201ULL, 0x20585c9e3c9b954dULL, 0xc7e8c18da7685b35ULL, 0x88bbfafe398c6dd3ULL, 0x9aa5a666597222dfULL, 0x093624c38bc7b0f7ULL, 0xa22b8b0799ada578ULL, 0x0de88ff2df93286bULL, 0x8136518dc52b2418ULL, },
+      { 0x044eb3fa7b134583ULL, 0x55fe90cdcdaf66b2ULL, 0xcaf0dfbf6fd39eacULL, 0x2c2f320f804bd0ccULL, 0x14960c6642dc4b54ULL, 0x971969fa05d1a3d0ULL, 0x996c7f43141c63cdULL, 0x0e195f05ee84217dULL, 0x45c0d0c721808d7fULL, 0xac1c44004b2272c1ULL, },
+      { 0x53737cab1327b5dfULL, 0x18922b6ab32d0bc2ULL, 0x72f5e2b98809da2cULL, 0x9ebbf41b8ce57de4ULL, 0xcbaf3bf6e448c7a5ULL, 0x840ef85919b8b5f3ULL, 0x705cbea49d875484ULL, 0x0d4cd394d9e7b8caULL, 0xa713710454c2c2ffULL, 0xe54033718cc43e7aULL, },
+      { 0x45ef5776d18fb254ULL, 0xd8240671857285e7ULL, 0xf22a6a62456960c7ULL, 0x253c259336d4991dULL, 0xa052a58ef66a3b48ULL, 0xb2aee17628c3db71ULL, 0x3cf231e86b0e79e2ULL, 0xf2456bd139667121ULL, 0xc16474694b70faf1ULL, 0x98ae4b15fc0168ecULL, },
+      { 0x005dbd34b6975d91ULL, 0x00d53632eef59443ULL, 0x2b43a84ac8072458ULL, 0x0e3cc548ab720d82ULL, 0xf65f49d444403841ULL, 0xfd25ae57cbf6db5cULL, 0x53d5810ffd92af2bULL, 0x085e266076ca34bcULL, 0x05e1a9b54ccfbe44ULL, 0xcb5ee0c73c675f23ULL, },
+      { 0x813bfe540300500dULL, 0x7250a00d6b57264eULL, 0xc79b1ca30a5c4683ULL, 0x7b42333da6ded3c2ULL, 0xfcfa74276235ff7cULL, 0x1a1cd1f034136dc3ULL, 0x7cd05cffc5024004ULL, 0x1af3c253a8235318ULL, 0xfefdd058400f7385ULL, 0x8771d56eec0957c8ULL, },
+      { 0x61ebe047771205a4ULL, 0xb5941fbcdf51f160ULL, 0x1bc221c707e5a4f8ULL, 0x07b2cba8ad27dee5ULL, 0x61c0894acba86796ULL, 0xdebe2598c69ac061ULL, 0x5260c5d0255d2b1cULL, 0x3f3870ecda123ee7ULL, 0x297e638e6a14821eULL, 0xb4697d3aa8e8f560ULL, },
+      { 0x955b5ab7e967ef95ULL, 0x56b7151adbd5f7a9ULL, 0xef324011eb4c40dfULL, 0xdabcee0a10761bc5ULL, 0x845802562aee1522ULL, 0xfeceedc700955ad4ULL, 0x563d8a4e4e5d1cbeULL, 0x1391401b334758feULL, 0xa64aec8bbdf52027ULL, 0xf04efec57f8280d6ULL, },
+      { 0xc7acc8ad35968637ULL, 0x1b749ffba8610529ULL, 0xa348053452ca01d4ULL, 0x3302174cf2ba5d9aULL, 0x44d2dfc06c54b37eULL, 0x814adc18d4b3221eULL, 0xe44037016fa02e90ULL, 0x2d73a7a9d47232ccULL, 0x5f2ee049577f3cd9ULL, 0xa00b9995417f8379ULL, },
+      { 0x8ccb3db16231bb29ULL, 0xab460c9461f2f536ULL, 0x4f049e4b26d57c30ULL, 0x0073391ae5aea649ULL, 0x61d98be7d751545cULL, 0x81b48091e3f0106aULL, 0x8c90871d273c8758ULL, 0x8236f77fd9be092dULL, 0x80650268771c3cedULL, 0xd52e1a755227ac48ULL, },
+      { 0x27baea68b9cff8c0ULL, 0x1e025a185dd089cdULL, 0x0eae7897e2f8d593ULL, 0x4dd258ac06fd21a2ULL, 0x7b25b5d0fd31c6bbULL, 0x08930f8e7286e99cULL, 0x50357da4967cd3feULL, 0x6d6fc9e1213d46d0ULL, 0xb67948e4610bec53ULL, 0x8dfa4ec5c857c4c6ULL, },
+      { 0x94cd57889edc15bfULL, 0xa7b22847b74d47f5ULL, 0xd23772535a834715ULL, 0x1a8c2fafb4dedcc1ULL, 0x70aaebbee9bd86afULL, 0xbb1d80aa092e7fa0ULL, 0xb9561420946b7f02ULL, 0xcf354c5efb99e4c2ULL, 0xee1ccbd7c5ac1200ULL, 0xbd1d38c4dd7589ccULL, },
+      { 0x6a7c61acc0095442ULL, 0x23236dcb7c822c4bULL, 0x7d1b228cdb40de4aULL, 0x9048fc93c2bdb4ceULL, 0xeb9ffff71b7f3554ULL, 0x6ae5d96398d0458fULL, 0x85d9293ce2b60866ULL, 0xd82054c6b92cc449ULL, 0x104b9c54bcdffa92ULL, 0xfbe654d0bed7dea2ULL, },
+      { 0x708473715a8881ecULL, 0x36755aeee5d60cceULL, 0x95aff6d40d855165ULL, 0x4eb9283a605b4bbfULL, 0x1051c31b5d0df690ULL, 0x6767e65760465164ULL, 0x429bcac9665b4326ULL, 0x80ed3da0b8039f18ULL, 0x53486f20ba23dd01ULL, 0xa7c3d7e4639c2ffcULL, },
+      { 0xc813a92cf713a8e8ULL, 0xd4ad6c446be7a67cULL, 0x56b54878a85b3658ULL, 0xcd4bab39435c7c3cULL, 0x35f1631c96e1b2dcULL, 0x8313531bcfecc63cULL, 0x578a1a7c079a4815ULL, 0xc14aa5bb1185375aULL, 0x269ec75ed6228c40ULL, 0xdf7674cf3091dbb0ULL, },
+      { 0xc605e042ebf48579ULL, 0xb62f4d78fd627bb5ULL, 0x56e71a608f8e8b2dULL, 0xbb6a78e11d2dec76ULL, 0x490eb8fb85bf0b72ULL, 0xb6a06f566d43a247ULL, 0x9e3bec6df3a28293ULL, 0xd6ca62e3cb9c3db8ULL, 0xdb6c3bb39575ad0dULL, 0x94d373dc747f3e86ULL, },
+      { 0xf8d37ee40c05d022ULL, 0x7862187935cce1c8ULL, 0x3a4f23eee2d23c56ULL, 0xfb1418dfd77ba796ULL, 0x6f1bed4551324717ULL, 0xc634cb6474b872f7ULL, 0xc4c8bb272f614ed9ULL, 0x3e8d84d7d904c703ULL, 0x2fe9c8c23142649fULL, 0xc63c68679cc57eb2ULL, },
+      { 0x3d8911e9610ddbeaULL, 0x8a263016d86af701ULL, 0x3d72ca9fa14b63eeULL, 0xab98c89199592b8cULL, 0xdb5b0248a71eaa8eULL, 0x1321397537ddd81eULL, 0x5b5780657d89da9eULL, 0x70889e823ae5ce91ULL, 0x05e4f8bb88bd48c0ULL, 0x840665cc7c8052f6ULL, },
+      { 0x17666cd92733e47eULL, 0x3a530bdcf8c21733ULL, 0x7069ffa60f71896dULL, 0x82d7e5f6907b662eULL, 0x89f59d654f4cbe05ULL, 0x1e07e9c68a0aa8b0ULL, 0x24dbe0bc3b693e99ULL, 0xc5f68a33bc087bbaULL, 0x6ac32952264ff110ULL, 0xafdb68e711079aecULL, },
+      { 0x0335070d449995a3ULL, 0x9ec9709c999976ceULL, 0x96f43dcf5a576068ULL, 0xe6abae89c7bcf81cULL, 0x57d92f3b08ab4c2cULL, 0xb801fcc5df4dd880ULL, 0xfa0c7a39ec770ffdULL, 0x2ceecd9059d4f11dULL, 0xc8836b23b3b65b25ULL, 0xea3dc784a9f534deULL, },
+      { 0xd4da123035141481ULL, 0xdb32c6a7ebe56d10ULL, 0xb3b31849e17261f8ULL, 0x980f6a654a095b15ULL, 0x525520a4695c9988ULL, 0x999eea8ea9753270ULL, 0xdf34354604a58fbbULL, 0x932588470596b909ULL, 0x7ff4e2ef400bbd40ULL, 0x9c0128d33d6e67f9ULL, },
+      { 0xddc1ab11b5373e5fULL, 0x6bd5d6306c734baaULL, 0x950a78186cf3e402ULL, 0xe6d677c784033c06ULL, 0x1075aa4c2e516850ULL, 0xcabf5e07ee91a9a0ULL, 0xf331e8dbe3672539ULL, 0x49245592672d0be0ULL, 0x4f8a03fe66fc2079ULL, 0xcfcc3af9894af15cULL, },
+      { 0xff1c1fa32702d26aULL, 0x5390f7c49fc62f2eULL, 0x9bf502caa1fefd84ULL, 0x577015ff1d44fedeULL, 0xa2007c2db9953da7ULL, 0xdab9b7bccd2fe0d7ULL, 0x59701a693c7208efULL, 0x4b2f347da4d6ab59ULL, 0x28d11d9658704ef6ULL, 0x8a64a53b73994d52ULL, },
+      { 0x3f215867d91c6660ULL, 0xf4ef1536535bf318ULL, 0xccb769d8ee77b411ULL, 0x6ed84bccbd1b00f3ULL, 0x959aad1bd006d4a8ULL, 0xc7e9c33095cde248ULL, 0xe97457d97c2fc6dcULL, 0x9f11f9f4c48f717bULL, 0xa846f85c47ae42c0ULL, 0xb856e5aa6f92297dULL, },
+      { 0x963c29b9655554e3ULL, 0xa48e089a8b707cbcULL, 0x4b807ea36d1934f3ULL, 0x3dd8ece4f5b52fd5ULL, 0x962356cdefe0ea0fULL, 0x26ff6a4c606cf3f9ULL, 0x00ba376f07afc6c5ULL, 0xa3a3210f13afdf93ULL, 0xb3c1068fdbaa558bULL, 0xf58a326a5783a749ULL, },
+      { 0xe7e68f185187c57fULL, 0xa0094e084b72a5f5ULL, 0x6a202b7fe14ad370ULL, 0x3ec5f07b5ac7c0f6ULL, 0xabf463cefae049c1ULL, 0x444f20fd124812a5ULL, 0xd4c703a9d0922f07ULL, 0x2f998ebec8f7a613ULL, 0x1ae7616f505f42caULL, 0xa38781d6a0c0f649ULL, },
+      { 0x7f6769098f162463ULL, 0x7e5bdb6f637dbc9eULL, 0x547d2babad9ddaa3ULL, 0x5b7b4c899149ad51ULL, 0x99715abe938cb9d4ULL, 0x1f740a63ff6ecee4ULL, 0x3d72ce1c7bfbea35ULL, 0x81a5309fb303983bULL, 0x1ead34dbc912bd53ULL, 0xd9d21f511ab29a3dULL, },
+      { 0x7c5887a972af28d5ULL, 0x00b1f083bf7e123bULL, 0x034c8d8cf52a4291ULL, 0xf332826362969dfaULL, 0x44e694308edf496dULL, 0x9ce66d64df27e6eaULL, 0x6bc2ef3466c7d0a3ULL, 0x70d52674ad0e15daULL, 0xc0f784b5b3ae4725ULL, 0x911187013fd45e4dULL, },
+      { 0x4d25a6a8cf73f868ULL, 0x34c7c2a973e24140ULL, 0xe9d06afe399da952ULL, 0x079f752370a0367eULL, 0x7bddd14758554a42ULL, 0xce2d628272cc48f7ULL, 0x36d3f3db49d39297ULL, 0xc46c5f05bb97f663ULL, 0x7fe0bb8ca0f5671aULL, 0xc13b2001e74699daULL, },
+      { 0x8fd395e6fc173cfdULL, 0x76143625b6471b8bULL, 0x37cf4054ae26f8bfULL, 0xf0e9dfa2da2def08ULL, 0x47f329909375ad8cULL, 0x3dab4aca04119da6ULL, 0x7e2ea41a2f6d7601ULL, 0x29fbc2a5ff5a2784ULL, 0x0b4abf00bda27141ULL, 0x80b1107a371cb536ULL, },
+      { 0xce947d6147e13d31ULL, 0x8f3259ca2694f4f8ULL, 0x2220e229e9e4e8bbULL, 0x4b87c360e45f7166ULL, 0x1e0646de841c0dd8ULL, 0x6944095eb46ea296ULL, 0xcbb414a834b7301eULL, 0xad76b4559575f588ULL, 0x9f15c84db422ec3cULL, 0xab6ac57097cb782eULL, },
+      { 0x1dd389dec96033abULL, 0x1a69765f4ae893d3ULL, 0xc4e208ebfcd2326bULL, 0x56be7c6ef06035bdULL, 0x84d9bc31f29e3509ULL, 0xf55440860e092222ULL, 0x92845db76218fa8dULL, 0xec4403e4b5a6183fULL, 0xcb05f35952b2227dULL, 0xe453c75ae1db1f4cULL, },
+      { 0xa31c6c2edb21332eULL, 0xecf287280207f5c6ULL, 0x0f037f0d2c0dd9eeULL, 0x85fb1a51dacaab17ULL, 0x228e75b5aab8b24eULL, 0x8ca71e6da4df72fbULL, 0xb6ebdf3353c4ca50ULL, 0xe9494cb5b8de3f27ULL, 0xd0e3594262edf000ULL, 0x9810d617cbc1cd50ULL, },
+      { 0xf9122f0d9ef3a943ULL, 0x858baa57620dd8b9ULL, 0xdd40252f3f7ec120ULL, 0x2f72a52366814ec6ULL, 0x15fa89d758277006ULL, 0xbf0fe100b69a6ce0ULL, 0xb9af206a721d5e1fULL, 0x2b0c88da7d51e800ULL, 0x3575a435be2ae834ULL, 0xca8d25442fcaf9f4ULL, },
+      { 0x790b5bc4dc2bae17ULL, 0xecc2e47c9a4ac082ULL, 0xfb7492a8b9340e6aULL, 0xa1476e02c3771b11ULL, 0x365ede1e0a260f14ULL, 0x5e13f4615301aee0ULL, 0x16bad318f9174ab6ULL, 0x3671f1bdd2c91f8eULL, 0x17498e7976a7f094ULL, 0x86e626ee45e3b4d8ULL, },
+      { 0xcf7b95c4db5a8c13ULL, 0x8192514a66eaffe6ULL, 0x5fd990ed182995e9ULL, 0x74427e603ee765f7ULL, 0x0f732e42f70325caULL, 0xd981e7c8a952efb0ULL, 0xace2b7a143629197ULL, 0x9ae0e6bbe6617db3ULL, 0xca2667eb50bd3b3aULL, 0xb3af6ef680a6a5e6ULL, },
+      { 0x21e01d1cd5b15bb0ULL, 0x23730bf7a275db9aULL, 0x702b0d559f16af14ULL, 0x7f1aa8c94e8f3f3dULL, 0x6e22930b05e819f0ULL, 0x8586e5cd33f3a539ULL, 0x9184be29e52fb261ULL, 0xaafc38341c785eeeULL, 0xaf53aa0a1c0c8fa2ULL, 0xef572b55eb0411bfULL, },
+      { 0xa3ae0692b9b5aff8ULL, 0x5c2ce938f86513aaULL, 0x4872e43028401658ULL, 0x82561da2b4a2ac61ULL, 0x6a8514a0d89bc0f5ULL, 0xdd4b178f32657082ULL, 0x5d73e47071231934ULL, 0x3e4dec26466b029aULL, 0x41a648c38f9428b7ULL, 0x9f668c4ea54bcd33ULL, },
+      { 0xc404e268ae24e37fULL, 0x342706c99f4d1ce7ULL, 0x273cf9446750be32ULL, 0x3a9cecf4f7ca4c2eULL, 0x59d2833c477c339fULL, 0x5fd36071765dc1cdULL, 0xf229cc96eac8dc42ULL, 0x64a015ff178f0ca5ULL, 0x4d32135b7ac81a09ULL, 0xd452412a2e5ddb93ULL, },
+      { 0x9aef5c6aca26b7bdULL, 0x8110d71ce903f901ULL, 0xbcf9a6296f953f19ULL, 0xa071353ee95a958bULL, 0x233f71ec2c616a91ULL, 0x41598c51b931d08fULL, 0x5b1804607f5c0b22ULL, 0x54fc7cdd55d5e7fdULL, 0xc087740af1367e73ULL, 0x8d67e37a470a717aULL, },
+      { 0x2c208ed9a4e06cc6ULL, 0x6ddd333108899a11ULL, 0x3b731c72740de3c7ULL, 0x21d2d6c48e25a2d1ULL, 0x9e65937a3db90286ULL, 0x75f344db63400ecfULL, 0x9005a6f24764d789ULL, 0x991a4e7b1b46c13bULL, 0x9e498cc77b326158ULL, 0xbc5a31150697d42cULL, },
+      { 0x2a74ac196072c9b0ULL, 0x3f036d09bfff1986ULL, 0xd93ff27c70700c8bULL, 0xe556ddc5fbc91790ULL, 0x68289697a4e2c755ULL, 0xbeb20e5533d32858ULL, 0xc934975a197bcfb0ULL, 0x89b92e31f19b2a25ULL, 0x3f28c83b1655b64eULL, 0xfae28d3814e34bbaULL, },
+      { 0xac740b966f927f1aULL, 0xfe7b727d6e4722c8ULL, 0x8d2e5072fec0a073ULL, 0x0b975ae5fd6a3d1cULL, 0x5c98426ce0d92211ULL, 0x9ad250a0d74fc952ULL, 0xe0693bf94f7aae93ULL, 0x1d72caf2b18b067cULL, 0x53e2e7c7b1b8643bULL, 0xa716d48d4e0dfa64ULL, },
+      { 0xd75175e64d0d108dULL, 0x27ed390179c6ff44ULL, 0x51033db88189acb2ULL, 0xdb1badb98a6b0e24ULL, 0x72af761fd6b34900ULL, 0xb7aed776e82e0b5dULL, 0xa8dcdd347d01bd34ULL, 0x136b0dc50763e28eULL, 0x092597bd09ae24aaULL, 0xde9000d145fbce58ULL, },
+      { 0x40a0667f7f03ed8eULL, 0x65220507331a622dULL, 0x8979297aa6111e4fULL, 0x49bca0da899a1ce7ULL, 0xc51d4fdc8395be63ULL, 0x83935c645f9a8f79ULL, 0x52eddee5cd81cea5ULL, 0x7d89d59f6a0d127bULL, 0x23f966948c6e1543ULL, 0x9439f89450c21d71ULL, },
+      { 0xa9132b2c29466a91ULL, 0x955f77ba5bc97506ULL, 0x7afc89b4665e6af6ULL, 0x92d350792a956bb8ULL, 0x082c7e8a17c3562bULL, 0xe517a52fa9cde6b5ULL, 0xef3de21adc06abe0ULL, 0xa7165c0adc2d9f2fULL, 0x4d2fa594c8675451ULL, 0xc56ff87b7c3f82aeULL, },
+      { 0x4ae648f11414c158ULL, 0x9d70a130faa9589dULL, 0xe667f3104619c381ULL, 0xfe041cc5b279ecc4ULL, 0x573dc71e1a45b573ULL, 0x8732bbc93c28018bULL, 0x513884dc9da43a38ULL, 0xb39998eb4d6d0e4aULL, 0x1ebed3479b3df14bULL, 0x837e3e1e2501b11cULL, },
+      { 0x684c7e675db3147aULL, 0x8f3e7474c02062f6ULL, 0xd9c9da775a7808a2ULL, 0xcda58d80cce21b08ULL, 0xe3258fc0535837adULL, 0x96887ebd50992ee0ULL, 0xf035cc2952f253d6ULL, 0x4234e28d84234032ULL, 0xdd9c0dad9bd46131ULL, 0xaf260d3170b55c57ULL, },
+      { 0x05c4d4e40eb4cae3ULL, 0xa21809b84a590a4cULL, 0xfd3d2b24ea1ce1f1ULL, 0xd933337f16a21272ULL, 0x2765aee75c09d539ULL, 0x497133ab8dd3491cULL, 0x5588cb97409c062fULL, 0xe58f06526c97feabULL, 0x009e22826cb5d622ULL, 0xe94c35e2cf5d09c8ULL, },
+      { 0x3c6da3c6b6cb0436ULL, 0x28895741c6bb6c6dULL, 0x1f449227abdc1241ULL, 0xb55db9d47e7d50edULL, 0x3e9f5cd9c2d494baULL, 0x34ba635cbbc06b75ULL, 0xc200c98d5df1796fULL, 0x262cd83e10525385ULL, 0x3b9a572a9c36d784ULL, 0x9b604659667d5503ULL, },
+      { 0xcd5b83ebd993f9b8ULL, 0x13c3d571045ef85aULL, 0x51cae25efe1e231eULL, 0x2f0d16d6031e8016ULL, 0xf6e373ac621deed8ULL, 0xf9a254e3afc82137ULL, 0x4fad0eba1ba6517aULL, 0xc6599ad7022f3297ULL, 0xbf07d8d32fbb9434ULL, 0xcef5eea82bd4d37aULL, },
+      { 0x10a95b5764849fa4ULL, 0x5007b711dac03cf8ULL, 0x6628d6697231ed9fULL, 0xfa9969126e5f6af7ULL, 0xa04e74a7e0ed415aULL, 0x6a42524f5bedc2d6ULL, 0x68ab4cb1a2b87631ULL, 0x011f04fafcd9b2d0ULL, 0x2b32a4124c15ac62ULL, 0x89d5ec4e50cd1acdULL, },
+      { 0x7c77a16b3dac8a56ULL, 0x48ec1383d6a88f6dULL, 0xbf029c3c915231caULL, 0xb9ccfac7b0d1467bULL, 0x67b3e658eb9079a2ULL, 0x0a4efc11bbd04fcbULL, 0xdf1633e4575edbd1ULL, 0xaa7e2912ba393cb1ULL, 0x6a753b5ed7c12dbdULL, 0xb798ca8a53da910fULL, },
+      { 0x42fd83fe76850a50ULL, 0xd4dc6d4bb62ccd7eULL, 0xe5cff7520e81ca18ULL, 0x4482d255aa5b9de9ULL, 0xe91a620baf0b4667ULL, 0x6872972698dc3caeULL, 0x6800866ec2ebf21aULL, 0xf084566c409d7e18ULL, 0x210e5077241e3527ULL, 0xf48cf9e28397c3e3ULL, },
+      { 0xfd4c72646894f869ULL, 0xa63fe73f71fb7c20ULL, 0x5a1c8ca6c1c248b3ULL, 0xef1e3c354a228f9bULL, 0x788b34ebcd2155afULL, 0xcaab0c1cd1d06ac2ULL, 0xa58b6ef9f6d8c7beULL, 0xca5acb9db042c663ULL, 0x528b5780ecd20382ULL, 0xa2dedcc12f64a3a3ULL, },
+      { 0xd68cb4de70a13e83ULL, 0xc3c5470368545616ULL, 0xa611f120800c44faULL, 0x54dabcf8f5381aa2ULL, 0x9af194f2d6faa131ULL, 0xd10dd1fc138f7fd9ULL, 0xc4f3859a8b788e07ULL, 0xbff2f37ae05d5f00ULL, 0x209e5cc8590d3f22ULL, 0xd8f17cd7346f2bb9ULL, },
+      { 0x25bb31636d0dda2bULL, 0x8425a6d8518d186fULL, 0x07016aa865c6813fULL, 0xe381dbac87be9262ULL, 0xee3422ac73dcf8b5ULL, 0x7cee336a3456bb61ULL, 0xec2a6ec744186c2aULL, 0xc0979996c17d36c0ULL, 0xf69002409c36e196ULL, 0x907bebbd42fc6eeeULL, },
+      { 0x93d33a8ab4cfd79eULL, 0xb52cabfc60346523ULL, 0x9a53b30550edab20ULL, 0x9c4fa6e8e2083ecaULL, 0xfcef4ce6b212ad35ULL, 0x09406266ea68aa75ULL, 0xe16785c8c0288169ULL, 0x602b925fc83c8d87ULL, 0x2b5bc488278de14bULL, 0xc073d972f364fd5dULL, },
+      { 0xd496858ef521233cULL, 0x800a91d145690c83ULL, 0xfb6de9cb581321f3ULL, 0xcb98be73e9c197b0ULL, 0x2279fdb2ec077d0bULL, 0x490fc1629e4695aeULL, 0xf8f09f42d042bc96ULL, 0xed6c1dbbc83efc75ULL, 0x08645c8017da26fbULL, 0x802c58d2dd2a7970ULL, },
+      { 0x0da7736d582077e5ULL, 0xbfece64a18831276ULL, 0xf4a931a90f6c0eefULL, 0x438802e2ac9305c5ULL, 0xfcc0d59336ff7f9fULL, 0xe239490292930ca8ULL, 0xcdc2a79fccd53896ULL, 0x65fbb5b4cb47b03eULL, 0x6813a6a2326f99adULL, 0xaab9fdecdd8808b4ULL, },
+      { 0xbac2920e0acc63ecULL, 0xa88139769ab130d7ULL, 0x8fd7680e9fd11c05ULL, 0x07c503775b5a1ccdULL, 0x58c576a5df3b1415ULL, 0xd014ad95bb83eb24ULL, 0x2e93e4eeff0b840fULL, 0x1dabe55d7130ff56ULL, 0xa014764bc628e119ULL, 0xe3684f159f00f2c6ULL, },
+      { 0xebe5bdf6d71cd974ULL, 0x162e844ff13c9209ULL, 0x9789c1bf1e1c8ba3ULL, 0x8a178c45fa862890ULL, 0xeca8f49887cac616ULL, 0xbbd84b90170d24d2ULL, 0x587c09b079ed0a57ULL, 0x83c5d899add6334aULL, 0xd165f368406a486aULL, 0x9774037b8c6e357fULL, },
+      { 0x288f8862c42d42caULL, 0xc21de23b57309d2cULL, 0xdcee9bb001c69d6bULL, 0x9f08c4e025826741ULL, 0xb887dc87a34c8af6ULL, 0x45d8a3cf4d6b5c2bULL, 0x12e7d1a4d3000847ULL, 0x5ce0724cc718d27cULL, 0x850bd0661d06d7d8ULL, 0xc9bc420c3af036ebULL, },
+      { 0xb5a375cce2de6386ULL, 0x0613611b81668ec9ULL, 0x2ee39725a13c366dULL, 0xab04e9cba755eb0aULL, 0x3306acf75297d282ULL, 0x9ab7773e990fe5d1ULL, 0x67d8209598bab212ULL, 0xc5779ad7acf0f1e6ULL, 0x84f25486c069f826ULL, 0x865b087ab9dbdecaULL, },
+      { 0x45a6f5464d40e8aeULL, 0x41b9a97a83b638ffULL, 0x52d351bbb1b34d87ULL, 0x61419d939ee60acbULL, 0xe87b016a6304f083ULL, 0xe4fbf1d77354d5e6ULL, 0x16493f367da0efacULL, 0x678c5daf13f247dfULL, 0x3a8ae36f4fbc7e15ULL, 0xb2f62092958cd94eULL, },
+      { 0x9e21716839b790ecULL, 0xedc01ec2c72613d5ULL, 0x31108c5d434ff5a0ULL, 0x5b203bcf28cf9374ULL, 0x718431db4d9eda4dULL, 0x83ed7d9b5e962c46ULL, 0xa7122dea315793b4ULL, 0x130ca235b4c1c523ULL, 0x0a20d2575c3c99e7ULL, 0xee60577a6a3a832cULL, },
+      { 0x66b79a702db9ad3aULL, 0xd8f52f30ad0bc34dULL, 0xd6f51f195064f22cULL, 0x6152d91a1741f6dbULL, 0x8a4733259a7bcdffULL, 0xbb6e4efa0e925d04ULL, 0x9c6a058ca89aefe0ULL, 0xd948721060b3bffbULL, 0x7aca2f4ae97f400bULL, 0x9ec2293f14a80908ULL, },
+      { 0x95bb7a7ee06bf730ULL, 0x3f8a9508bd081922ULL, 0xb9685f7eb06b817dULL, 0xbbb6accfde0d412bULL, 0xa3c497b7c1e17f55ULL, 0xe2832dfc70e2772fULL, 0x4c2226527c9384e1ULL, 0xa607d72e59e60c64ULL, 0x79ffacc805f7588cULL, 0xd3774a98edee435bULL, },
+      { 0xfe019536b6b2126fULL, 0x90cf79639acb1c61ULL, 0xb9771dff35bc0046ULL, 0x8a6fba4a840251d5ULL, 0x886b0393ea0d94b7ULL, 0x6ffbf77e0e4c5942ULL, 0x8435cdde9310f292ULL, 0x44bc06d202af7614ULL, 0xe1b30373e12be1a8ULL, 0x8cd60f2e9f3469f8ULL, },
+      { 0x140749b662ddad21ULL, 0x5161091e67b0ac1fULL, 0x48105a8b0939091aULL, 0x15af9a1b836bdae8ULL, 0x8c63ac98625af80fULL, 0x99090c300634f8adULL, 0x2d15b22acf87873aULL, 0x7d7376780a05fe7bULL, 0x5a2832221893e125ULL, 0xbb97f286b6c92df5ULL, },
+      { 0x219f741275af638fULL, 0x95e25e24a15be9f9ULL, 0x9f6afa33be1ece6eULL, 0xa486757b1e65171cULL, 0x42dae938e7418b63ULL, 0x707e0ba3556a6a72ULL, 0x9b505fffcaafc3b6ULL, 0x1ae277f2df371503ULL, 0x5b5f13dc21c77bb9ULL, 0xf9dfd187621e9a0dULL, },
+      { 0x4501b46920319a97ULL, 0xa0efd903a05494b9ULL, 0xe9ee667b90f4dfe4ULL, 0xfebb16d312d7081aULL, 0x2a92ae28659ec139ULL, 0x17602a56028f178cULL, 0x20f9d7afb48095f6ULL, 0xc3175e6c9468bcfcULL, 0x60edb7e3321a4ed3ULL, 0xa66a83a315c67b99ULL, },
+      { 0x5b4c58207f21e65cULL, 0x8a032e2da86959a5ULL, 0x3af32d2bc68904cfULL, 0x3534fb7255309861ULL, 0xfcb24a30e3f05dd7ULL, 0xc4056223d240853fULL, 0xa232b33cca567bbcULL, 0x51e8c22ee5232e3fULL, 0xc3ba8653a989ec42ULL, 0xddaa7a7cdd641953ULL, },
+      { 0x0dafd9d1282d5bf9ULL, 0x823630341e73327eULL, 0x5594d0139d3ce3a1ULL, 0xd6c4bb9737856cedULL, 0xf02d589817ad336dULL, 0x3f0e9839ab2cc82cULL, 0x64e51f4a80b13bf4ULL, 0x8d1acf101ad2f36eULL, 0x6feef9839b3f21e7ULL, 0x93a11b9491da1062ULL, },
+      { 0x0463ec8cc5b02325ULL, 0xb0ecc900e4129942ULL, 0x8b58828bc1f3d6d0ULL, 0xe4ef708d087f0c1fULL, 0x98d5a8ba3e2208cbULL, 0xe367062e1c0111acULL, 0x1fb822165d49bf4fULL, 0x259ebde975fcf89cULL, 0x26342b4602331337ULL, 0xc4a45b6474b7d572ULL, },
+      { 0x1506da931127445cULL, 0x07359c1eb699536fULL, 0xa9138e2ae93b5a47ULL, 0x3a0e597cd519227fULL, 0xc1fdc7e63b56ab53ULL, 0x04105ec5eb95119cULL, 0x4e086199242d51f8ULL, 0x209cd71829c812c3ULL, 0x0d1f304e9600e645ULL, 0x82f6a2d9d75713b9ULL, },
+      { 0x634b752093ea4fc7ULL, 0x3deaf0d33146470dULL, 0xf653845491a2aa21ULL, 0xaf81307205295c7dULL, 0x8241e6d56a38b920ULL, 0xb6956c3359449eaeULL, 0x735f02b9cf3f70b6ULL, 0x62f7b40bf17c4bd7ULL, 0x397169ca3a74612bULL, 0xae716c83e0b113acULL, },
+      { 0x878a8b85b3aac747ULL, 0x9521cc17b97b4ff2ULL, 0x47e7eb6703e88ae7ULL, 0x8ffff4ab308e8a8cULL, 0xeeb8531faa56db87ULL, 0x88877bcf85f8ee4cULL, 0xcc455d94db9867b3ULL, 0x7d0380bec8167a53ULL, 0xb8a7f25b2b1d684bULL, 0xe85b9d611f2cec9cULL, },
+      { 0xf4c28d823e502210ULL, 0xdc902647b96cc287ULL, 0x2766295c11db4251ULL, 0xeee9a197227befafULL, 0xbc97afb9b295ff69ULL, 0x7310ba2729a06fd2ULL, 0x25988f6c250da29cULL, 0x894be39a5c548ee6ULL, 0x2fc960afd12b7360ULL, 0x9ac009ca6f2f9db5ULL, },
+      { 0x2b2b03e7f5e5994bULL, 0x8d495907ddc90690ULL, 0x4912e404f88ca9d2ULL, 0x47019b2b9459a4a2ULL, 0x5786347b0326280aULL, 0x3ba64b56ee886283ULL, 0x55bfe9333abd0effULL, 0x624f1661ab8352f1ULL, 0x41814d416c889db6ULL, 0xce207f57447b2e11ULL, },
+      { 0x460b87571be7f549ULL, 0xbc5e6f24d7b62560ULL, 0xa815cec92b9f792dULL, 0x0413fc54926aba87ULL, 0xa73fba01e6e51ff8ULL, 0x40deabf62964ab18ULL, 0x2b3e7668286666f8ULL, 0xba4ccbbb50327350ULL, 0x23cc28362cd4b984ULL, 0x8947c6910e62968cULL, },
+      { 0x4db454c1fbda12f6ULL, 0xeb4acd6e607be194ULL, 0x3392b46d9dc1f07aULL, 0x55e0dccae65a8d0aULL, 0xc7fa89a4dac02bd7ULL, 0xd0118c29a9ec47ddULL, 0xd73eac89d65c6159ULL, 0xb8db345a1c437f1aULL, 0x5c4d325506a2d9f7ULL, 0xb6db7377c0a0cfb8ULL, },
+      { 0xb4c28a6dec422f7fULL, 0xae949f4cc005196bULL, 0x4742db6224454cb5ULL, 0x0ea7676b1a8a6274ULL, 0x891958897f635f09ULL, 0x628ca03ca195a373ULL, 0x19f5ca492d976602ULL, 0x5872c45fea983c78ULL, 0x14c2e34443d9573bULL, 0xf390c67f0fb79b1fULL, },
+      { 0x371d1586a81b43cbULL, 0xf1fca7be3cc58254ULL, 0xba1875a06e96910bULL, 0xdf3491d53fcad444ULL, 0x1e9eea20836cad20ULL, 0x3a0343d357848193ULL, 0x8c0c62b5c57f9962ULL, 0x24c759b1e605bbf5ULL, 0x759018eca4d73544ULL, 0xa236e5975e7070aeULL, },
+      { 0xf8667523d8064eeeULL, 0x6260bd717e1a5c10ULL, 0x424d62ba925d2cb7ULL, 0x7a04d76482b35b28ULL, 0xa9b6b355752fe645ULL, 0xae4f2a8a7117fc2eULL, 0x6d9c5cb3a6f86a45ULL, 0xfbfcf45a02e904afULL, 0x8933e999a506a441ULL, 0xd811c206b3cc68fdULL, },
+      { 0xeb13922b7a1df746ULL, 0x75d1acad9214ae84ULL, 0xdd23a6706878fe4fULL, 0xa275ab491e151fe7ULL, 0x005703e2a9837604ULL, 0x234358c7ab98456fULL, 0x43545f091f29bcd1ULL, 0xb6fe39282056376eULL, 0xefaa3d20e12e6c94ULL, 0x8fe6eac29e8d690dULL, },
+      { 0x45bcacba192f4a58ULL, 0x41b1b8121fe3fa52ULL, 0xf4b889486421de44ULL, 0xf6d17787eba2837fULL, 0xd73eae95a8cb851aULL, 0xee57f36767b893bbULL, 0xf548a054888be6dfULL, 0x3322f49d0afd0766ULL, 0xd613321d876f893fULL, 0xbfad60666593b0cfULL, },
+      { 0x3e69c409b3c786f8ULL, 0xfa97cdc23607e3f6ULL, 0x1119b74fe4c11204ULL, 0x9aff78cfb699c677ULL, 0xdf82f971a15f9ff8ULL, 0x54ba8fc666ce741dULL, 0x7f149f864c074063ULL, 0x9b071bf11bfd0129ULL, 0xaf2344b681edb497ULL, 0xff505413fd3c0046ULL, },
+      { 0xf464eab17f737531ULL, 0x0e1aa8997442a946ULL, 0xf6f98f0ca9d5cddbULL, 0x81cf7878b23f063cULL, 0xac188636c1612d80ULL, 0x600af962524c35acULL, 0x8870050e2fa00543ULL, 0x6427e74eb39428bfULL, 0xa036ef2f9dc6f3b7ULL, 0xaa09ecb8567ebb6dULL, },
+      { 0x5998533fc3069e8cULL, 0x10ac8aa26785579eULL, 0xaf1d46f2168a3b0dULL, 0x7762ff462600381fULL, 0xb6faf08889ead8b9ULL, 0x7032d4220cd83103ULL, 0xa071930c0eafe9f1ULL, 0x15491c997144616aULL, 0xa60df301cc028cfeULL, 0xe27dc9a652423142ULL, },
+      { 0x1c4dab80d6e97dafULL, 0x5260c9918b4ca156ULL, 0x8f53bf988c5c0254ULL, 0x3d2d4a1cd15fa5b5ULL, 0xbf347e474abaae5cULL, 0xad2eb5f9c62efefbULL, 0xa8a9441199555588ULL, 0x1c002e4f3fe444a2ULL, 0xa6bce802f682491dULL, 0x96d7d299c7b10acaULL, },
+      { 0x49a36f2a180ef036ULL, 0x7a7de2158d5ae43eULL, 0xb270be62476cc31dULL, 0x9a1990b489c15fedULL, 0x1ff85be7a41ed0e8ULL, 0xfe15c68a8912f465ULL, 0x4c3afc2d404988aaULL, 0xca535de528e13208ULL, 0x324e39b9335f0d8dULL, 0xc8ec36404ea03136ULL, },
+      { 0xce39ec59dc7587e5ULL, 0xf018325c32302b62ULL, 0xfd6aca700790f975ULL, 0x25595c88406318b8ULL, 0x06b4144ff448a7e4ULL, 0x89e0ebb389c1f021ULL, 0x62b710a367482090ULL, 0xd092308a22c1c9a4ULL, 0xbe43333a86c8f5caULL, 0x85d0797fb9404672ULL, },
+      { 0x209c3715a54986b2ULL, 0xeb07f4167609ebb5ULL, 0x59b1a2d9324680c1ULL, 0x1424e7fee35a21e3ULL, 0x037ccac7762c5f29ULL, 0xffc553c4509a276fULL, 0xf493122722ada146ULL, 0x4fbfcc557ca24809ULL, 0xe8e1f0ef5d11a2aaULL, 0xb23d914906c964a3ULL, },
+      { 0x60e67e98edd84c38ULL, 0x574ebe2dd740457bULL, 0x34fa13d842e936b6ULL, 0x97213c4b6fada287ULL, 0xc8568948fb849bf8ULL, 0x5d730972f886335dULL, 0xa4f4153ab444d68fULL, 0x0a8e145938e5b416ULL, 0x574800442d68c5b9ULL, 0xed6a822b6a589572ULL, },
+      { 0x980601edcb44a728ULL, 0x02f38076ecccdeaeULL, 0xdca1ccc2c700646fULL, 0xb535fca106c6fdb0ULL, 0x27be37aa184cf4a4ULL, 0xdc362487fece980aULL, 0xbb5cb30cc4c82bd3ULL, 0xe16f3bc9691739a0ULL, 0x3ce8439d058b3f05ULL, 0x9e1e6fb7056ab2dbULL, },
+      { 0xe2d3340354f370daULL, 0xace249df51a3cd21ULL, 0xe41394838d101bf5ULL, 0x21de03a7656108a8ULL, 0x0592db27a259ae88ULL, 0x0b60cc858b2a9408ULL, 0x06bc5de848336374ULL, 0xca4d999cd202e876ULL, 0x982bcf7a5c488926ULL, 0xd29d35d7bf4a1e91ULL, },
+      { 0x751352eead0d9b0bULL, 0x15aece5b1cc41f41ULL, 0xac253083ded648fbULL, 0x994e37de8381133eULL, 0x0336aa8ea75eb437ULL, 0x56230d38f5d599a1ULL, 0x1c38cfa56d2fe180ULL, 0x129a0365ce646a19ULL, 0x0d4ee73629a92169ULL, 0x8c44d14717c031f1ULL, },
+      { 0xaa28ed2102f0118dULL, 0x2346d0a04435ab8dULL, 0x918bd1939583bb10ULL, 0x4fcec5eaedf87b68ULL, 0x46d06e9a0d28cd22ULL, 0x672114412d427143ULL, 0x9a131a3764932d58ULL, 0x5f8309f3c8304914ULL, 0xdeb8844cf5ebf447ULL, 0xbad67c4a81cfc4fbULL, },
+      { 0xfb8ddfe8c6aa8049ULL, 0xcfcf4b54cb686411ULL, 0x2d1e24a4de3df6cfULL, 0xc3c8681e66c5e9c9ULL, 0xff5aae7bf16139a9ULL, 0x9a7ffda649468a30ULL, 0x07e199e330db6e5eULL, 0xb077509d7d6d8542ULL, 0xac7699733a20cd48ULL, 0xf8de20aa5d200d1eULL, },
+      { 0x3dfba4fc8b2ec673ULL, 0x925fee7d70aa8629ULL, 0xc17e6568754418dcULL, 0xe107d5ff198b6347ULL, 0x98d7643bfa00060cULL, 0xa248d8039d283ee3ULL, 0x0723479969b70e7aULL, 0x181d8ba646a6cfafULL, 0x5922b906607799c6ULL, 0xa5bee46db90aab73ULL, },
+      { 0x327db2b7941cb1b1ULL, 0x84e21a11be4c9f85ULL, 0x482a7d25dde2cc46ULL, 0x87f73ad0b5b7b839ULL, 0x5be07cfabec1e791ULL, 0xb8e9dbe17458dab1ULL, 0x5ac7ab979ac7460eULL, 0x3da829129c996677ULL, 0x239d467c242864a4ULL, 0xdcc5e0dcde0964ceULL, },
+      { 0xbfa81c6bf4b7a608ULL, 0xa3dd2fbc5890fbbfULL, 0x0791f0d570c9f9d0ULL, 0x6d4a2e2e83e4a59eULL, 0xfed1338ef2533f41ULL, 0xdfab6303bedc587aULL, 0x75c4ffbbf26de8cbULL, 0x8139b122527b2381ULL, 0xf00fb91e5d44a595ULL, 0x9308dc39fbd2953dULL, },
+      { 0xb88e64fcfa99b087ULL, 0x4c4c50c7bfe6c047ULL, 0x34a2b6a53513d234ULL, 0x7a747eb8d093521eULL, 0x23524ca2c6bca9a0ULL, 0x2feaad257c741321ULL, 0x3cf887c121515993ULL, 0x6cd4e57744fa6715ULL, 0x74d5a3949b145a13ULL, 0xc3d9904918b1c48bULL, },
+      { 0xf236303b19c6b223ULL, 0x66a6277f389f44a7ULL, 0x3430a80724a35baeULL, 0x90a0ad79cdb4904dULL, 0xc39eaa228a8a50a4ULL, 0xdc93c456a9c714d0ULL, 0x20e500a3e6da3825ULL, 0x361e8b41e1311a1eULL, 0x1cc54e9c4f44875eULL, 0x826f936ec4ff5bb7ULL, },
+      { 0xe5410a59692e36d9ULL, 0xa29504e60b68f185ULL, 0xae988e2c8639268dULL, 0xe546496de708f031ULL, 0xdc0943d4a09a4c89ULL, 0xca4b62ef1bcb808aULL, 0x3fb376992d5056c9ULL, 0x3d2e7ecb4cb7bbbaULL, 0x594321dcd57f6f36ULL, 0xadbd861d7f2104bdULL, },
+      { 0x6fb9f7dbb33c465fULL, 0xebc31746a03e47aaULL, 0xeaf0daeaf1be1297ULL, 0xd2c851c75c0aee72ULL, 0x5d1607b717aff3daULL, 0x6d21ff13148052cbULL, 0x34022a31b7b22bdeULL, 0x2c391b48e6577b37ULL, 0x660c774f3a482348ULL, 0xe76bfcfeae2dc34eULL, },
+      { 0x9118ce46845be553ULL, 0x3039c48ce5a17ffcULL, 0xabfb0e805c8512b7ULL, 0xc9e7a5ef0256a8e3ULL, 0x8cf04598a6095603ULL, 0x17eeb568fa6c40beULL, 0xbc14dc732ebab1ffULL, 0x9c160372c0b695c2ULL, 0x225c6d13db42ff7fULL, 0x9a20727b3bf21132ULL, },
+      { 0x40a38e097eb0fbd6ULL, 0xcad541bad543c746ULL, 0x1715ccc9ca7740fdULL, 0xf6a42290e8950d53ULL, 0x74042d7df2e3daabULL, 0x8ad1681a4cd25f8eULL, 0x59eaa297a29f44efULL, 0x1c9add06beb2e982ULL, 0x6fc7938961cd0ee9ULL, 0xcd4bec22e8f3ea5aULL, },
+      { 0xe6586c930d780d95ULL, 0x6cd9d26c48bd23a0ULL, 0x4c536a4de35d73b2ULL, 0x8231e98661b834a4ULL, 0x942aa205284be65dULL, 0x983f3c7019ed4d0aULL, 0x7515f7049a9cf9dbULL, 0x47debf9f75d54db9ULL, 0x683fcd9258e57a9eULL, 0x88ba336be1c524e3ULL, },
+      { 0x42964a984072f219ULL, 0x1358e13d2316c1b9ULL, 0xda8ed08949e02967ULL, 0x63f591e884f5c831ULL, 0xed4e2da6c7c1ac8fULL, 0x17090d0ecab46c44ULL, 0x8713baa196cee482ULL, 0xf6d112b9164d573dULL, 0xd68dcb0ff204063bULL, 0xb61edfa88654441fULL, },
+      { 0xb7db1c8d74e91d6eULL, 0xedc1df38937c10e5ULL, 0x4ee106415892e9c6ULL, 0x3b3bd8f68412100fULL, 0xfbe7d10bbd6d236dULL, 0x5cc5e24871f5fb46ULL, 0x6f552aceceeaf711ULL, 0xb82223795b462a23ULL, 0xa69b100388007823ULL, 0xf2959732ac3b838eULL, },
+      { 0xb2d17d6b06f19820ULL, 0x668794b64029c424ULL, 0xb1fcd1eea623c8c9ULL, 0x8e88463bad769392ULL, 0xa3ef90861a9df55fULL, 0x9bf1a28916318877ULL, 0x4f6174c0635e0c74ULL, 0x3add10e7f5a5caf7ULL, 0x468005f2531484e4ULL, 0xa18f9ba5d179918fULL, },
+      { 0x27ec765bb91ef0dcULL, 0x95c833ccb7bef7b2ULL, 0xf18d88c86e3d9d00ULL, 0xd0077a16db3f50c0ULL, 0x80a13b65811aa9c5ULL, 0xac3228dc6ed8dea1ULL, 0x2f65b234ed682db8ULL, 0xefcfdcd1acd293fbULL, 0xd5d03fbb8cd43077ULL, 0xd732edf0b032d5e9ULL, },
+      { 0x6826c26b1a8ca487ULL, 0xa14a24b5fe3589cbULL, 0x7bd2f33ef8722341ULL, 0x837d2472a732cd56ULL, 0xc5eefd838f480cdbULL, 0x3330cdbc551076a9ULL, 0xab5bf5c334fa41eaULL, 0xd7e19ff299ba010fULL, 0x743be21cc155c20cULL, 0x8f528372359fff59ULL, },
+      { 0xf26fc9c24643a5c3ULL, 0x6272fbdcef7c06d0ULL, 0x3029b7ee4f51a6aaULL, 0xa563fa4dc02dd786ULL, 0x3648e9a8fd11e45dULL, 0x5376fa96820abe94ULL, 0x2cfa78ec8891faeaULL, 0x4504fd4cbcbd4e92ULL, 0xd012d42e9d5e9b21ULL, 0xbee7b4084da9b5faULL, },
+      { 0xdb33183ac27cb23fULL, 0x5dfa4c92799c0fffULL, 0x69476f0ccedbaf96ULL, 0x9395ea6b908138faULL, 0x7e664310b4114950ULL, 0x51b8dae70e23c75bULL, 0x0550b626b7ee5369ULL, 0x9703cd472fdb3a1cULL, 0xf7bae7a414e0ae6fULL, 0xfe490724e9d0fd19ULL, },
+      { 0x187eb19248b45aa6ULL, 0x4b805ba3b2b01bbcULL, 0x5d5bb88113874afaULL, 0x9b52fdee7ddda19eULL, 0xb76c84ddf78b5af6ULL, 0x90e830de96e50868ULL, 0x3945adfe82a0d276ULL, 0xb47fdd0dca864ef4ULL, 0xbe7fedee21cd04ddULL, 0xa95a9116ff83bc3dULL, },
+      { 0xb3661546e0c9de6bULL, 0x7008759ffdc321c9ULL, 0xbf79c20db7023bd1ULL, 0xd0d945df2041b991ULL, 0x2ad2fe7dcde94ce9ULL, 0x90f9fb09553df538ULL, 0xb8ef5cb969da041fULL, 0xe5cbe6d3624425e8ULL, 0x70a0cbe2d9df4ebdULL, 0xe19436128cfae67dULL, },
+      { 0x69b81853ad1e73c9ULL, 0xda3645edd8f2f2c4ULL, 0x8799b8911eb47427ULL, 0xc0fddb155f2f49e9ULL, 0xa9111c6f4bc50a4aULL, 0x2bec442fc8bb36caULL, 0x88075c35f0185033ULL, 0xe1b0073509684f2eULL, 0xcb8670b5926be74fULL, 0x963c42cbb3e81e94ULL, },
+      { 0x70c3218fe1a52a0aULL, 0xb6c90c1ddd9e7312ULL, 0x21974a4c6cfaf099ULL, 0x6451b2941fada87fULL, 0x75ee8c748a2bc3a8ULL, 0x7fed0a6afb06f863ULL, 0xe53f595d946d0748ULL, 0x058a77727c363359ULL, 0x7b81cb72413a00a3ULL, 0xc81d010241ad8939ULL, },
+      { 0x36cd6c8d8aa8983bULL, 0x30a36c8c475b4295ULL, 0x069247140fab5714ULL, 0xb881daaf970119c3ULL, 0x20c93b06d3b9afd8ULL, 0xb27edb39157d5c62ULL, 0xdf123f647212613fULL, 0x0377e9e4b526aa84ULL, 0xd212c492355ec8e9ULL, 0x854679694e93bbd6ULL, },
+      { 0x2fea1fdcf863d905ULL, 0xe8bb58bb6f3de74dULL, 0x9f5e86a748e4af25ULL, 0xa938cdfaed2bd10aULL, 0x96ab17c3eec83d57ULL, 0x00d08ec191c4c70fULL, 0x2ab9f4e4b924c09dULL, 0x98cf79dee9e7043cULL, 0xd155df2cf8da8c99ULL, 0xb185c054bf9b9566ULL, },
+      { 0xdbaf1745929224a2ULL, 0x7a55865d2513745cULL, 0x5dcd9a811de6f25dULL, 0x4d7c91288d78062eULL, 0x0e7ac3ec3a239aa3ULL, 0xfe4712f4e488c03fULL, 0xaef8d82f8c0711a2ULL, 0x08ead5c8d6ca3d53ULL, 0xd0ed53cd4597b611ULL, 0xec75aa626862964bULL, },
+      { 0x203b3a7c3daae090ULL, 0xdcb03d5120fa4c1cULL, 0xddbcda9a970ec052ULL, 0x8acb2c7f8f22c6e8ULL, 0x71f70966666195c9ULL, 0x4208c3fb6262dbb6ULL, 0xea3a5cab829113e6ULL, 0xf406584dd4154432ULL, 0x51ca638506f0e475ULL, 0x9d7b5f07a2723225ULL, },
+      { 0xb556fde70aa30bd8ULL, 0xb5c4d6ad2aa75a1eULL, 0x3fc28da3387811e9ULL, 0x6f9225fd6dedcadaULL, 0x6ccc9a4e7be56508ULL, 0x682e16ef36c56d1eULL, 0xc81a41649829ecfbULL, 0xb30b3fc2998c2915ULL, 0xdefbee29b03ab91cULL, 0xd1c401fdc204ae97ULL, },
+      { 0x0808882d9f5dbfacULL, 0xa2b12ddb8305c336ULL, 0x674c9f5831acf715ULL, 0x2d2e38f8456f224eULL, 0xddc4dd9f5fcf3026ULL, 0x01a90b27e80bc7e5ULL, 0xfd15ddca75bf22bdULL, 0x4990b6d1a51cd048ULL, 0x17dd475f10a5bd9fULL, 0x8bb4292898307261ULL, },
+      { 0xae88cbf3c9cb6e48ULL, 0x4738310ecfe16d3dULL, 0x93a21048594ad778ULL, 0x730920dc8b3a5a30ULL, 0xbda5de3bd7934ef5ULL, 0x9d69f2d714d56c0fULL, 0x07a741f920f01706ULL, 0x89dd3212b50eb1daULL, 0x15c0eb93d9e3bae9ULL, 0xba15cd91d15b1678ULL, },
+      { 0xddb3260b33c86260ULL, 0x2d099d55f76ff68aULL, 0x8058b9551fcef616ULL, 0x6589c0ca67a93199ULL, 0x0f6dda23b86118e4ULL, 0xb5a637e8c895f4edULL, 0xcb88d2ec47d77c81ULL, 0x3ea361a65e9f936eULL, 0x2e52d2f7721d5362ULL, 0xf7dd798dd96be1eaULL, },
+      { 0x85f9815466df3af4ULL, 0xd9ac84327ad50d63ULL, 0xae9af02dbb6b2b7aULL, 0x5c1fe4f2cf70c83dULL, 0x97c9062db537a392ULL, 0xd357bb3e6bab8f28ULL, 0x17cd2e92109a9905ULL, 0x2322a519d9f4eb06ULL, 0x8d92ab63d021df89ULL, 0xa513f635f3e2cd3bULL, },
+      { 0xb88294fea20be083ULL, 0x6e1f629882f42b18ULL, 0x4829a53c504153e3ULL, 0x2f741140dacedd45ULL, 0x998c5d84bbcb5c0dULL, 0xd19d5b79ddac9fc0ULL, 0x5fb2a86f004d1077ULL, 0xbbeb26138f5cd947ULL, 0x7941b62b5ea6dae3ULL, 0xdbe232fd2bede33cULL, },
+      { 0xb96e16338979c0f7ULL, 0xbe50de5d313a6e6eULL, 0x37159eb418a15de1ULL, 0x02fb08dcc6b9774aULL, 0xe5e99b704516a7cbULL, 0xc6850f02001f020cULL, 0x120ed0e9c8e97134ULL, 0x6e7d2c29a0e92c5cULL, 0x5091413903ed26a5ULL, 0x927139e1fb0e54faULL, },
+      { 0x8aa74df2e95ea889ULL, 0x1d1d5a83a971b9cfULL, 0xa841363326e0f3e7ULL, 0xff6f1c3dd9c7b04cULL, 0xea318336eb6878bdULL, 0xf87c4e97b6c13654ULL, 0xe1eca44dbfc369d7ULL, 0xea692f9c7f198a6eULL, 0x2ddc291206801b89ULL, 0xc30f9650daeb4ee7ULL, },
+      { 0x21e8ca77cda6f128ULL, 0x432323a00280c4faULL, 0x13f4e38cf121811eULL, 0x1f8e8ff1b28e5de8ULL, 0x464c09c76f890f9cULL, 0x21cac94e88d6c37eULL, 0x2de046c0c35e50f8ULL, 0x2ea95aed1f4399e0ULL, 0x682bdefdcd9585a3ULL, 0x81e90f4cb4cf8f5fULL, },
+      { 0xcd4fb27982948a19ULL, 0x1d13cfb1f9b0c8ccULL, 0x32d3187b2760bbe9ULL, 0x6abb0d41e620b070ULL, 0x8a4c5647546d3782ULL, 0x070fa0bad982051cULL, 0x88b343114a7816beULL, 0x75a5753998620d22ULL, 0x83ce148f7cdf93a9ULL, 0xad0a593e3115f11fULL, },
+      { 0x7c9a7b7169c77b00ULL, 0xeba1a78065dc2466ULL, 0x835e80c2dd971aa0ULL, 0xdf46df6090022880ULL, 0x1f9000bbc12e7a86ULL, 0x8c3dcef627f9395fULL, 0xc3be14848ec4bba4ULL, 0x0aa608769bd13483ULL, 0x5eea220c2b5058c8ULL, 0xe67d53bb9a1d205fULL, },
+      { 0x2a177a8d2bc40691ULL, 0x6adfef212f3b6562ULL, 0xd678ac1e46c38c76ULL, 0x1e63df5ae9786ac9ULL, 0xd4ab0133be26e391ULL, 0x8d06fad80cf2bd95ULL, 0x8424a16d2bafc35aULL, 0x8731555ca468deebULL, 0x03821d3867cdacbbULL, 0x99817fc161a755dfULL, },
+      { 0x1d95e5f30e557ffeULL, 0x072ed1ff4f65a27aULL, 0x7c246e5249cb8810ULL, 0xb74a5c6c9e607014ULL, 0x0f18886d1e27433eULL, 0xe0e2da6ea92587a5ULL, 0x7a334ae72b6b9824ULL, 0x25762bb2e8c211d9ULL, 0xe215f4792139934fULL, 0xcc7834281a006cc7ULL, },
+      { 0x1ceab72d9ad26ebdULL, 0x6408d839c1312feaULL, 0xa6b886e78392846dULL, 0xf0b33b6dd8a0d833ULL, 0x141b15b9c07f6653ULL, 0x3b7d601627d3173aULL, 0x4ab934513461ccbbULL, 0x235df74ee11bec80ULL, 0x0846a15d0b387da3ULL, 0x882d32479cea524bULL, },
+      { 0xa50619e94d47dcb0ULL, 0xe8243e2bc42f1b1dULL, 0x8354054a43f51ff7ULL, 0xa37fbd374efdda07ULL, 0x60ae0e2091ca5102ULL, 0x9766fb5a3baf38a5ULL, 0x55226016664d8af2ULL, 0xddf12d1a1aa86a4fULL, 0x8616e81efe9eb100ULL, 0xb5630e5345e702d5ULL, },
+      { 0xda0c8667a924fe8aULL, 0xe18bc5620f5d207bULL, 0xff117e34f126c624ULL, 0xdfd9c0e65ca1e242ULL, 0x9acc3bca269ca376ULL, 0xeda6be6dc0e0dc11ULL, 0x8a001d20763fc9a1ULL, 0xee44c1a5fdf9e99bULL, 0x6a625936fb266d5cULL, 0xf19b6af11f382e70ULL, },
+      { 0x62f74501e60b247dULL, 0x981672d25d0ecfb4ULL, 0xcb21d3e0437e29b8ULL, 0x8fca2a145ac0a36dULL, 0x17ab45d629f9c0a6ULL, 0x98d66df2ce2019c5ULL, 0xc3429d6d4acee76aULL, 0xd55565c6637b4740ULL, 0x3ff86762c6fd01e0ULL, 0xa0e8fe39e50e015bULL, },
+      { 0x5d0fda26230222baULL, 0x3bb30ec024ce8ce8ULL, 0x2ffe2cc910d5511bULL, 0x056160e498f7524dULL, 0xebec106962839182ULL, 0xb46a8240211947fdULL, 0xd6eb20845af4b9c5ULL, 0x35bc70f960d4b444ULL, 0x66a25aa5cdb99414ULL, 0xd654ffa7376cc87dULL, },
+      { 0x0b79856800e67ccdULL, 0xf177f774fd284324ULL, 0x524bb68f322b36f1ULL, 0x1bb610b654e641a8ULL, 0xd78379d516138fc5ULL, 0x55917b1c267685c2ULL, 0xf002531b8f069d96ULL, 0x912676f7a879ad10ULL, 0xda5edea42e2a73a9ULL, 0x8ebeb52d8f64014cULL, },
+      { 0xa2950c280ef9be65ULL, 0x9fa11f57bc6540fbULL, 0x5eccfa2a71af46b5ULL, 0x972413815b6add97ULL, 0xfdfabbf7513f5d95ULL, 0x4a70fe785a6d1fd7ULL, 0xcfe2b80e7d0ff970ULL, 0x5ed116ec3eb42322ULL, 0x6e413dda784a17bfULL, 0xbe22d385960f762bULL, },
+      { 0x39321084ef5c656eULL, 0xead09eb5a8e2d711ULL, 0x8e79785ca35d757eULL, 0x57d62f4701724aafULL, 0xbf1a6f710a7c4257ULL, 0xaa8927ed805315b2ULL, 0xa89075c267ea475bULL, 0xaa6453bc4b79a785ULL, 0x1cf8f48a20d60c21ULL, 0xfd42c9bf56182b67ULL, },
+      { 0x5e8e927fc2072e87ULL, 0x0abc0054c4fd0de4ULL, 0x93993aea9d394dceULL, 0xc5858b98dc220032ULL, 0x13c75a0bdcec5d93ULL, 0x83b28cf078b93f59ULL, 0x4986ceba3cb3b758ULL, 0x337f2f84864d8d21ULL, 0x46889c4e46598d02ULL, 0xa8abea4d97500736ULL, },
+      { 0x3f0d0c411aea1ae3ULL, 0x1fd1a2241e063bbfULL, 0x33ae4fd06afc8e2aULL, 0xc021b9ce7cbe1382ULL, 0x0d9ad3b7edf97d33ULL, 0x18ea8b077bf881fcULL, 0x80159c82c9ed5131ULL, 0x3070f69e2a447ebfULL, 0xe5bdd205102b424eULL, 0xe0ab9360e2cb4564ULL, },
+      { 0x93b10250c8013bfeULL, 0x19ad4534dba28ab1ULL, 0xc673ef2d24bf3100ULL, 0x7f5ce73e96f49d15ULL, 0x8bf8a45f8d8b3176ULL, 0xe6bad22fe20c37f0ULL, 0x5fb682d7e0913574ULL, 0x58ef155c52789fa8ULL, 0x2d73f60dd3219f46ULL, 0x95a1536b33728fe6ULL, },
+      { 0x7db8170bd8d4c969ULL, 0x72bc87327be34e23ULL, 0x3a1b117c169542d7ULL, 0xd4d810c614bbb781ULL, 0x2158845531335262ULL, 0x5208226634373290ULL, 0x8d8e5642137c3a22ULL, 0x6d71e0c788704c7bULL, 0xf905bc9aee9b7904ULL, 0xc74ea174d00728ddULL, },
+      { 0xcef64308a4687e13ULL, 0x9621e142b53d9583ULL, 0xb4d178b2b5055fd3ULL, 0x607eea2ffaac19fcULL, 0x72e7c5f2b5905be5ULL, 0x280f4025474fed4cULL, 0x126b7ce56d1553dbULL, 0x83d62f2e18c6e5a1ULL, 0x5f4d12144d9c95beULL, 0x84bd07a41cef6eecULL, },
+      { 0x9a266de673e742bbULL, 0x9711cefd8bb51c50ULL, 0x041fb360402377bcULL, 0xdd066d54c6de4439ULL, 0xae53613b19aed155ULL, 0x4bccd3749b054862ULL, 0x484ca38ce9299d10ULL, 0x6301f578804fdac6ULL, 0x92938bf1c713e528ULL, 0xb0ceacf17681bdd6ULL, },
+      { 0xb0062e3592d64529ULL, 0x6756a3ee7e4e2d09ULL, 0xb97d115cc45c39a9ULL, 0x0b783161dd0b904dULL, 0x3113f680b5b060fbULL, 0x50d4a3d75514e6a8ULL, 0x0c03d8b3134c5b9eULL, 0x4ba19289c718ebe1ULL, 0x71cf55536ae2e412ULL, 0xeb81cf19f0160e7fULL, },
+      { 0xd18f97346fc9fa74ULL, 0x445a18a4bb4c6c66ULL, 0xaf4aaa3d5840143cULL, 0x71bbf2a27428494dULL, 0x319fe8f282d972f4ULL, 0xddb804e403dba7f9ULL, 0x370afcd2b606d403ULL, 0xd19916dccc0920c1ULL, 0xd5c81f2601444d03ULL, 0x9cd8f682caea2850ULL, },
+      { 0x8d6b591b87cd2fa3ULL, 0x92dbf649a2b96689ULL, 0xce7b22bde26a1953ULL, 0xff560d76fa1c5283ULL, 0xd258c195f7e0b721ULL, 0x60132ec6ef1abceeULL, 0xe330f9f7cdeb62abULL, 0x3fd441f68afc6912ULL, 0xf2407580d606a425ULL, 0xd0ebae2305da8e30ULL, },
+      { 0x1c74a53f6f77c97aULL, 0x4e4f2130e908d14aULL, 0x333dde82c6a09947ULL, 0xa63f09e307df2c30ULL, 0xc4f90cdbafa3a72bULL, 0x806c0a17f2e67587ULL, 0x30f8d784186ce3e1ULL, 0x8a4f90695c3ee155ULL, 0xdd33ec5daec42306ULL, 0x8b241638a7fa5b5cULL, },
+      { 0x08aaeb92f7cf9b4bULL, 0x11c483ad5419d81bULL, 0xc7f33d61f6550cc4ULL, 0x8777d81b8ebf6d56ULL, 0x81fc2bb06889a0c2ULL, 0xd2b204b0be4d268eULL, 0xa255546cdebf4ed5ULL, 0x22cce0712c11f3d7ULL, 0xd37123d1f407c498ULL, 0xb955e58ee42754a9ULL, },
+      { 0x9299b3b038937cdaULL, 0x8ce7cc3d8b600eb9ULL, 0xf765c378a7e7cbf0ULL, 0x68912e98d8f212bdULL, 0x8409e6575bb62f3cULL, 0x63b9b7549dcbfa0eULL, 0xedfc0e630e7522c4ULL, 0xf50e2b539bdcf463ULL, 0xb62ede1da8d9a3a7ULL, 0xf6dddb1fc64e7724ULL, },
+      { 0x683e5e702e1afb73ULL, 0xfa94bcdf4b44181bULL, 0xa038c304864ac739ULL, 0x57ae83c597da02c1ULL, 0xd74ced5f3ee74956ULL, 0x2482fadacf8e28a4ULL, 0xa117cc0ae58c43a6ULL, 0x74c2b0f26eacd15dULL, 0x4be9f3d93c252a87ULL, 0xa469b8453f56bcb8ULL, },
+      { 0x8c5c2f756ec185d4ULL, 0xc37daf4a9a58dcecULL, 0x09d9e21a62dd86d8ULL, 0xf4c5fb3cc31d1901ULL, 0xb1377358cdabd5c5ULL, 0xde3b6784fe5f9c30ULL, 0x1694fd52d1bb0fa2ULL, 0xe0ed0ba6b42849edULL, 0xf81002f9774fc4dfULL, 0xdaff6feaa6d2a5a4ULL, },
+      { 0xa4f60b6ef478615aULL, 0x80a13b75505e5573ULL, 0xf4eb745da698a5bdULL, 0x42f9728e3d7d40ddULL, 0x77444d0670bbd5f7ULL, 0x4f9dedfedae24c88ULL, 0xf4fdebea8157d507ULL, 0x84649a17819e47c6ULL, 0xa57c1d2e7ee53ea1ULL, 0x91da33eaa399885bULL, },
+      { 0x1c88ba2ab61073a6ULL, 0x829332b0d7249214ULL, 0x1bc6fec3c91aa33aULL, 0x7bd067ba5c62b75aULL, 0x377ba0babad1b498ULL, 0x50d5fda13806153fULL, 0xaa1180b7c06bfa88ULL, 0x949d6a6d6c5262d6ULL, 0x85968f38e829df91ULL, 0xc2466ca40d75e673ULL, },
+      { 0xfe07d1ab2cfd05b5ULL, 0x32e75c1ebc5e28a3ULL, 0x79b5811a0940f9e3ULL, 0x872e9912cc604d1bULL, 0x866d1ba5f24604bbULL, 0xecd3a58dabcf0d69ULL, 0xdd0267646d4ddf14ULL, 0xc5b0a61856c90902ULL, 0x93ce5cbca971bc2eULL, 0x816315e40258d849ULL, },
+      { 0x1fd049ce069088f4ULL, 0x9950a4651a79a0f9ULL, 0x18b4f534cdfab6e7ULL, 0xfc4fce40301a66faULL, 0xa43d2f2fb6caa0feULL, 0x02596433cfb68d2bULL, 0xb25c562cbc8725a1ULL, 0x4a5b17483ef5da00ULL, 0xd9b88f87406fe15dULL, 0xac57e526a1bdf4b3ULL, },
+      { 0x39f471908bdbe752ULL, 0xbf6962c715029819ULL, 0x33f1753a4321ca98ULL, 0x9332b62bfa8cd864ULL, 0xccfc56756717aeccULL, 0x27bbd6ff8a63f2a0ULL, 0x1937af11e3b30632ULL, 0xc0ac35a5b828748bULL, 0x444ad58674bcd872ULL, 0xe58fa099089c0464ULL, },
+      { 0x3fc2ac279d780b87ULL, 0x5a5e66d6a313717bULL, 0xb37f8d1be3a1c1f0ULL, 0x25c0b1fc45bb69e8ULL, 0x9f7b1e41d05a4555ULL, 0x57666903c002be3fULL, 0xf8bd346966577d66ULL, 0xb1f15138ddbf7b6eULL, 0x3b0a0e9acc2031efULL, 0x98e330f324f1ee6aULL, },
+      { 0x880b11f9cd39894dULL, 0xec309b16cbdb498fULL, 0xd7d95e3e8356a544ULL, 0x004dc253f9830672ULL, 0x7318ec2356ca41a7ULL, 0xdbec101bfd31e6ccULL, 0x304ddcd0780b7afaULL, 0xbd0b8d7174952922ULL, 0x556c8d8875d46877ULL, 0xcba55684c27b2f3dULL, },
+      { 0x17b8292ee8e37bafULL, 0x20e7b43be1fbeeb0ULL, 0xb6d10ad2fa6033dcULL, 0x74c3e985ce1a004dULL, 0xd5b5caf1ab328a0bULL, 0xcf95d84631fbe629ULL, 0x060c469d08dbe840ULL, 0x069f1edf8d8e7864ULL, 0x8bf02da0f34e1c6aULL, 0x87a0c28dadb0639cULL, },
+      { 0x4c820b234af2bce9ULL, 0x88990ec47cd19afcULL, 0x1c7b3f32ccd3fed5ULL, 0xd3537643c2cea734ULL, 0xbdd382474066ecc3ULL, 0xb8e5748082111e69ULL, 0x3c225146a12f74d1ULL, 0xbb476d72bf72d1b5ULL, 0xc8d60d02075400fbULL, 0xb4a7feaf6ff6cdcfULL, },
+      { 0x1612371d36bfdb34ULL, 0x491f694777e9c597ULL, 0x346ef399092cc69fULL, 0x742cfcc16e67f5e7ULL, 0x0bcbe1a4aad51877ULL, 0xf79e35d23bf33b6dULL, 0x8b3b70f085498937ULL, 0xb90205a0b1e4bd03ULL, 0x736f2cb3da3a66f2ULL, 0xf0a240af43603b2bULL, },
+      { 0x13e8939ae6be2852ULL, 0x2e5dfd8d9c5386dcULL, 0x7335bbcd5d167c01ULL, 0xc74f4ff638f50a6cULL, 0xe8149cd3d7e4a4dbULL, 0x6ee331edfbbffabbULL, 0xb9655f9b7a4d712cULL, 0x38d0ff596380522cULL, 0xd46214a330588023ULL, 0xa0430ca1adf5c006ULL, },
+      { 0xbb4e1b9abd06c967ULL, 0x508693be2f2ccc96ULL, 0xa6b788af6893f988ULL, 0x49d668a836894f00ULL, 0x395278d99c127598ULL, 0x73305dc9abf15f35ULL, 0xea0529de2e320bd5ULL, 0x7915e046ce55bd8aULL, 0x32852edef513d25bULL, 0xd577f63d4ca851f1ULL, },
+      { 0xa335f421096545e0ULL, 0x74dcb417d22e6a40ULL, 0x357d39dcb0e3ab89ULL, 0x6cc56e44bbd1d68aULL, 0x20ae77b4bae8d5d1ULL, 0x2a598343811d028bULL, 0x87ca05e90abf7cbeULL, 0xa5f1df4afe5cb293ULL, 0x99a7981e02231231ULL, 0x8e2b7f56d6772201ULL, },
+      { 0x622ad92568904ec8ULL, 0x383a8773fef5b63bULL, 0x576e57b102e4cc4eULL, 0x4dc39c767cb97d65ULL, 0xe5d628ac2b52d940ULL, 0x045a34ae4a1249bfULL, 0x5f657e99d4cf22fdULL, 0xf3bbb96b72cc21faULL, 0x1cb918cb219b20e5ULL, 0xbd5ebe0c02dd5a76ULL, },
+      { 0x6fcbbddcbdd4411aULL, 0xb2053e46d26adf00ULL, 0x44c2c71c6231d831ULL, 0x6edaa6d0128fa943ULL, 0x0b255d1b0937a4b9ULL, 0x1d527b5971bd21d1ULL, 0x5d9036cefca484adULL, 0x5b9a2e5fe89b84e9ULL, 0x8f74aafa0d6daf18ULL, 0xfc3d9acb3a0b6784ULL, },
+      { 0xcba4faec37a8519aULL, 0xf61f8128416a1d4fULL, 0xed284a983303a3a4ULL, 0x5fd956e1bc4dcff7ULL, 0x300bb6f85c9d5e8fULL, 0xcf7203862c48b857ULL, 0xf9775a189d953dedULL, 0x05f879f4e99a511cULL, 0xc2a03317282c5096ULL, 0xa7fdf7a19db97308ULL, },
+      { 0xe5a1f5741be19bcfULL, 0xa21b396e4576f7cfULL, 0xfbf51bb59f9855b6ULL, 0x49a5f7c0f6f42b6dULL, 0xab13ae44dce786a0ULL, 0x4b12514009192e58ULL, 0xcf7a566b8797c0f2ULL, 0x47bbb08ff59e0febULL, 0x401209337708ee7aULL, 0xdfc3e098e88d4fb1ULL, },
+      { 0x14bcba0173cbbd90ULL, 0x1ff5b4dd800a9e90ULL, 0x9b4f80331b6273cbULL, 0x4eb4d496b2dc7c05ULL, 0x3cf19c748bad34ceULL, 0x9c9b0391ccc1e10eULL, 0x4a0c8bcc8f387454ULL, 0x4272a7da3990ee70ULL, 0xc14e8fbb4b5272afULL, 0x950703d2d3ff68a9ULL, },
+      { 0x68583d1c19d65977ULL, 0xfb7f27cd4c019abeULL, 0x436616647faff34cULL, 0x0f16653d97fc4b4cULL, 0xf387bb837d98ad2aULL, 0x825157d591a4ccbfULL, 0xb40f8dcb42785b58ULL, 0xbf0db2be79c2f960ULL, 0x7b818dc9787d46f7ULL, 0xc68116bb99cbfc82ULL, },
+      { 0x62a4f018a698141fULL, 0x8dfc80144ea85193ULL, 0x0a0357cb177cc971ULL, 0x1230505be1f1c7b6ULL, 0xb922849db610a3a8ULL, 0x201946d863d02e06ULL, 0x8d4a60fd3b3373c6ULL, 0xb92b0e47dfc3c375ULL, 0x1692f3db652df1bbULL, 0x8434239d5f659345ULL, },
+      { 0x5560bafebc736091ULL, 0x850966f0e9bfe837ULL, 0x90a855a13bd40d70ULL, 0x011bbabd12e4d409ULL, 0xdd3bd27f47eefc9bULL, 0x9572bc9c2d6abdd1ULL, 0x7b41dd6754ccbf3fULL, 0x800df27b28886e2aULL, 0x8aeb1afee15251daULL, 0xb018565bac679a4bULL, },
+      { 0x66ddff06c3478212ULL, 0x66632817b1e90a73ULL, 0xd5991d8c5120dc53ULL, 0x5257f847945e9838ULL, 0xca8642ba11df603aULL, 0x68b4080243f94d89ULL, 0x31a4c9775718d85aULL, 0xa2f4e7cf4e228a76ULL, 0x50bae42b562f4ea5ULL, 0xea8eef4d9ad290a4ULL, },
+      { 0x91686dbeb94a3b87ULL, 0xb7909fb07e2ea215ULL, 0xb80850dc6ea440dbULL, 0x9aa59389a42a1dc5ULL, 0x0ddd9f83914ed8f0ULL, 0xcb74f1155e10c73aULL, 0xad1cb938df9e348bULL, 0x4338bdbde0deaa09ULL, 0xaf8d91449c33d240ULL, 0x9c37357b11917f99ULL, },
+      { 0xc2bc7f784b2daf5aULL, 0x7c15f408b70d560aULL, 0xed627644bd67d7c5ULL, 0x6c23c3acf0cf24a6ULL, 0x2da96b246d340bfdULL, 0x4ea817bda6636350ULL, 0x457ef5bfd2d17cceULL, 0xbf3a62831b1809f7ULL, 0x2d286e6b1dd6f307ULL, 0xd014396089ba04e3ULL, },
+      { 0x2158ac3ca81fea57ULL, 0x7418671869b6291cULL, 0xc81068318fd1d8d2ULL, 0x25de2a1f70306c9eULL, 0x22fdbe6f00017f39ULL, 0xf512db0c07bc3bcfULL, 0x361feca328ca9688ULL, 0x1c1d866dca7a6406ULL, 0xec28ae642d122f98ULL, 0x8a9497dd6de0b0a2ULL, },
+      { 0xf0a061d545850478ULL, 0xe8a04a3a8b7b9d80ULL, 0x306139f5e3a1efe6ULL, 0x58044e79103bec79ULL, 0xe1d58c5c6a38562cULL, 0x50fb68c98e7c8b80ULL, 0xe03be40a216f18eaULL, 0x677d1721ee7416ccULL, 0x91944841e5eae745ULL, 0xb896c374cd21affeULL, },
+      { 0xedc73c55cdbbe712ULL, 0xb2a191792c21632bULL, 0xa19b979c8e1ff066ULL, 0x999becd31c600c5cULL, 0x535bdb8576063180ULL, 0x7bde8404f4e42ed3ULL, 0x0f20ea91baeaf60dULL, 0x886ccdbde03685c6ULL, 0xfec3c3c7faec91f9ULL, 0xf5df444f2db7a484ULL, },
+      { 0x2dd5d73678f67d10ULL, 0x00bd9ebfd9590a31ULL, 0x2885a8c0962cdba8ULL, 0xccb91e5ee61275d0ULL, 0x76c428b8b7362ca2ULL, 0xd1f54e6f53fdf9afULL, 0x77b016126b7dce5eULL, 0x21f3f16dd7d41194ULL, 0x8ff00bde045b0133ULL, 0xa3c029e5d0ab050aULL, },
+      { 0x3e3d29de273ba151ULL, 0x279066967aca0a54ULL, 0x8370f34af79cbbd3ULL, 0x2878125422f9772bULL, 0xecad9663825a58afULL, 0x4fac47c64b7837b0ULL, 0xe2e5318567a20fdaULL, 0x237b2d7da2c2f3b2ULL, 0x5131f0663c7c2877ULL, 0xda1d96b32933fcb8ULL, },
+      { 0x8579e916c528f162ULL, 0x855bb74716510fcdULL, 0x1fc920cbfeba2442ULL, 0x16c9bdcb9e412235ULL, 0x9d723d50a14bfc89ULL, 0xddf062d44977a8faULL, 0xb1f1db3ae0d9e458ULL, 0x7a8186333a26a119ULL, 0xe407c8ed31acd0b6ULL, 0x9143c9b2b07d0fb6ULL, },
+      { 0x9dd75e9c7f0cdd25ULL, 0x88756d90d425ec38ULL, 0x5cb327c2c32a675eULL, 0xd780528bd5c97bfcULL, 0x2366caf923bd5487ULL, 0xc0a070abebc9bd93ULL, 0x81d779653a267f64ULL, 0x45a474ffeb3e5678ULL, 0x2b301e1f3cb8aeacULL, 0xc17e126be0d0203cULL, },
+      { 0xf697a137bcb4a46aULL, 0x803a8b92d3f108e2ULL, 0xfd4199b4237fa993ULL, 0xa402465eaa3fefb3ULL, 0x9f874910d9fd045aULL, 0x2aceeeae7251cbbfULL, 0x09d34932017864a6ULL, 0xf51d077c59dfd9e3ULL, 0xedc0a6d1014c3a3fULL, 0x80dda6a59d4f201eULL, },
+      { 0xd8624e68ee1a123cULL, 0xbe0f54e9cada261fULL, 0xf4bfb0a735349a4aULL, 0xffdcae4b2f3be768ULL, 0x0766caea9154868dULL, 0x976ab31d4c14df5bULL, 0xe5297c834a37c3d6ULL, 0x86253f84a0355afcULL, 0x01e3138f31faef6dULL, 0xaba62918419835c3ULL, },
+      { 0xbc5ce9b57d9441f6ULL, 0x1672cd3099d15a80ULL, 0x96601616e8dcd540ULL, 0x2dcec69b2d977000ULL, 0x9956e7c6618561abULL, 0xf5877a8b5a7c2bfeULL, 0x625682d6571a59d7ULL, 0xfb81da2263f00605ULL, 0x1cf0eed7e83f1ac1ULL, 0xe4a2e299261eb950ULL, },
+      { 0x3f70f7943304fb7aULL, 0xcfbf575f3ea82916ULL, 0xaf2e22611fb6d29aULL, 0xe4b222e2b87230e1ULL, 0xa8a05f020769d5f9ULL, 0x750449e2dae261abULL, 0x101a6f208602f476ULL, 0x9a352a0c1a8af5edULL, 0x4479238d7f53d58eULL, 0x98458567797efa7fULL, },
+      { 0x3274e5a1097f043bULL, 0x48f72c5f1da291c1ULL, 0x01f3ad48fc7b34f3ULL, 0x53976fdd46d8a49cULL, 0x0021b5a807f6d594ULL, 0xb392a1ca5592646dULL, 0xd6d2d7000241f5e7ULL, 0xa42d56960c692732ULL, 0xc128d409a6cbb9b6ULL, 0xcad35257b6665546ULL, },
+      { 0xcef8515b0ad2ea32ULL, 0xb9d2688bc1db2c8fULL, 0x4cc7a88227da1dacULL, 0xc028da025e6f00ecULL, 0x0e9606536890b708ULL, 0xf295b89a9169cb8aULL, 0xfd86c9eba6f50a0aULL, 0xb581b1889b69f6c2ULL, 0x455c5d87c8236c24ULL, 0x8714e3a81d3d8ccdULL, },
+      { 0xcc44137181e1efd2ULL, 0xd68ea0b7ecde6ff8ULL, 0xe7b03a09d53e104bULL, 0x3dbf5d14225dddabULL, 0x89864f596cb40a40ULL, 0x4a4c91b4d3762876ULL, 0xccd058a0f93b5301ULL, 0x92acba40e4ed5918ULL, 0x9422a7021cc60de4ULL, 0xb3edaff543f6e9acULL, },
+      { 0x6a5fa1e2df27c072ULL, 0x457b860861a373c6ULL, 0x554df611c5327a58ULL, 0x2909c119b3631ec6ULL, 0x96d55b1825ba6c04ULL, 0xbf16c8e46858debdULL, 0x3c5a79f23227a1bdULL, 0x6bca7a41f22b283eULL, 0x9afd38e9625d5c96ULL, 0xefaa176306e6f22cULL, },
+      { 0x14d5bf55f9b50db3ULL, 0x54d361c9c6afe022ULL, 0xc48895232b32a871ULL, 0x8d3be3e471d4a6e3ULL, 0x26057705ce5661e9ULL, 0x9babc45a56f9a897ULL, 0xf4d18ec2081d8347ULL, 0x60336da951fa1ffeULL, 0x60b85d7678faca35ULL, 0x9f9dc62bf874d50dULL, },
+      { 0xad522bcc9e29f7a9ULL, 0x7667530b10c532f5ULL, 0x8198944698fe0e5eULL, 0x3fb1845c110fdf23ULL, 0xc9aa49cf1ac336a8ULL, 0xa05665781378e12bULL, 0x9b76cf413c49d05eULL, 0xfa63b49f9b2caae7ULL, 0x2e29e5ba0582560dULL, 0xd49bd0c6e77a2ddbULL, },
+      { 0xf7d684b2f52d1e86ULL, 0x06585755def9c302ULL, 0xc026959c34ee3f70ULL, 0x47757af5d99d08a1ULL, 0x79ead31ae2883dacULL, 0x39540cecdfeaf8c5ULL, 0x2a505e1ca2d5c797ULL, 0xe7bf300cc1581ddeULL, 0x39dd8b6e91cae0a4ULL, 0x8d98e150d83c6d85ULL, },
+      { 0x7b07c4d6d2ea342fULL, 0x30d2b8f9e93f971dULL, 0x025fbaee7da89862ULL, 0x57bb8e68abf2fe05ULL, 0x1f49c245f47fd1e6ULL, 0x676a584bb696ad39ULL, 0xcda30cb2b187cdf5ULL, 0x959c4f05c526883aULL, 0x46892e830dfba5f0ULL, 0xbc9b72ca30fb4c6dULL, },
+      { 0x8c6cf4caaa76c58eULL, 0x53160e32bcadc375ULL, 0xbed1b604f49539f2ULL, 0x190c16a84b7628d5ULL, 0x5516287ee8d52f23ULL, 0x038160f8b7cd5e0aULL, 0x31e634c35f5e159fULL, 0x0192d8e8edb225bfULL, 0xbacb8680ddc452ddULL, 0xfb397931ae6f2069ULL, },
+      { 0xf6320a54c4157d58ULL, 0x98723c21f7815ed1ULL, 0x406d429634580458ULL, 0x3e1246fc9610e64cULL, 0x4c98200cc4ae1d8dULL, 0x480f3e4d9e0f128aULL, 0x886c94e946c01275ULL, 0xab4414fff41f97e3ULL, 0x9c71424064ad1b15ULL, 0xa750b85952eb89afULL, },
+    };
+  };
+}
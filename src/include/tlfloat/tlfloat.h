@@ -98,7 +98,10 @@ extern "C" {
    * To output a number of type defined in TLFloat library,
    * use _m as the length modifier where m is a decimal integer represents the data size of the corresponding argument in bits.
    * For example, use '\%_256g' to output an octuple-precision FP number, and '\%_128d' to output a 128-bit signed integer.
-   * Q and O modifier have to be used to output an FP number in tlfloat_quad and tlfloat_octuple types, respectively. */
+   * Q and O modifier have to be used to output an FP number in tlfloat_quad and tlfloat_octuple types, respectively.
+   * With the '~' flag, an FP number is output with the minimum number of significant digits that reads back
+   * to the same value. In this case, the precision is only used by the 'g' conversion to choose between
+   * the exponential and the fixed notations, and the precision of the 'e' and 'f' conversions is ignored. */
   int tlfloat_printf(const char *fmt, ...);
 
   /** See explanation for tlfloat_printf() */
@@ -248,6 +251,22 @@ extern "C" {
   int tlfloat_ge_o_o(const tlfloat_octuple_ x, const tlfloat_octuple_ y);
 #endif // #if !defined(TLFLOAT_DOXYGEN)
 
+  /** The tlfloat_gcd family of functions returns the greatest common
+   * divisor of the absolute values of x and y. */
+  tlfloat_int128_t_ tlfloat_gcd_i128_i128(const tlfloat_int128_t_ x, const tlfloat_int128_t_ y);
+  tlfloat_uint128_t_ tlfloat_gcd_u128_u128(const tlfloat_uint128_t_ x, const tlfloat_uint128_t_ y);
+
+  /** This function returns the greatest common divisor g of the
+   * absolute values of x and y, and stores s and t such that x * s +
+   * y * t == g to the locations pointed by the pointer arguments. */
+  tlfloat_int128_t_ tlfloat_extgcd_i128_i128(const tlfloat_int128_t_ x, const tlfloat_int128_t_ y, tlfloat_int128_t_ *s, tlfloat_int128_t_ *t);
+
+  /** The tlfloat_modinv family of functions returns the modular
+   * inverse of x modulo m, which is in [0, m). If x and m are not
+   * coprime or m is smaller than 2, 0 is returned. */
+  tlfloat_int128_t_ tlfloat_modinv_i128_i128(const tlfloat_int128_t_ x, const tlfloat_int128_t_ m);
+  tlfloat_uint128_t_ tlfloat_modinv_u128_u128(const tlfloat_uint128_t_ x, const tlfloat_uint128_t_ m);
+
   //
 
   float tlfloat_addf(const float x, const float y);
@@ -679,6 +698,79 @@ extern "C" {
   tlfloat_octuple_ tlfloat_remaindero(const tlfloat_octuple_ x, const tlfloat_octuple_ y);
   tlfloat_quad_ tlfloat_remquoq(const tlfloat_quad_ x, const tlfloat_quad_ y, int *quo);
   tlfloat_octuple_ tlfloat_remquoo(const tlfloat_octuple_ x, const tlfloat_octuple_ y, int *quo);
+
+  // Array versions : dst[i] = f(x[i], y[i], ...) for 0 <= i < n
+
+  void tlfloat_addq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n);
+  void tlfloat_addo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n);
+  void tlfloat_subq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n);
+  void tlfloat_subo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n);
+  void tlfloat_mulq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n);
+  void tlfloat_mulo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n);
+  void tlfloat_divq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n);
+  void tlfloat_divo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n);
+  void tlfloat_fmaq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, const tlfloat_quad_ *z, size_t n);
+  void tlfloat_fmao_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, const tlfloat_octuple_ *z, size_t n);
+  void tlfloat_sqrtq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_sqrto_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_negq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_nego_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_fabsq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_fabso_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_copysignq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n);
+  void tlfloat_copysigno_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n);
+  void tlfloat_fmaxq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n);
+  void tlfloat_fmaxo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n);
+  void tlfloat_fminq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n);
+  void tlfloat_fmino_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n);
+  void tlfloat_fdimq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n);
+  void tlfloat_fdimo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n);
+  void tlfloat_hypotq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n);
+  void tlfloat_hypoto_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n);
+  void tlfloat_truncq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_trunco_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_floorq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_flooro_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_ceilq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_ceilo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_roundq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_roundo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_rintq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_rinto_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_sinq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_sino_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_cosq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_coso_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_tanq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_tano_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_sinpiq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_sinpio_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_cospiq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_cospio_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_tanpiq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_tanpio_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_sincosq_n(tlfloat_quad_ *s, tlfloat_quad_ *c, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_sincoso_n(tlfloat_octuple_ *s, tlfloat_octuple_ *c, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_sincospiq_n(tlfloat_quad_ *s, tlfloat_quad_ *c, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_sincospio_n(tlfloat_octuple_ *s, tlfloat_octuple_ *c, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_expq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_expo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_expm1q_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_expm1o_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_exp2q_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_exp2o_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_exp10q_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_exp10o_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_logq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_logo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_log1pq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_log1po_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_log2q_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_log2o_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_log10q_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n);
+  void tlfloat_log10o_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n);
+  void tlfloat_powq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n);
+  void tlfloat_powo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n);
 #endif // #if !defined(TLFLOAT_DOXYGEN)
 
 #ifdef __cplusplus
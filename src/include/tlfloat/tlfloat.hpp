@@ -10,6 +10,7 @@
 #include <cstdio>
 
 #include <tlfloat/bigint.hpp>
+#include <tlfloat/pow10tab.hpp>
 
 #ifndef TLFLOAT_FP_NAN
 #define TLFLOAT_FP_NAN 0
@@ -119,6 +120,15 @@ namespace tlfloat {
       return BigUInt<N+1>::mul(x, y);
     }
 
+    static constexpr TLFLOAT_INLINE uint32_t sqr(uint16_t x) { return mul(x, x); }
+    static constexpr TLFLOAT_INLINE uint64_t sqr(uint32_t x) { return mul(x, x); }
+    static constexpr TLFLOAT_INLINE BigUInt<7> sqr(uint64_t x) { return mul(x, x); }
+
+    template<int N>
+    static constexpr TLFLOAT_INLINE BigUInt<N+1> sqr(const BigUInt<N>& x) {
+      return BigUInt<N+1>::sqr(x);
+    }
+
     //
 
     static constexpr TLFLOAT_INLINE xpair<uint16_t, uint16_t> divmod2(uint16_t x_, uint16_t y_) {
@@ -144,6 +154,12 @@ namespace tlfloat {
     static constexpr TLFLOAT_INLINE xpair<BigUInt<N>, BigUInt<N>> divmod2(const BigUInt<N>& x, const BigUInt<N>& y) {
 #if defined(_MSC_VER) && !defined(__clang__) // This is required to avoid ICE
       return x.divmod2(y, y.reciprocal2());
+#elif defined(TLFLOAT_ENABLE_NEWTON_DIVISION)
+      if constexpr (N == 7 || N == 8) {
+	return x.divmod2Newton(y);
+      } else {
+	return x.divmod2(y);
+      }
 #else
       return x.divmod2(y);
 #endif
@@ -227,7 +243,7 @@ namespace tlfloat {
       if (!std::is_constant_evaluated()) assert(s >= (BigUInt<N>(1) << ((1 << N)-2)));
       BigUInt<N-1> t = (s + (BigUInt<N>(1) << ((1 << (N-1))-1))).high;
       t = irsqrt(BigUInt<N-1>(t - (t == 0)));
-      BigUInt<N+1> u = (t * ((BigUInt<N>(0xc) << ((1 << N)-4)) - ((BigUInt<N+1>::mul(BigUInt<N>::mul(t, t), s) + (BigUInt<N>(1) << ((1 << N)-1))) >> (1 << N))) + (BigUInt<N>(1) << ((1 << (N-1))-2))) >> ((1 << (N-1))-1);
+      BigUInt<N+1> u = (t * ((BigUInt<N>(0xc) << ((1 << N)-4)) - ((BigUInt<N+1>::mul(BigUInt<N>::sqr(t), s) + (BigUInt<N>(1) << ((1 << N)-1))) >> (1 << N))) + (BigUInt<N>(1) << ((1 << (N-1))-2))) >> ((1 << (N-1))-1);
       return u.high.isZero() ? u.low : ~BigUInt<N>(0U);
     }
 
@@ -257,6 +273,160 @@ namespace tlfloat {
     }
 #endif // #ifndef TLFLOAT_ENABLE_INTSQRT
 
+    // Helper functions for the shortest decimal conversion
+
+    static constexpr TLFLOAT_INLINE int flog10pow2(int e) { // floor(log10(2^e))
+      return int((e * int64_t(661971961083)) >> 41);
+    }
+
+    static constexpr TLFLOAT_INLINE int flog10threeQuartersPow2(int e) { // floor(log10(3/4 * 2^e))
+      return int((e * int64_t(661971961083) - int64_t(274743187321)) >> 41);
+    }
+
+    static constexpr TLFLOAT_INLINE int flog2pow10(int e) { // floor(log2(10^e))
+      return int((e * int64_t(913124641741)) >> 38);
+    }
+
+    template<typename T>
+    static constexpr TLFLOAT_INLINE uint64_t getWord64(const T& x, unsigned idx) {
+      if constexpr (std::is_integral_v<T>) {
+	return uint64_t(x);
+      } else {
+	return x.getWord(idx);
+      }
+    }
+
+    template<typename T>
+    static constexpr TLFLOAT_INLINE void setWord64(T& x, unsigned idx, uint64_t u) {
+      if constexpr (std::is_integral_v<T>) {
+	x = T(u);
+      } else {
+	x.setWord(idx, u);
+      }
+    }
+
+    template<typename T>
+    static constexpr TLFLOAT_INLINE T divmod64(const T& x, const BigUInt<6>::Divisor& d, uint64_t *rem) {
+      if constexpr (std::is_integral_v<T>) {
+	*rem = uint64_t(x) % d.d;
+	return T(uint64_t(x) / d.d);
+      } else {
+	auto a = d.divmod(x);
+	*rem = a.second;
+	return a.first;
+      }
+    }
+
+    template<int NW>
+    static constexpr bool pow10gSupported(int kmin, int kmax) {
+      if constexpr (NW < tlfloat_pow10tab_a_words) {
+	return (kmin >> tlfloat_pow10tab_a_shift) >= tlfloat_pow10tab_a_min && (kmax >> tlfloat_pow10tab_a_shift) <= tlfloat_pow10tab_a_max;
+      } else {
+	static_assert(NW < tlfloat_pow10tab_b_words);
+	return (kmin >> tlfloat_pow10tab_b_shift) >= tlfloat_pow10tab_b_min && (kmax >> tlfloat_pow10tab_b_shift) <= tlfloat_pow10tab_b_max;
+      }
+    }
+
+    /**
+     * Computes g = floor(10^k * 2^(64*NW-1-flog2pow10(k))) + 1. An
+     * entry for 10^(k - k mod step) is read from pow10tab.hpp,
+     * multiplied by 10^(k mod step) and truncated. If 10^k *
+     * 2^(64*NW-1-flog2pow10(k)) is an integer, g is set to that
+     * value without adding 1, and true is returned.
+     */
+    template<int NW>
+    static constexpr TLFLOAT_INLINE bool pow10g(uint64_t (&g)[NW], const int k) {
+      constexpr bool large = NW >= tlfloat_pow10tab_a_words;
+      constexpr int TW = large ? tlfloat_pow10tab_b_words : tlfloat_pow10tab_a_words;
+      constexpr int shift = large ? tlfloat_pow10tab_b_shift : tlfloat_pow10tab_a_shift;
+
+      uint64_t x[TW + ((1 << shift) - 1) / 19 + 1] = {};
+
+      if constexpr (large) {
+	for(int i=0;i<TW;i++) x[i] = tlfloat_pow10tab_b[(k >> shift) - tlfloat_pow10tab_b_min][i];
+      } else {
+	for(int i=0;i<TW;i++) x[i] = tlfloat_pow10tab_a[(k >> shift) - tlfloat_pow10tab_a_min][i];
+      }
+
+      int n = TW;
+      for(int j = k & ((1 << shift) - 1);j > 0;) {
+	uint64_t m = 1;
+	for(int i=0;i<19 && j > 0;i++, j--) m *= 10;
+	uint64_t carry = 0;
+	for(int i=0;i<n;i++) {
+	  xpair<uint64_t, uint64_t> p = mul128(x[i], m);
+	  xpair<uint64_t, bool> a = adc64(false, p.second, carry);
+	  x[i] = a.first;
+	  carry = p.first + a.second;
+	}
+	x[n++] = carry;
+      }
+      while(x[n-1] == 0) n--;
+
+      const unsigned z = clz64(x[n-1]);
+      const int b = n - 1 - NW;
+      for(int i=0;i<NW;i++) g[i] = z == 0 ? x[b+1+i] : ((x[b+i] >> (64 - z)) | (x[b+1+i] << z));
+
+      const bool exact = k >= 0 && flog2pow10(k) - k < 64 * NW;
+      if (!exact) {
+	for(int i=0;i<NW;i++) if (++g[i] != 0) break;
+      }
+      return exact;
+    }
+
+    /** Computes the full product p = g * c of little-endian word arrays */
+    template<int NW, int CW>
+    static constexpr TLFLOAT_INLINE void mulWords(uint64_t (&p)[NW + CW], const uint64_t (&g)[NW], const uint64_t (&c)[CW]) {
+      for(int i=0;i<NW+CW;i++) p[i] = 0;
+
+      for(int j=0;j<CW;j++) {
+	uint64_t carry = 0;
+	for(int i=0;i<NW;i++) {
+	  xpair<uint64_t, uint64_t> m = mul128(g[i], c[j]);
+	  xpair<uint64_t, bool> a = adc64(false, p[i+j], m.second);
+	  xpair<uint64_t, bool> b = adc64(false, a.first, carry);
+	  p[i+j] = b.first;
+	  carry = m.first + a.second + b.second;
+	}
+	p[NW+j] = carry;
+      }
+    }
+
+    /**
+     * Returns floor(g * cp / 2^(64*NW+1)), with the least significant
+     * bit set if the rounded-off part is not zero (rounding to odd).
+     * If g is not exact, the product is regarded as an integer when
+     * the rounded-off part is smaller than cp, since then the error
+     * of g is the only reason for that part to be non-zero.
+     */
+    template<int NW, typename T>
+    static constexpr TLFLOAT_INLINE T rop(const uint64_t (&g)[NW], const T& cp, const bool exact) {
+      constexpr int CW = sizeof(T) / 8;
+      uint64_t c[CW], p[NW + CW];
+      for(int j=0;j<CW;j++) c[j] = getWord64(cp, j);
+      mulWords(p, g, c);
+
+      T r = 0;
+      for(int i=0;i<CW;i++) setWord64(r, i, (p[NW+i] >> 1) | (i+1 < CW ? p[NW+i+1] << 63 : 0));
+
+      bool sticky = (p[NW] & 1) != 0;
+      if (exact) {
+	for(int i=0;i<NW;i++) sticky = sticky || p[i] != 0;
+      } else {
+	for(int i=NW-1;i>=CW;i--) sticky = sticky || p[i] != 0;
+	if (!sticky) {
+	  sticky = true;
+	  for(int i=CW-1;i>=0;i--) {
+	    const uint64_t c = getWord64(cp, i);
+	    if (p[i] != c) { sticky = p[i] > c; break; }
+	  }
+	}
+      }
+
+      if (sticky) setWord64(r, 0, getWord64(r, 0) | 1);
+      return r;
+    }
+
     template<typename mant_t, typename longmant_t, int nbexp, int nbmant>
     class UnpackedFloat {
       template<typename, typename, int, int> friend class UnpackedFloat;
@@ -502,7 +672,7 @@ namespace tlfloat {
 	  if (lhs.isinf || rhs.isinf) return infinity(lhs.sign != rhs.sign);
 	}
 
-	longmant_t am = mul(lhs.mant, rhs.mant);
+	longmant_t am = &lhs == &rhs ? sqr(lhs.mant) : mul(lhs.mant, rhs.mant);
 
 	const int x = (int)clz(am) - ((int)sizeof(mant_t)*8 - nbmant) * 2;
 	am = am << (x + sizeof(mant_t)*8 - nbmant + 1);
@@ -822,6 +992,8 @@ namespace tlfloat {
 	    e += xstrtoll(&ptr[i+1], &ptr);
 	    break;
 	  }
+	  ptr += i;
+	  break;
 	}
 
 	n *= UnpackedFloat::exp10i(e);
@@ -831,6 +1003,170 @@ namespace tlfloat {
 	if (endptr) *endptr = ptr;
       }
 
+      /**
+       * Converts a decimal string with at most 38 significant digits
+       * to the nearest value of this type, in the way of the
+       * Eisel-Lemire algorithm. The digits are multiplied by a
+       * truncated power of ten from pow10tab.hpp, and the result is
+       * rounded if the error of the power of ten cannot change the
+       * rounding. False is returned without setting r when the string
+       * is not such a decimal number, the rounding is ambiguous, or
+       * the result is not a normal number.
+       */
+      static constexpr bool parseDecimalFast(UnpackedFloat &r, const char *ptr, const char **endptr=nullptr) {
+	static_assert(nbexp != 0);
+	constexpr int NW = (nbmant + 2 + 12 + 63) / 64;
+	static_assert(64 * NW - nbmant >= 14);
+
+	while(xisspace(*ptr)) ptr++;
+
+	bool positive = true;
+	if (*ptr == '-') {
+	  positive = false; ptr++;
+	} else if (*ptr == '+') {
+	  ptr++;
+	}
+
+	if (*ptr == '0' && (*(ptr+1) == 'x' || *(ptr+1) == 'X')) return false;
+
+	// The digits are accumulated into a 128-bit integer w, and the
+	// value is w * 10^k
+
+	uint64_t w[2] = { 0, 0 };
+	int64_t k = 0;
+	int nd = 0, nz = 0;
+	bool bp = false, any = false;
+
+	for(;;ptr++) {
+	  const char c = *ptr;
+	  if (c == '.' && !bp) { bp = true; continue; }
+	  if (c < '0' || c > '9') break;
+	  any = true;
+	  if (bp) k--;
+	  if (c == '0') {
+	    if (nd != 0) nz++;
+	    continue;
+	  }
+	  if (nd + nz >= 38) return false;
+	  for(int d = nz;d >= 0;d--) {
+	    xpair<uint64_t, uint64_t> m = mul128(w[0], 10);
+	    xpair<uint64_t, bool> a = adc64(false, m.second, d == 0 ? uint64_t(c - '0') : 0);
+	    w[0] = a.first;
+	    w[1] = w[1] * 10 + m.first + a.second;
+	  }
+	  nd += nz + 1;
+	  nz = 0;
+	}
+
+	if (!any) return false;
+	k += nz;
+
+	if (*ptr == 'e' || *ptr == 'E') {
+	  const char *q = ptr + 1;
+	  bool eneg = false;
+	  if (*q == '-') {
+	    eneg = true; q++;
+	  } else if (*q == '+') {
+	    q++;
+	  }
+	  if ('0' <= *q && *q <= '9') {
+	    int64_t x = 0;
+	    for(;'0' <= *q && *q <= '9';q++) if (x < 1000000) x = x * 10 + (*q - '0');
+	    k += eneg ? -x : x;
+	    ptr = q;
+	  }
+	}
+
+	if (w[0] == 0 && w[1] == 0) {
+	  r = zero(!positive);
+	  if (endptr) *endptr = ptr;
+	  return true;
+	}
+
+	if (k < -1000000 || k > 1000000 || !pow10gSupported<NW>((int)k, (int)k)) return false;
+
+	// Normalize w so that its MSB is set, and compute p = w * g
+
+	const unsigned lz = w[1] != 0 ? clz64(w[1]) : 64 + clz64(w[0]);
+	if (lz >= 64) {
+	  w[1] = w[0] << (lz - 64);
+	  w[0] = 0;
+	} else if (lz != 0) {
+	  w[1] = (w[1] << lz) | (w[0] >> (64 - lz));
+	  w[0] <<= lz;
+	}
+
+	// When the rounding is ambiguous with the shortest power of ten,
+	// it is tried again with one more word, which leaves only values
+	// extremely close to a midpoint to the slow path
+
+	int c = roundDecimal<NW>(r, w, (int)k, lz, positive);
+	if (c == 0 && pow10gSupported<NW + 1>((int)k, (int)k)) c = roundDecimal<NW + 1>(r, w, (int)k, lz, positive);
+	if (c != 1) return false;
+
+	if (endptr) *endptr = ptr;
+	return true;
+      }
+
+      /**
+       * Rounds w * 10^k to this type with a power of ten of NW words,
+       * where w is normalized by shifting it left by lz bits. Returns
+       * 1 with r set, 0 if the rounding is ambiguous, or -1 if the
+       * result is not a normal number.
+       */
+      template<int NW>
+      static constexpr int roundDecimal(UnpackedFloat &r, const uint64_t (&w)[2], const int k, const unsigned lz, const bool positive) {
+	uint64_t g[NW], p[NW + 2];
+	const bool exact = pow10g(g, k);
+	mulWords(p, g, w);
+
+	// The bits from t down to sh are the mantissa and the round bit
+
+	const int t = 64 * NW + 127 - ((p[NW+1] >> 63) == 0);
+	const int sh = t - nbmant - 1;
+
+	mant_t m = 0;
+	for(int j=0;j<(int)(sizeof(mant_t) + 7) / 8;j++) {
+	  const int b = sh + 64 * j, i = b >> 6, s = b & 63;
+	  if (i > NW + 1) break;
+	  uint64_t u = p[i] >> s;
+	  if (s != 0 && i + 1 <= NW + 1) u |= p[i+1] << (64 - s);
+	  setWord64(m, j, u);
+	}
+
+	// rest is the part below the round bit. When g is not exact,
+	// the true product is in [p - w, p), and the rounding is
+	// ambiguous if p is above a midpoint by less than w.
+
+	const int sw = sh >> 6;
+	bool restAbove128IsZero = (p[sw] & ((uint64_t(1) << (sh & 63)) - 1)) == 0;
+	for(int i=2;i<sw;i++) restAbove128IsZero = restAbove128IsZero && p[i] == 0;
+	const bool restIsZero = restAbove128IsZero && p[1] == 0 && p[0] == 0;
+	const bool restLessThanW = restAbove128IsZero && (p[1] < w[1] || (p[1] == w[1] && p[0] < w[0]));
+
+	const bool roundbit = (getWord64(m, 0) & 1) != 0;
+	m >>= 1;
+
+	if (exact) {
+	  if (roundbit && (!restIsZero || (getWord64(m, 0) & 1) != 0)) m += 1;
+	} else {
+	  if (roundbit && restLessThanW) return 0;
+	  if (roundbit) m += 1;
+	}
+
+	int q = sh + 2 + flog2pow10(k) - 64 * NW - (int)lz;
+	if (m == (mant_t(2) << nbmant)) {
+	  m >>= 1;
+	  q++;
+	}
+
+	const int e = q + expoffset() + nbmant - 1;
+	if (e < 0 || e > (1 << nbexp) - 3) return -1;
+
+	r = UnpackedFloat(m, e, !positive, false, false, false);
+	return 1;
+      }
+
       template<typename floattype, std::enable_if_t<!std::is_pointer_v<floattype>, int> = 0>
       constexpr TLFLOAT_INLINE UnpackedFloat(const floattype &fl) :
 	exp(int32_t(expBits(fl) - (expBits(fl) != 0))),
@@ -1265,6 +1601,66 @@ namespace tlfloat {
 	return ret;
       }
 
+      /**
+       * Returns (d, e) such that d * 10^e is the shortest decimal
+       * representation of this value that is converted back to this
+       * value. If there are more than one such representation, the
+       * one closest to this value is chosen. This value must be
+       * finite and non-zero, and its sign is ignored. The algorithm is
+       * based on Schubfach by Raffaello Giulietti, and the precision
+       * of the power of ten is twice the precision of this type plus
+       * 64 bits.
+       */
+      constexpr xpair<mant_t, int> toDecimal() const {
+	static_assert(nbexp != 0);
+	typedef std::conditional_t<(sizeof(mant_t) < 8), uint64_t, mant_t> dec_t;
+	constexpr int NW = (2 * (nbmant + 1) + 127) / 64;
+	constexpr int qmin = 1 - expoffset() - nbmant, qmax = (1 << nbexp) - 2 - expoffset() - nbmant;
+	static_assert(pow10gSupported<NW>(-flog10pow2(qmax), -flog10threeQuartersPow2(qmin)));
+
+	const int q = exp + 1 - expoffset() - nbmant;
+	const dec_t c = dec_t(mant), cb = c << 2, cbr = cb + 2, out = c & 1;
+	dec_t cbl = cb - 2;
+	int k = flog10pow2(q);
+	if (mant == (mant_t(1) << nbmant) && exp != 0) {
+	  cbl = cb - 1;
+	  k = flog10threeQuartersPow2(q);
+	}
+	const int h = q + flog2pow10(-k) + 2;
+
+	uint64_t g[NW];
+	const bool exact = pow10g(g, -k);
+	const dec_t vb = rop(g, cb << h, exact), vbl = rop(g, cbl << h, exact), vbr = rop(g, cbr << h, exact);
+
+	constexpr BigUInt<6>::Divisor ten(10);
+	uint64_t r = 0;
+	const dec_t s = vb >> 2, sp10 = divmod64(s, ten, &r) * 10, tp10 = sp10 + 10;
+	const bool upin = vbl + out <= (sp10 << 2), wpin = (tp10 << 2) + out <= vbr;
+
+	dec_t d = s;
+	if (upin != wpin) {
+	  d = upin ? sp10 : tp10;
+	} else {
+	  const dec_t t = s + 1;
+	  const bool uin = vbl + out <= (s << 2), win = (t << 2) + out <= vbr;
+	  if (uin != win) {
+	    d = uin ? s : t;
+	  } else {
+	    const dec_t m = (s + t) << 1;
+	    d = (vb < m || (vb == m && (s & 1) == 0)) ? s : t;
+	  }
+	}
+
+	for(;;) {
+	  const dec_t u = divmod64(d, ten, &r);
+	  if (r != 0) break;
+	  d = u;
+	  k++;
+	}
+
+	return xpair<mant_t, int>(mant_t(d), k);
+      }
+
       TLFLOAT_NOINLINE friend int snprint(char *cbuf, const size_t bufsize,
 					  UnpackedFloat arg, char typespec, int width = 0, int precision = 6,
 					  bool flag_sign = false, bool flag_blank = false, bool flag_alt = false,
@@ -1279,7 +1675,7 @@ namespace tlfloat {
 
 	int64_t idx = 0;
 	char prefix = 0;
-	int length = 0, flag_rtz = 0, mainpos = 0;
+	int flag_rtz = 0, mainpos = 0;
 
 	if (arg.sign) {
 	  arg.sign = 0;
@@ -1429,8 +1825,102 @@ namespace tlfloat {
 	}
 
 	buf[idx] = '\0';
-	length = idx;
 
+	if (prefix != 0 && typespec != 'a') mainpos++;
+
+	return pad(buf, idx, width, mainpos, flag_left, flag_zero);
+      }
+
+      /**
+       * Prints the shortest decimal representation of arg that is
+       * converted back to arg. The precision is ignored except that,
+       * for 'g', the exponential notation is used if the decimal
+       * exponent is less than -4 or not less than the larger of the
+       * precision and the number of digits. Other arguments are the
+       * same as snprint.
+       */
+      TLFLOAT_NOINLINE friend int snprintShortest(char *cbuf, const size_t bufsize,
+						  UnpackedFloat arg, char typespec, int width = 0, int precision = -1,
+						  bool flag_sign = false, bool flag_blank = false, bool flag_alt = false,
+						  bool flag_left = false, bool flag_zero = false, bool flag_upper = false) {
+	if (arg.isnan || arg.isinf || typespec == 'a') {
+	  return snprint(cbuf, bufsize, arg.cast((decltype(xUnpackedFloat()) *)0), typespec, width, -1,
+			 flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
+	}
+
+	if (bufsize == 0) return 0;
+	if (bufsize == 1) { *cbuf = '\0'; return 0; }
+	if (typespec != 'e' && typespec != 'f' && typespec != 'g') return 0;
+
+	detail::SafeArray<char> buf(cbuf, bufsize);
+
+	if (width > (long)bufsize) width = bufsize;
+
+	char digits[(nbmant + 5) * 3 / 10 + 21];
+	int ndigits = 0, exp = 0;
+
+	if (arg.iszero) {
+	  digits[ndigits++] = '0';
+	} else {
+	  constexpr BigUInt<6>::Divisor e19(10000000000000000000ULL);
+	  xpair<mant_t, int> d = arg.toDecimal();
+	  int pos = sizeof(digits);
+	  do {
+	    uint64_t r = 0;
+	    d.first = divmod64(d.first, e19, &r);
+	    for(int i=0;i<19 && !(d.first == 0 && r == 0);i++, r /= 10) digits[--pos] = '0' + (r % 10);
+	  } while(!(d.first == 0));
+	  ndigits = sizeof(digits) - pos;
+	  for(int i=0;i<ndigits;i++) digits[i] = digits[pos + i];
+	  exp = d.second + ndigits - 1;
+	}
+
+	if (typespec == 'g') {
+	  if (precision < 0) precision = 6;
+	  if (precision == 0) precision = 1;
+	  typespec = (exp < -4 || exp >= (ndigits > precision ? ndigits : precision)) ? 'e' : 'f';
+	}
+
+	int64_t idx = 0;
+
+	if (arg.sign) {
+	  buf[idx++] = '-';
+	} else if (flag_sign) {
+	  buf[idx++] = '+';
+	} else if (flag_blank) {
+	  buf[idx++] = ' ';
+	}
+
+	const int mainpos = idx;
+
+	if (typespec == 'e') {
+	  buf[idx++] = digits[0];
+	  if (ndigits > 1 || flag_alt) buf[idx++] = '.';
+	  for(int i=1;i<ndigits;i++) buf[idx++] = digits[i];
+
+	  char str[32];
+	  snprintf(str, sizeof(str), "%c%+03d", flag_upper ? 'E' : 'e', exp);
+	  buf.strcpyFrom(idx, str);
+	  idx += strlen(str);
+	} else if (exp < 0) {
+	  buf[idx++] = '0';
+	  buf[idx++] = '.';
+	  for(int i=-1;i>exp;i--) buf[idx++] = '0';
+	  for(int i=0;i<ndigits;i++) buf[idx++] = digits[i];
+	} else {
+	  for(int i=0;i<=exp;i++) buf[idx++] = i < ndigits ? digits[i] : '0';
+	  if (ndigits > exp + 1 || flag_alt) buf[idx++] = '.';
+	  for(int i=exp+1;i<ndigits;i++) buf[idx++] = digits[i];
+	}
+
+	buf[idx] = '\0';
+
+	return pad(buf, idx, width, mainpos, flag_left, flag_zero);
+      }
+
+    private:
+      // Pads the string in buf to width. Zeros are inserted at mainpos.
+      static int pad(detail::SafeArray<char> &buf, int64_t length, int width, int mainpos, bool flag_left, bool flag_zero) {
 	if (!flag_zero) mainpos = 0;
 
 	if (!flag_left && length < width) {
@@ -1438,7 +1928,6 @@ namespace tlfloat {
 	  for(int i=width; i-nPad >= mainpos; i--) buf[i] = buf[i-nPad];
 
 	  int i = mainpos;
-	  if (prefix != 0 && flag_zero && typespec != 'a') i++;
 	  while (nPad-- > 0) buf[i++] = flag_zero ? '0' : ' ';
 	  length = width;
 	}
@@ -1580,7 +2069,12 @@ namespace tlfloat {
 
     /** This works like strtod */
     constexpr TLFloat(const char *ptr, const char **endptr=nullptr) {
-      *this = TLFloat(xUnpacked_t(ptr, endptr).cast((Unpacked_t *)nullptr));
+      Unpacked_t u = Unpacked_t::zero();
+      if (Unpacked_t::parseDecimalFast(u, ptr, endptr)) {
+	*this = TLFloat(u);
+      } else {
+	*this = TLFloat(xUnpacked_t(ptr, endptr).cast((Unpacked_t *)nullptr));
+      }
     }
 
     explicit constexpr TLFLOAT_INLINE operator Unpacked_t() const { return Unpacked_t(m); }
@@ -1618,7 +2112,10 @@ namespace tlfloat {
     constexpr TLFloat operator-(const TLFloat& rhs) const { return getUnpacked() - rhs.getUnpacked(); }
 
     /** This function performs multiplication of two floating point numbers. This function returns correctly rounded results. */
-    constexpr TLFloat operator*(const TLFloat& rhs) const { return getUnpacked() * rhs.getUnpacked(); }
+    constexpr TLFloat operator*(const TLFloat& rhs) const {
+      if (this == &rhs) { auto u = getUnpacked(); return u * u; }
+      return getUnpacked() * rhs.getUnpacked();
+    }
 
     /** This function performs division of floating point numbers. This function returns correctly rounded results. */
     constexpr TLFloat operator/(const TLFloat& rhs) const { return getUnpacked() / rhs.getUnpacked(); }
@@ -1876,6 +2373,76 @@ namespace tlfloat {
 
   //
 
+  /**
+   * This class holds the result of an arithmetic operation on TLFloat
+   * objects in the unpacked form, so that the next operation in a
+   * chain can use it without unpacking. The value is packed only when
+   * it is converted back to tlfloat_t. Each operation is still rounded
+   * to the precision of tlfloat_t, and thus the results are
+   * bit-identical to the ones computed with TLFloat operators.
+   *
+   * An expression is evaluated in the unpacked form if its first
+   * operand is wrapped with unpacked(), as in `Quad r =
+   * unpacked(a) * b + unpacked(c) * d - e;`.
+   */
+  template<typename tlfloat_t>
+  class UnpackedExpr {
+    typedef decltype(tlfloat_t::to_Unpacked_t()) Unpacked_t;
+
+  public:
+    Unpacked_t u;
+
+    constexpr TLFLOAT_INLINE UnpackedExpr(const UnpackedExpr&) = default;
+    constexpr TLFLOAT_INLINE UnpackedExpr& operator=(const UnpackedExpr&) = default;
+
+    constexpr TLFLOAT_INLINE UnpackedExpr(const Unpacked_t& u_) : u(u_) {}
+    constexpr TLFLOAT_INLINE UnpackedExpr(const tlfloat_t& f) : u(f.getUnpacked()) {}
+
+    /** Packs the value */
+    constexpr TLFLOAT_INLINE operator tlfloat_t() const { return tlfloat_t(u); }
+
+    constexpr TLFLOAT_INLINE UnpackedExpr operator-() const { return -u; }
+    constexpr TLFLOAT_INLINE UnpackedExpr operator+() const { return u; }
+
+    friend constexpr TLFLOAT_INLINE UnpackedExpr operator+(const UnpackedExpr& lhs, const UnpackedExpr& rhs) { return lhs.u + rhs.u; }
+    friend constexpr TLFLOAT_INLINE UnpackedExpr operator-(const UnpackedExpr& lhs, const UnpackedExpr& rhs) { return lhs.u - rhs.u; }
+    friend constexpr TLFLOAT_INLINE UnpackedExpr operator*(const UnpackedExpr& lhs, const UnpackedExpr& rhs) { return lhs.u * rhs.u; }
+    friend constexpr UnpackedExpr operator/(const UnpackedExpr& lhs, const UnpackedExpr& rhs) { return lhs.u / rhs.u; }
+
+    friend constexpr TLFLOAT_INLINE UnpackedExpr operator+(const UnpackedExpr& lhs, const tlfloat_t& rhs) { return lhs.u + rhs.getUnpacked(); }
+    friend constexpr TLFLOAT_INLINE UnpackedExpr operator-(const UnpackedExpr& lhs, const tlfloat_t& rhs) { return lhs.u - rhs.getUnpacked(); }
+    friend constexpr TLFLOAT_INLINE UnpackedExpr operator*(const UnpackedExpr& lhs, const tlfloat_t& rhs) { return lhs.u * rhs.getUnpacked(); }
+    friend constexpr UnpackedExpr operator/(const UnpackedExpr& lhs, const tlfloat_t& rhs) { return lhs.u / rhs.getUnpacked(); }
+
+    friend constexpr TLFLOAT_INLINE UnpackedExpr operator+(const tlfloat_t& lhs, const UnpackedExpr& rhs) { return lhs.getUnpacked() + rhs.u; }
+    friend constexpr TLFLOAT_INLINE UnpackedExpr operator-(const tlfloat_t& lhs, const UnpackedExpr& rhs) { return lhs.getUnpacked() - rhs.u; }
+    friend constexpr TLFLOAT_INLINE UnpackedExpr operator*(const tlfloat_t& lhs, const UnpackedExpr& rhs) { return lhs.getUnpacked() * rhs.u; }
+    friend constexpr UnpackedExpr operator/(const tlfloat_t& lhs, const UnpackedExpr& rhs) { return lhs.getUnpacked() / rhs.u; }
+
+    template<typename rhstype>
+    constexpr TLFLOAT_INLINE UnpackedExpr& operator+=(const rhstype& rhs) { *this = *this + rhs; return *this; }
+    template<typename rhstype>
+    constexpr TLFLOAT_INLINE UnpackedExpr& operator-=(const rhstype& rhs) { *this = *this - rhs; return *this; }
+    template<typename rhstype>
+    constexpr TLFLOAT_INLINE UnpackedExpr& operator*=(const rhstype& rhs) { *this = *this * rhs; return *this; }
+    template<typename rhstype>
+    constexpr UnpackedExpr& operator/=(const rhstype& rhs) { *this = *this / rhs; return *this; }
+
+    /** This function performs the fused multiply-add operation of floating point numbers. This function returns correctly rounded results. */
+    template<typename xtype, typename ytype, typename ztype,
+	     std::enable_if_t<(std::is_convertible_v<xtype, UnpackedExpr> && std::is_convertible_v<ytype, UnpackedExpr> &&
+			       std::is_convertible_v<ztype, UnpackedExpr>), int> = 0>
+    friend constexpr UnpackedExpr fma(const xtype& x, const ytype& y, const ztype& z) {
+      return Unpacked_t::fma(UnpackedExpr(x).u, UnpackedExpr(y).u, UnpackedExpr(z).u);
+    }
+  };
+
+  /** Wraps f with UnpackedExpr so that the following operations are performed in the unpacked form */
+  template<typename Unpacked_t>
+  static constexpr TLFLOAT_INLINE UnpackedExpr<TLFloat<Unpacked_t>> unpacked(const TLFloat<Unpacked_t>& f) { return f; }
+
+  //
+
 #if defined(TLFLOAT_DOXYGEN) || !defined(TLFLOAT_NO_LIBSTDCXX)
 #ifndef TLFLOAT_DOXYGEN
   template<typename mant_t, typename longmant_t, int nbexp, int nbmant>
@@ -1911,6 +2478,15 @@ namespace tlfloat {
     return std::string(buf.data());
   }
 
+  /** This returns the shortest decimal string that reads back to
+   * the same value, formatted like the %g conversion */
+  template<typename Unpacked_t>
+  static std::string to_string_shortest(TLFloat<Unpacked_t> a) {
+    std::vector<char> buf(1000);
+    snprintShortest(buf.data(), buf.size(), a.getUnpacked(), 'g', 0, -1, false, false, false, false, false, false);
+    return std::string(buf.data());
+  }
+
   template<typename Unpacked_t>
   static std::ostream& operator<<(std::ostream &os, const TLFloat<Unpacked_t>& a) {
     typedef decltype(Unpacked_t::xUnpackedFloat()) xUnpacked_t;
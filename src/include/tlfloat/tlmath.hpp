@@ -259,6 +259,35 @@ namespace tlfloat {
       return tlfloat_t(y.cast((const decltype(a.getUnpacked()) *)nullptr));
     }
 
+    template<typename Unpacked_t, unsigned N>
+    static constexpr xpair<Unpacked_t, Unpacked_t> sincos_(const Unpacked_t& a) {
+      const xpair<Unpacked_t, int> p = ph<Unpacked_t>(a, 1);
+
+      constexpr xarray<Unpacked_t, N+1> sinCoef = genSinCoef<Unpacked_t, N>();
+      Unpacked_t s = sinCoef.e[N];
+      for(int i=N-1;i>=0;i--) s = Unpacked_t::fma(s, -p.first * p.first, sinCoef.e[i]);
+      s *= p.first;
+
+      constexpr xarray<Unpacked_t, N+2> cosCoef = genCosCoef<Unpacked_t, N>();
+      Unpacked_t c = cosCoef.e[N+1];
+      for(int i=N-0;i>=0;i--) c = Unpacked_t::fma(c, -p.first * p.first, cosCoef.e[i]);
+
+      if (p.second & 1) { Unpacked_t t = c; c = -s; s = t; }
+      if (p.second & 2) { s = -s; c = -c; }
+
+      return xpair<Unpacked_t, Unpacked_t> { s, c };
+    }
+
+    template<typename tlfloat_t, typename Unpacked_t, unsigned N>
+    static constexpr xpair<tlfloat_t, tlfloat_t> sincos(const tlfloat_t& a) {
+      if (isnan(a)) return xpair<tlfloat_t, tlfloat_t> { a, a };
+      if (isinf(a)) return xpair<tlfloat_t, tlfloat_t> { tlfloat_t::nan(), tlfloat_t::nan() };
+      auto y = sincos_<Unpacked_t, N>(a.getUnpacked().cast((const Unpacked_t *)nullptr));
+      return xpair<tlfloat_t, tlfloat_t> {
+	tlfloat_t(y.first .cast((const decltype(a.getUnpacked()) *)nullptr)),
+	tlfloat_t(y.second.cast((const decltype(a.getUnpacked()) *)nullptr)) };
+    }
+
     //
 
     template<typename Unpacked_t, unsigned N, unsigned M>
@@ -340,6 +369,26 @@ namespace tlfloat {
       return tlfloat_t(z.cast((const decltype(a.getUnpacked()) *)nullptr));
     }
 
+    template<typename tlfloat_t, typename Unpacked_t, unsigned N>
+    static constexpr xpair<tlfloat_t, tlfloat_t> sincospi(const tlfloat_t& a) {
+      if (isnan(a)) return xpair<tlfloat_t, tlfloat_t> { a, a };
+      if (isinf(a)) return xpair<tlfloat_t, tlfloat_t> { tlfloat_t::nan(), tlfloat_t::nan() };
+      auto x = ldexp_(a.getUnpacked().cast((const Unpacked_t *)nullptr), 1), y = ldexp_(x - round(x), -1);
+      int lx = intlsb(ldexp_(x, 1));
+
+      Unpacked_t sp = sinpi_<Unpacked_t, N>(y), cp = cospi_<Unpacked_t, N>(y);
+      Unpacked_t s = ((lx+3)&2) ? sp : cp, c = ((lx+3)&2) ? cp : sp;
+      if ((lx+7)&4) s.sign = !s.sign;
+      if ((lx+1)&4) c.sign = !c.sign;
+
+      if (((lx >= 0 && (lx & 3) == 0) || (lx < 0 && (lx & 3) == 3)) && isint(x)) s = Unpacked_t::zero(x.sign);
+      if (!((lx+3)&2) && y.iszero) c = Unpacked_t::zero(false);
+
+      return xpair<tlfloat_t, tlfloat_t> {
+	iszero(a) ? a : tlfloat_t(s.cast((const decltype(a.getUnpacked()) *)nullptr)),
+	tlfloat_t(c.cast((const decltype(a.getUnpacked()) *)nullptr)) };
+    }
+
     template<typename tlfloat_t, typename Unpacked_t, unsigned N, unsigned M>
     static constexpr tlfloat_t tanpi(const tlfloat_t& a) {
       if (isnan(a) || iszero(a)) return a;
@@ -1440,42 +1489,30 @@ namespace tlfloat {
   /** This function returns tan(PI * x). The accuracy of the return value is 1ULP. */
   static inline constexpr Octuple tanpi(const Octuple& a) { return detail::tanpi<Octuple, detail::xoctuple, 25, 3>(a); }
 
-  static inline constexpr xpair<BFloat16, BFloat16> sincos(const BFloat16& a) {
-    return { detail::sin<BFloat16, detail::xhalf, 2>(a), detail::cos<BFloat16, detail::xhalf, 2>(a) };
-  }
-  static inline constexpr xpair<Half, Half> sincos(const Half& a) {
-    return { detail::sin<Half, detail::xhalf, 2>(a), detail::cos<Half, detail::xhalf, 2>(a) };
-  }
-  static inline constexpr xpair<Float, Float> sincos(const Float& a) {
-    return { detail::sin<Float, detail::xfloat, 4>(a), detail::cos<Float, detail::xfloat, 4>(a) };
-  }
-  static inline constexpr xpair<Double, Double> sincos(const Double& a) {
-    return { detail::sin<Double, detail::xdouble, 9>(a), detail::cos<Double, detail::xdouble, 9>(a) };
-  }
-  static inline constexpr xpair<Quad, Quad> sincos(const Quad& a) {
-    return { detail::sin<Quad, detail::xquad, 14>(a), detail::cos<Quad, detail::xquad, 14>(a) };
-  }
-  static inline constexpr xpair<Octuple, Octuple> sincos(const Octuple& a) {
-    return { detail::sin<Octuple, detail::xoctuple, 25>(a), detail::cos<Octuple, detail::xoctuple, 25>(a) };
-  }
-
-  static inline constexpr xpair<BFloat16, BFloat16> sincospi(const BFloat16& a) {
-    return { detail::sinpi<BFloat16, detail::xhalf, 2>(a), detail::cospi<BFloat16, detail::xhalf, 2>(a) };
-  }
-  static inline constexpr xpair<Half, Half> sincospi(const Half& a) {
-    return { detail::sinpi<Half, detail::xhalf, 2>(a), detail::cospi<Half, detail::xhalf, 2>(a) };
-  }
-  static inline constexpr xpair<Float, Float> sincospi(const Float& a) {
-    return { detail::sinpi<Float, detail::xfloat, 4>(a), detail::cospi<Float, detail::xfloat, 4>(a) };
-  }
-  static inline constexpr xpair<Double, Double> sincospi(const Double& a) {
-    return { detail::sinpi<Double, detail::xdouble, 9>(a), detail::cospi<Double, detail::xdouble, 9>(a) };
-  }
-  static inline constexpr xpair<Quad, Quad> sincospi(const Quad& a) {
-    return { detail::sinpi<Quad, detail::xquad, 14>(a), detail::cospi<Quad, detail::xquad, 14>(a) };
-  }
-  static inline constexpr xpair<Octuple, Octuple> sincospi(const Octuple& a) {
-    return { detail::sinpi<Octuple, detail::xoctuple, 25>(a), detail::cospi<Octuple, detail::xoctuple, 25>(a) };
-  }
+  /** This function returns sin(x) and cos(x). The accuracy of the return values is 1ULP. */
+  static inline constexpr xpair<BFloat16, BFloat16> sincos(const BFloat16& a) { return detail::sincos<BFloat16, detail::xhalf, 2>(a); }
+  /** This function returns sin(x) and cos(x). The accuracy of the return values is 1ULP. */
+  static inline constexpr xpair<Half, Half> sincos(const Half& a) { return detail::sincos<Half, detail::xhalf, 2>(a); }
+  /** This function returns sin(x) and cos(x). The accuracy of the return values is 1ULP. */
+  static inline constexpr xpair<Float, Float> sincos(const Float& a) { return detail::sincos<Float, detail::xfloat, 4>(a); }
+  /** This function returns sin(x) and cos(x). The accuracy of the return values is 1ULP. */
+  static inline constexpr xpair<Double, Double> sincos(const Double& a) { return detail::sincos<Double, detail::xdouble, 9>(a); }
+  /** This function returns sin(x) and cos(x). The accuracy of the return values is 1ULP. */
+  static inline constexpr xpair<Quad, Quad> sincos(const Quad& a) { return detail::sincos<Quad, detail::xquad, 14>(a); }
+  /** This function returns sin(x) and cos(x). The accuracy of the return values is 1ULP. */
+  static inline constexpr xpair<Octuple, Octuple> sincos(const Octuple& a) { return detail::sincos<Octuple, detail::xoctuple, 25>(a); }
+
+  /** This function returns sin(PI * x) and cos(PI * x). The accuracy of the return values is 1ULP. */
+  static inline constexpr xpair<BFloat16, BFloat16> sincospi(const BFloat16& a) { return detail::sincospi<BFloat16, detail::xhalf, 2>(a); }
+  /** This function returns sin(PI * x) and cos(PI * x). The accuracy of the return values is 1ULP. */
+  static inline constexpr xpair<Half, Half> sincospi(const Half& a) { return detail::sincospi<Half, detail::xhalf, 2>(a); }
+  /** This function returns sin(PI * x) and cos(PI * x). The accuracy of the return values is 1ULP. */
+  static inline constexpr xpair<Float, Float> sincospi(const Float& a) { return detail::sincospi<Float, detail::xfloat, 4>(a); }
+  /** This function returns sin(PI * x) and cos(PI * x). The accuracy of the return values is 1ULP. */
+  static inline constexpr xpair<Double, Double> sincospi(const Double& a) { return detail::sincospi<Double, detail::xdouble, 9>(a); }
+  /** This function returns sin(PI * x) and cos(PI * x). The accuracy of the return values is 1ULP. */
+  static inline constexpr xpair<Quad, Quad> sincospi(const Quad& a) { return detail::sincospi<Quad, detail::xquad, 14>(a); }
+  /** This function returns sin(PI * x) and cos(PI * x). The accuracy of the return values is 1ULP. */
+  static inline constexpr xpair<Octuple, Octuple> sincospi(const Octuple& a) { return detail::sincospi<Octuple, detail::xoctuple, 25>(a); }
 }
 #endif // #ifndef __TLMATH_HPP_INCLUDED__
@@ -47,6 +47,22 @@ void doTestRec2(BigUInt<N> d) {
   }
 }
 
+template<int N>
+void doTestDivmod2Newton(BigUInt<N> n, BigUInt<N> d) {
+  auto c = n.divmod2(d), t = n.divmod2Newton(d);
+  if (c.first != t.first || c.second != t.second) {
+    cout << "divmod2Newton" << endl;
+    cout << "N   = " << N << endl;
+    cout << "n   = " << toHexString(n) << " " << n << endl;
+    cout << "d   = " << toHexString(d) << " " << d << endl;
+    cout << "t.q = " << toHexString(t.first ) << endl;
+    cout << "c.q = " << toHexString(c.first ) << endl;
+    cout << "t.r = " << toHexString(t.second) << endl;
+    cout << "c.r = " << toHexString(c.second) << endl;
+    exit(-1);
+  }
+}
+
 template<int N>
 void doTestDivmod2(BigUInt<N> n, BigUInt<N> d) {
   auto c = xdivmod2(n, d);
@@ -76,6 +92,8 @@ void doTestDivmod2(BigUInt<N> n, BigUInt<N> d) {
     exit(-1);
   }
 
+  doTestDivmod2Newton(n, d);
+
   if (d != 0) {
     t = n.divmod(d);
     if (t.second >= d || t.first * d + t.second != n) {
@@ -126,6 +144,105 @@ void testLoop() {
   }
 }
 
+template<int N>
+BigUInt<N> rndBigUInt(shared_ptr<RNG> rng) {
+  BigUInt<N> x;
+  const int mode = rng->nextLT(4);
+  for(int i=0;i<(1 << (N - 6));i++) {
+    uint64_t w = rng->next64();
+    if (mode == 1) w = ~uint64_t(0);
+    if (mode == 2 && rng->nextBool()) w = 0;
+    if (mode == 3 && rng->nextBool()) w = ~uint64_t(0);
+    x.setWord(i, w);
+  }
+  return x >> rng->nextLT(1 << N);
+}
+
+static_assert(BigUInt<7>(~BigUInt<7>(0)).divmod2Newton(0).first == ~BigUInt<7>(0));
+static_assert(BigUInt<8>(3).divmod2Newton(1).second == (BigUInt<8>(1) << 255) - 2);
+
+template<int N>
+void testMontgomery(shared_ptr<RNG> rng) {
+  BigUInt<N> m = rndBigUInt<N>(rng);
+  m.setWord(0, m.getWord(0) | 1);
+  if (m == 1) m = 3;
+  typename BigUInt<N>::Montgomery mg(m);
+
+  BigUInt<N> a[6], e[6], r[6];
+  for(int i=0;i<6;i++) {
+    a[i] = mg.transform(rndBigUInt<N>(rng) % m);
+    e[i] = rndBigUInt<N>(rng);
+  }
+
+  mg.pow(r, a, e[0], 6);
+
+  BigUInt<N> p = mg.one;
+  for(int i=0;i<6;i++) {
+    BigUInt<N> c = (BigUInt<N>)BigUInt<N+1>(mg.reduce(BigUInt<N+1>(a[i]))).pow(e[i], m);
+    if (mg.reduce(BigUInt<N+1>(mg.pow(a[i], e[i]))) != c) {
+      cout << "Montgomery::pow" << endl;
+      cout << "m = " << toHexString(m) << endl;
+      cout << "a = " << toHexString(a[i]) << endl;
+      cout << "e = " << toHexString(e[i]) << endl;
+      exit(-1);
+    }
+    if (r[i] != mg.pow(a[i], e[0])) {
+      cout << "Montgomery::pow (batch)" << endl;
+      cout << "m = " << toHexString(m) << endl;
+      cout << "a = " << toHexString(a[i]) << endl;
+      cout << "e = " << toHexString(e[0]) << endl;
+      exit(-1);
+    }
+    p = mg.mul(p, mg.pow(a[i], e[i]));
+  }
+
+  if (mg.multipow(a, e) != p) {
+    cout << "Montgomery::multipow" << endl;
+    cout << "m = " << toHexString(m) << endl;
+    exit(-1);
+  }
+}
+
+template<int N>
+void testDivisor(shared_ptr<RNG> rng) {
+  BigUInt<N> d = rndBigUInt<N>(rng);
+  if (d.isZero()) d = 1;
+  typename BigUInt<N>::Divisor dv(d);
+
+  uint64_t d64 = rng->next64() >> rng->nextLT(64);
+  if (d64 == 0) d64 = 1;
+  BigUInt<6>::Divisor dv64(d64);
+
+  for(int i=0;i<10;i++) {
+    BigUInt<N> x = rndBigUInt<N>(rng);
+    xpair<BigUInt<N>, BigUInt<N>> a = dv.divmod(x);
+    if (a.first != x / d || a.second != x % d) {
+      cout << "Divisor" << endl;
+      cout << "x = " << toHexString(x) << endl;
+      cout << "d = " << toHexString(d) << endl;
+      exit(-1);
+    }
+    xpair<BigUInt<N>, uint64_t> b = dv64.divmod(x);
+    if (b.first != x / BigUInt<N>(d64) || BigUInt<N>(b.second) != x % BigUInt<N>(d64)) {
+      cout << "BigUInt<6>::Divisor" << endl;
+      cout << "x = " << toHexString(x) << endl;
+      cout << "d = " << toHexString(d64) << endl;
+      exit(-1);
+    }
+    uint64_t y = rng->next64() >> rng->nextLT(64);
+    xpair<uint64_t, uint64_t> c = dv64.divmod(y);
+    if (c.first != y / d64 || c.second != y % d64) {
+      cout << "BigUInt<6>::Divisor" << endl;
+      cout << "y = " << y << endl;
+      cout << "d = " << d64 << endl;
+      exit(-1);
+    }
+  }
+}
+
+static_assert(BigUInt<7>::Divisor(BigUInt<7>(10)).divmod(BigUInt<7>(12345)).second == 5);
+static_assert(BigUInt<6>::Divisor(10).divmod(BigUInt<8>(12345)).first == 1234);
+
 bool checkRNG(shared_ptr<RNG> rng, int n, int nloop, int thres) {
   vector<int> bin(n);
 
@@ -181,6 +298,24 @@ int main(int argc, char **argv) {
 
   shared_ptr<RNG> rng = createPreferredRNG();
 
+  for(int i=0;i<100000;i++) {
+    doTestDivmod2Newton(rndBigUInt<7>(rng), rndBigUInt<7>(rng));
+    doTestDivmod2Newton(rndBigUInt<8>(rng), rndBigUInt<8>(rng));
+  }
+
+  for(int i=0;i<100;i++) {
+    testMontgomery<7>(rng);
+    testMontgomery<8>(rng);
+    testMontgomery<9>(rng);
+    testMontgomery<10>(rng);
+  }
+
+  for(int i=0;i<10000;i++) {
+    testDivisor<7>(rng);
+    testDivisor<8>(rng);
+    testDivisor<9>(rng);
+  }
+
   if (ntest != 1) {
     if (argc == 1) {
       for(int i=3;i<=23;i+=2) {
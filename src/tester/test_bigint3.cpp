@@ -307,6 +307,98 @@ void checku(uint64_t high0, uint64_t low0, uint64_t high1, uint64_t low1, double
   }
 }
 
+void checkmul256(const uint64_t *a, const uint64_t *b) {
+  BigUInt<8> x, y;
+  for(int i=0;i<4;i++) { x.setWord(i, a[i]); y.setWord(i, b[i]); }
+  BigUInt<9> t = BigUInt<9>::mul(x, y);
+
+  uint64_t c[8] = { 0 };
+  for(int i=0;i<4;i++) {
+    __uint128_t carry = 0;
+    for(int j=0;j<4;j++) {
+      __uint128_t m = __uint128_t(a[i]) * b[j] + c[i+j] + carry;
+      c[i+j] = uint64_t(m);
+      carry = m >> 64;
+    }
+    c[i+4] = uint64_t(carry);
+  }
+
+  for(int i=0;i<8;i++) {
+    if (t.getWord(i) != c[i]) {
+      cerr << "x = " << toHexString(x) << endl << "y = " << toHexString(y) << endl;
+      e("BigUInt<9>::mul");
+      return;
+    }
+  }
+}
+
+template<int N>
+void checksqr(const BigUInt<N> &x) {
+  if (BigUInt<N+1>::sqr(x) != BigUInt<N+1>::mul(x, x)) {
+    cerr << "x = " << toHexString(x) << endl;
+    e("BigUInt::sqr");
+  }
+}
+
+uint64_t rndWord(shared_ptr<RNG> rng) {
+  switch(rng->nextLT(4)) {
+  case 0: return 0;
+  case 1: return ~uint64_t(0);
+  case 2: return uint64_t(1) << rng->nextLT(64);
+  default: return rng->next64();
+  }
+}
+
+template<int N>
+BigUInt<N> rndBigUInt(shared_ptr<RNG> rng) {
+  BigUInt<N> x;
+  for(int j=0;j<(1 << (N-6));j++) x.setWord(j, rng->nextBool() ? rndWord(rng) : rng->next64());
+  return x >> rng->nextLT(1 << N);
+}
+
+template<int N>
+void checkgcd(shared_ptr<RNG> rng) {
+  BigUInt<N> a = rndBigUInt<N>(rng), b = rndBigUInt<N>(rng);
+  if (rng->nextBool()) {
+    BigUInt<N> c = rndBigUInt<N>(rng) >> (1 << (N-1));
+    a = (a >> (1 << (N-1))) * c;
+    b = (b >> (1 << (N-1))) * c;
+  }
+
+  BigUInt<N> g = a, r = b;
+  while(!r.isZero()) {
+    BigUInt<N> t = r;
+    r = g % r;
+    g = t;
+  }
+
+  if (a.gcd(b) != g) {
+    cerr << "a = " << toHexString(a) << endl << "b = " << toHexString(b) << endl;
+    e("BigUInt::gcd");
+  }
+
+  if (b > 1) {
+    BigUInt<N> v = a.modinv(b);
+    if (g == 1 ? !(v < b) || BigUInt<N+1>::mul(a, v) % BigUInt<N+1>(b) != 1 : v != 0) {
+      cerr << "a = " << toHexString(a) << endl << "b = " << toHexString(b) << endl;
+      e("BigUInt::modinv");
+    }
+  }
+
+  BigInt<N> ia(a >> 1), ib(b >> 1), x, y;
+  if (rng->nextBool()) ia = -ia;
+  if (rng->nextBool()) ib = -ib;
+  BigInt<N> h = ia.extgcd(ib, &x, &y);
+  if (h != ia.gcd(ib) || BigInt<N+1>(ia) * BigInt<N+1>(x) + BigInt<N+1>(ib) * BigInt<N+1>(y) != BigInt<N+1>(h)) {
+    cerr << "a = " << ia << endl << "b = " << ib << endl;
+    e("BigInt::extgcd");
+  }
+}
+
+static_assert(BigUInt<7>(12).gcd(BigUInt<7>(18)) == 6);
+static_assert(BigUInt<8>(3).modinv(BigUInt<8>(7)) == 5);
+static_assert(BigInt<7>(-3).modinv(BigInt<7>(7)) == 2);
+
 int main(int argc, char **argv) {
   int n = 10000;
 
@@ -322,6 +414,40 @@ int main(int argc, char **argv) {
     checks(rng->next64(), rng->next64(), rng->next64(), rng->next64(), d0);
   }
 
+  for(int i=0;i<n*10;i++) {
+    uint64_t a[4], b[4];
+    for(int j=0;j<4;j++) {
+      a[j] = (i & 1) ? rndWord(rng) : rng->next64();
+      b[j] = (i & 2) ? rndWord(rng) : rng->next64();
+    }
+    checkmul256(a, b);
+  }
+
+  for(int i=0;i<n;i++) {
+    BigUInt<7> x7;
+    BigUInt<8> x8;
+    BigUInt<9> x9;
+    BigUInt<10> x10;
+    for(int j=0;j<2;j++) x7.setWord(j, (i & 1) ? rndWord(rng) : rng->next64());
+    for(int j=0;j<4;j++) x8.setWord(j, (i & 1) ? rndWord(rng) : rng->next64());
+    for(int j=0;j<8;j++) x9.setWord(j, (i & 1) ? rndWord(rng) : rng->next64());
+    for(int j=0;j<16;j++) x10.setWord(j, (i & 1) ? rndWord(rng) : rng->next64());
+    checksqr(x7);
+    checksqr(x8);
+    checksqr(x9);
+    checksqr(x10);
+  }
+
+  for(int i=0;i<n;i++) {
+    checkgcd<7>(rng);
+    checkgcd<8>(rng);
+  }
+
+  for(int i=0;i<n/10;i++) {
+    checkgcd<9>(rng);
+    checkgcd<10>(rng);
+  }
+
   if (!success) {
     cout << "NG" << endl;
     return -1;
@@ -146,6 +146,16 @@ void checks(uint64_t high0, uint64_t low0, uint64_t high1, uint64_t low1, double
   if (!equal(i0 % i1, b0 % b1)) e("%");
   if (!equal(i1 % i0, b1 % b0)) e("%");
 
+  if (!equal(i0.gcd(i1), tlfloat_int128_t(tlfloat_gcd_i128_i128(b0, b1)))) e("gcd");
+  {
+    BigInt<7> x, y;
+    tlfloat_int128_t_ s, t;
+    BigInt<7> g = i0.extgcd(i1, &x, &y);
+    if (!equal(g, tlfloat_int128_t(tlfloat_extgcd_i128_i128(b0, b1, &s, &t))) ||
+	!equal(x, tlfloat_int128_t(s)) || !equal(y, tlfloat_int128_t(t))) e("extgcd");
+  }
+  if (!equal(i0.modinv(i1), tlfloat_int128_t(tlfloat_modinv_i128_i128(b0, b1)))) e("modinv");
+
   if (!equal(i0 << 3, b0 << 3)) e("<<");
   if (!equal((i0 <<= 3), (b0 <<= 3))) e("<<=");
 
@@ -284,6 +294,9 @@ void checku(uint64_t high0, uint64_t low0, uint64_t high1, uint64_t low1, double
   if (!equal(i0 % i1, b0 % b1)) e("%");
   if (!equal(i1 % i0, b1 % b0)) e("%");
 
+  if (!equal(i0.gcd(i1), tlfloat_uint128_t(tlfloat_gcd_u128_u128(b0, b1)))) e("gcd");
+  if (!equal(i0.modinv(i1), tlfloat_uint128_t(tlfloat_modinv_u128_u128(b0, b1)))) e("modinv");
+
   if (!equal(i0 << 3, b0 << 3)) e("<<");
   if (!equal((i0 <<= 3), (b0 <<= 3))) e("<<=");
 
@@ -301,6 +314,33 @@ void checku(uint64_t high0, uint64_t low0, uint64_t high1, uint64_t low1, double
   if (!equal(i1 /= i0, b1 /= b0)) e("/=");
 }
 
+template<int N>
+BigUInt<N> rndBigUInt(shared_ptr<RNG> rng) {
+  BigUInt<N> x;
+  const int mode = rng->nextLT(4);
+  for(int i=0;i<(1 << (N - 6));i++) {
+    uint64_t w = rng->next64();
+    if (mode == 1) w = ~uint64_t(0);
+    if (mode == 2 && rng->nextBool()) w = 0;
+    if (mode == 3 && rng->nextLT(3) == 0) w = ~uint64_t(0);
+    x.setWord(i, w);
+  }
+  return x;
+}
+
+template<int N>
+void checkmul(shared_ptr<RNG> rng) {
+  BigUInt<N-1> x = rndBigUInt<N-1>(rng), y = rndBigUInt<N-1>(rng);
+  BigUInt<N> t = BigUInt<N>::mulToom3(x, y), k = BigUInt<N>::mulKaratsuba(x, y);
+  if (t != k || t != BigUInt<N>(x.mulhi(y), x * y)) {
+    cerr << "x = " << toHexString(x) << endl << "y = " << toHexString(y) << endl;
+    e("BigUInt::mulToom3");
+  }
+}
+
+static_assert(BigUInt<10>::mulToom3(~BigUInt<9>(0), ~BigUInt<9>(0)) == BigUInt<10>(~BigUInt<9>(1), BigUInt<9>(1)));
+static_assert(BigUInt<11>::mulToom3(BigUInt<10>(12345) << 700, BigUInt<10>(67890) << 300) == BigUInt<11>(uint64_t(12345) * 67890) << 1000);
+
 int main(int argc, char **argv) {
   int n = 10000;
 
@@ -316,6 +356,13 @@ int main(int argc, char **argv) {
     checks(rng->next64(), rng->next64(), rng->next64(), rng->next64(), d0);
   }
 
+  for(int i=0;i<n/10;i++) {
+    checkmul<10>(rng);
+    checkmul<11>(rng);
+    checkmul<12>(rng);
+    checkmul<13>(rng);
+  }
+
   if (!success) {
     cout << "NG" << endl;
     return -1;
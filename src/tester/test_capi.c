@@ -632,6 +632,40 @@ int main(int argc, char **argv) {
     checkInt(tlfloat_eq_o_o(c, tlfloat_cospio(a)), 1, "cos in tlfloat_sincoso");
   }
 
+  {
+    tlfloat_quad x[5], y[5], z[5], d[5], s[5], c[5];
+    for(int i=0;i<5;i++) {
+      x[i] = tlfloat_mulq(tlfloat_strtoq("0.1", NULL), tlfloat_cast_q_i64(i - 2));
+      y[i] = tlfloat_addq(tlfloat_strtoq("1.7", NULL), tlfloat_cast_q_i64(i));
+      z[i] = tlfloat_mulq(tlfloat_strtoq("-0.3", NULL), tlfloat_cast_q_i64(i));
+    }
+    tlfloat_addq_n(d, x, y, 5);
+    for(int i=0;i<5;i++) checkInt(tlfloat_eq_q_q(d[i], tlfloat_addq(x[i], y[i])), 1, "tlfloat_addq_n");
+    tlfloat_fmaq_n(d, x, y, z, 5);
+    for(int i=0;i<5;i++) checkInt(tlfloat_eq_q_q(d[i], tlfloat_fmaq(x[i], y[i], z[i])), 1, "tlfloat_fmaq_n");
+    tlfloat_sqrtq_n(d, y, 5);
+    for(int i=0;i<5;i++) checkInt(tlfloat_eq_q_q(d[i], tlfloat_sqrtq(y[i])), 1, "tlfloat_sqrtq_n");
+    tlfloat_sincosq_n(s, c, x, 5);
+    for(int i=0;i<5;i++) checkInt(tlfloat_eq_q_q(s[i], tlfloat_sinq(x[i])), 1, "sin in tlfloat_sincosq_n");
+    for(int i=0;i<5;i++) checkInt(tlfloat_eq_q_q(c[i], tlfloat_cosq(x[i])), 1, "cos in tlfloat_sincosq_n");
+    tlfloat_powq_n(d, y, x, 5);
+    for(int i=0;i<5;i++) checkInt(tlfloat_eq_q_q(d[i], tlfloat_powq(y[i], x[i])), 1, "tlfloat_powq_n");
+  }
+
+  {
+    tlfloat_octuple x[5], y[5], d[5];
+    for(int i=0;i<5;i++) {
+      x[i] = tlfloat_mulo(tlfloat_strtoo("0.1", NULL), tlfloat_cast_o_i64(i - 2));
+      y[i] = tlfloat_addo(tlfloat_strtoo("1.7", NULL), tlfloat_cast_o_i64(i));
+    }
+    tlfloat_mulo_n(d, x, y, 5);
+    for(int i=0;i<5;i++) checkInt(tlfloat_eq_o_o(d[i], tlfloat_mulo(x[i], y[i])), 1, "tlfloat_mulo_n");
+    tlfloat_expo_n(d, x, 5);
+    for(int i=0;i<5;i++) checkInt(tlfloat_eq_o_o(d[i], tlfloat_expo(x[i])), 1, "tlfloat_expo_n");
+    tlfloat_logo_n(d, y, 5);
+    for(int i=0;i<5;i++) checkInt(tlfloat_eq_o_o(d[i], tlfloat_logo(y[i])), 1, "tlfloat_logo_n");
+  }
+
   //
 
 #ifdef TLFLOAT_COMPILER_SUPPORTS_INT128
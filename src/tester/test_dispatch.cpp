@@ -0,0 +1,162 @@
+//  See https://github.com/shibatch/tlfloat for our project.
+//        Copyright Naoki Shibata and contributors.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that every variant of the dispatched C API functions that
+// runs on this processor gives the same results as the template API
+
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+
+#include "suppress.hpp"
+
+#include "tlfloat/tlmath.hpp"
+#include "tlfloat/tlfloat.h"
+
+#include "testerutil.hpp"
+
+using namespace std;
+using namespace tlfloat;
+
+#define DECLARE_VARIANT(variant)					\
+  extern "C" {								\
+    tlfloat_quad_ tlfloat_addq_ ## variant(const tlfloat_quad_ x, const tlfloat_quad_ y); \
+    tlfloat_octuple_ tlfloat_addo_ ## variant(const tlfloat_octuple_ x, const tlfloat_octuple_ y); \
+    tlfloat_quad_ tlfloat_subq_ ## variant(const tlfloat_quad_ x, const tlfloat_quad_ y); \
+    tlfloat_octuple_ tlfloat_subo_ ## variant(const tlfloat_octuple_ x, const tlfloat_octuple_ y); \
+    tlfloat_quad_ tlfloat_mulq_ ## variant(const tlfloat_quad_ x, const tlfloat_quad_ y); \
+    tlfloat_octuple_ tlfloat_mulo_ ## variant(const tlfloat_octuple_ x, const tlfloat_octuple_ y); \
+    tlfloat_quad_ tlfloat_divq_ ## variant(const tlfloat_quad_ x, const tlfloat_quad_ y); \
+    tlfloat_octuple_ tlfloat_divo_ ## variant(const tlfloat_octuple_ x, const tlfloat_octuple_ y); \
+    tlfloat_quad_ tlfloat_fmaq_ ## variant(const tlfloat_quad_ x, const tlfloat_quad_ y, const tlfloat_quad_ z); \
+    tlfloat_octuple_ tlfloat_fmao_ ## variant(const tlfloat_octuple_ x, const tlfloat_octuple_ y, const tlfloat_octuple_ z); \
+    tlfloat_quad_ tlfloat_sqrtq_ ## variant(const tlfloat_quad_ x); \
+    tlfloat_octuple_ tlfloat_sqrto_ ## variant(const tlfloat_octuple_ x); \
+  }
+
+DECLARE_VARIANT(generic)
+DECLARE_VARIANT(bmi2)
+DECLARE_VARIANT(avx512)
+
+struct Variant {
+  const char *name;
+  bool supported;
+  tlfloat_quad_ (*addq)(const tlfloat_quad_, const tlfloat_quad_);
+  tlfloat_octuple_ (*addo)(const tlfloat_octuple_, const tlfloat_octuple_);
+  tlfloat_quad_ (*subq)(const tlfloat_quad_, const tlfloat_quad_);
+  tlfloat_octuple_ (*subo)(const tlfloat_octuple_, const tlfloat_octuple_);
+  tlfloat_quad_ (*mulq)(const tlfloat_quad_, const tlfloat_quad_);
+  tlfloat_octuple_ (*mulo)(const tlfloat_octuple_, const tlfloat_octuple_);
+  tlfloat_quad_ (*divq)(const tlfloat_quad_, const tlfloat_quad_);
+  tlfloat_octuple_ (*divo)(const tlfloat_octuple_, const tlfloat_octuple_);
+  tlfloat_quad_ (*fmaq)(const tlfloat_quad_, const tlfloat_quad_, const tlfloat_quad_);
+  tlfloat_octuple_ (*fmao)(const tlfloat_octuple_, const tlfloat_octuple_, const tlfloat_octuple_);
+  tlfloat_quad_ (*sqrtq)(const tlfloat_quad_);
+  tlfloat_octuple_ (*sqrto)(const tlfloat_octuple_);
+};
+
+#define VARIANT(variant, supported) {					\
+    #variant, supported,						\
+    tlfloat_addq_ ## variant, tlfloat_addo_ ## variant, tlfloat_subq_ ## variant, tlfloat_subo_ ## variant, \
+    tlfloat_mulq_ ## variant, tlfloat_mulo_ ## variant, tlfloat_divq_ ## variant, tlfloat_divo_ ## variant, \
+    tlfloat_fmaq_ ## variant, tlfloat_fmao_ ## variant, tlfloat_sqrtq_ ## variant, tlfloat_sqrto_ ## variant }
+
+shared_ptr<RNG> rng = createPreferredRNG();
+
+bool success = true;
+
+template<typename T>
+bool same(T a, T b) {
+  if (isnan(a) && isnan(b)) return true;
+  return memcmp((void *)&a, (void *)&b, sizeof(T)) == 0;
+}
+
+// Random numbers of any class, or normal numbers with full-width
+// mantissas and moderate exponents
+
+template<typename T>
+T rnd() {
+  if (rng->nextLT(4) == 0) {
+    uint64_t u[sizeof(T) / 8];
+    for(auto &w : u) w = rng->next64();
+    T x;
+    memcpy((void *)&x, (void *)u, sizeof(T));
+    return x;
+  }
+  T x = 0;
+  for(int i=0;i<4;i++) x = ldexp(x, 64) + T(int64_t(rng->next64()));
+  return ldexp(x, (int)rng->nextLT(400) - 200 - 256);
+}
+
+template<typename T, typename U>
+void check(const char *variant, const char *func, T x, T y, T z, U r, T e) {
+  T t;
+  memcpy((void *)&t, (void *)&r, sizeof(T));
+  if (same(t, e)) return;
+  cout << "NG : " << variant << " " << func << endl;
+  cout << "x = " << to_string(x, 80) << endl;
+  cout << "y = " << to_string(y, 80) << endl;
+  cout << "z = " << to_string(z, 80) << endl;
+  cout << "r = " << to_string(t, 80) << endl;
+  cout << "e = " << to_string(e, 80) << endl;
+  success = false;
+}
+
+int main(int argc, char **argv) {
+  __builtin_cpu_init();
+  const bool bmi2 = __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("adx");
+  const bool avx512 = bmi2 && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+
+  const Variant variants[] = {
+    VARIANT(generic, true),
+    VARIANT(bmi2, bmi2),
+    VARIANT(avx512, avx512),
+  };
+
+  for(auto &v : variants) {
+    if (!v.supported) {
+      cout << "Skipping " << v.name << endl;
+      continue;
+    }
+    cout << "Checking " << v.name << endl;
+
+    for(int i=0;i<100000 && success;i++) {
+      Quad qx = rnd<Quad>(), qy = rnd<Quad>(), qz = rnd<Quad>();
+      tlfloat_quad_ cx, cy, cz;
+      memcpy((void *)&cx, (void *)&qx, sizeof(cx));
+      memcpy((void *)&cy, (void *)&qy, sizeof(cy));
+      memcpy((void *)&cz, (void *)&qz, sizeof(cz));
+
+      check(v.name, "addq", qx, qy, qz, v.addq(cx, cy), qx + qy);
+      check(v.name, "subq", qx, qy, qz, v.subq(cx, cy), qx - qy);
+      check(v.name, "mulq", qx, qy, qz, v.mulq(cx, cy), qx * qy);
+      check(v.name, "divq", qx, qy, qz, v.divq(cx, cy), qx / qy);
+      check(v.name, "fmaq", qx, qy, qz, v.fmaq(cx, cy, cz), fma(qx, qy, qz));
+      check(v.name, "sqrtq", qx, qy, qz, v.sqrtq(cx), sqrt(qx));
+
+      Octuple ox = rnd<Octuple>(), oy = rnd<Octuple>(), oz = rnd<Octuple>();
+      tlfloat_octuple_ dx, dy, dz;
+      memcpy((void *)&dx, (void *)&ox, sizeof(dx));
+      memcpy((void *)&dy, (void *)&oy, sizeof(dy));
+      memcpy((void *)&dz, (void *)&oz, sizeof(dz));
+
+      check(v.name, "addo", ox, oy, oz, v.addo(dx, dy), ox + oy);
+      check(v.name, "subo", ox, oy, oz, v.subo(dx, dy), ox - oy);
+      check(v.name, "mulo", ox, oy, oz, v.mulo(dx, dy), ox * oy);
+      check(v.name, "divo", ox, oy, oz, v.divo(dx, dy), ox / oy);
+      check(v.name, "fmao", ox, oy, oz, v.fmao(dx, dy, dz), fma(ox, oy, oz));
+      check(v.name, "sqrto", ox, oy, oz, v.sqrto(dx), sqrt(ox));
+    }
+  }
+
+  if (!success) {
+    cout << "NG" << endl;
+    return -1;
+  }
+
+  cout << "OK" << endl;
+  return 0;
+}
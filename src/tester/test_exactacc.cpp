@@ -0,0 +1,130 @@
+//  See https://github.com/shibatch/tlfloat for our project.
+//        Copyright Naoki Shibata and contributors.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <cstring>
+#include <cstdlib>
+
+#include "suppress.hpp"
+
+#include "tlfloat/tlmath.hpp"
+#include "tlfloat/exactacc.hpp"
+
+#include "testerutil.hpp"
+
+using namespace std;
+using namespace tlfloat;
+
+shared_ptr<RNG> rng = createPreferredRNG();
+
+bool success = true;
+
+template<typename T>
+bool same(T a, T b) {
+  if (isnan(a) && isnan(b)) return true;
+  return memcmp((void *)&a, (void *)&b, sizeof(T)) == 0;
+}
+
+template<typename T>
+T rnd(int emin, int emax) {
+  T x = ldexp(T(int64_t(rng->next64())) / T(uint64_t(1) << 63), emin + (int)rng->nextLT(emax - emin + 1));
+  if constexpr (sizeof(T) == 16) x += ldexp(T(int64_t(rng->next64())), ilogb(x) - 126);
+  return x;
+}
+
+template<typename T>
+void check(const char *mes, bool cond, T x, T y, T z) {
+  if (cond) return;
+  cout << "NG : " << mes << endl;
+  cout << "x = " << to_string(x, 40) << endl;
+  cout << "y = " << to_string(y, 40) << endl;
+  cout << "z = " << to_string(z, 40) << endl;
+  success = false;
+}
+
+template<typename T>
+void checkType(const char *name, int maxexp, int minexp) {
+  cout << "Checking " << name << endl;
+
+  // A single product plus an addend must be rounded in the same way as fma
+
+  for(int i=0;i<100000 && success;i++) {
+    T x = rnd<T>(minexp, maxexp), y = rnd<T>(-60, 60), z = rnd<T>(minexp, maxexp);
+    if (rng->nextLT(4) == 0) z = -x * y;
+    ExactAccumulator<T> a;
+    a.addProduct(x, y);
+    a.add(z);
+    check("addProduct + add", same(a.result(), fma(x, y, z)), x, y, z);
+
+    ExactAccumulator<T> b;
+    b.addProduct(x, ldexp(y, minexp));
+    check("underflow", same(b.result(), x * ldexp(y, minexp)), x, ldexp(y, minexp), T(0));
+  }
+
+  // The result does not depend on the order of additions and merges
+
+  for(int n=1;n<2000 && success;n = n * 3 / 2 + 1) {
+    vector<T> v(n);
+    for(auto &e : v) e = rnd<T>(minexp, maxexp);
+
+    ExactAccumulator<T> a, b, c;
+    for(auto &e : v) a.add(e);
+    for(auto &e : v) { a.add(-e); a.add(T::flt_max()); a.add(e); a.add(-T::flt_max()); }
+    shuffle(v.begin(), v.end(), default_random_engine(n));
+    for(int i=0;i<n;i++) (i & 1 ? b : c).add(v[i]);
+    b.merge(c);
+
+    check("cancellation", same(a.result(), b.result()), v[0], a.result(), b.result());
+
+    ExactAccumulator<T> d;
+    d.add(T(1));
+    for(auto &e : v) d.add(e);
+    for(auto &e : v) d.add(-e);
+    check("1 + sum - sum", same(d.result(), T(1)), v[0], T(0), T(0));
+  }
+
+  // Special values
+
+  ExactAccumulator<T> a;
+  check("empty", same(a.result(), T(0)), T(0), T(0), T(0));
+  a.add(T(-0.0));
+  check("-0", same(a.result(), T(-0.0)), T(0), T(0), T(0));
+  a.add(T(0.0));
+  check("-0 + +0", same(a.result(), T(0.0)), T(0), T(0), T(0));
+  a.add(T::flt_max());
+  a.add(T::flt_max());
+  check("overflow", same(a.result(), T::infinity()), T(0), T(0), T(0));
+  a.add(-T::infinity());
+  check("-inf", same(a.result(), -T::infinity()), T(0), T(0), T(0));
+  a.add(T::infinity());
+  check("inf - inf", isnan(a.result()), T(0), T(0), T(0));
+
+  ExactAccumulator<T> b;
+  b.addProduct(T::infinity(), T(0));
+  check("inf * 0", isnan(b.result()), T(0), T(0), T(0));
+
+  ExactAccumulator<T> c;
+  c.addProduct(T::flt_true_min(), T::flt_true_min());
+  c.add(T::flt_true_min());
+  check("true_min", same(c.result(), T::flt_true_min()), T(0), T(0), T(0));
+}
+
+int main(int argc, char **argv) {
+  checkType<Float>("Float", 100, -140);
+  checkType<Double>("Double", 1000, -1060);
+  checkType<Quad>("Quad", 16000, -16480);
+
+  if (!success) {
+    cout << "NG" << endl;
+    exit(-1);
+  }
+
+  cout << "OK" << endl;
+  exit(0);
+}
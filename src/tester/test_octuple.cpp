@@ -280,6 +280,23 @@ int main(int argc, char **argv) {
     return -1;
   }
 
+  for(int i=-40;i<=40;i++) {
+    Quad q = Quad(i) * Quad("0.3926990816987241548078304229099378605246"), r = Quad(i) / 8;
+    if (sin(q) != sincos(q).first || cos(q) != sincos(q).second) {
+      printf("NG : sincos(Quad) at %d\n", i);
+      return -1;
+    }
+    if (sinpi(r) != sincospi(r).first || cospi(r) != sincospi(r).second || signbit(sinpi(r)) != signbit(sincospi(r).first)) {
+      printf("NG : sincospi(Quad) at %d\n", i);
+      return -1;
+    }
+    Octuple o = Octuple(i) * Octuple("1e+30");
+    if (sin(o) != sincos(o).first || cos(o) != sincos(o).second) {
+      printf("NG : sincos(Octuple) at %d\n", i);
+      return -1;
+    }
+  }
+
   //
 
   printf("OK\n");
@@ -0,0 +1,130 @@
+//  See https://github.com/shibatch/tlfloat for our project.
+//        Copyright Naoki Shibata and contributors.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+
+#include "suppress.hpp"
+
+#include "tlfloat/tlmath.hpp"
+
+#include "testerutil.hpp"
+
+using namespace std;
+using namespace tlfloat;
+
+shared_ptr<RNG> rng = createPreferredRNG();
+
+bool success = true;
+
+template<typename T>
+bool same(T a, T b) {
+  if (isnan(a) && isnan(b)) return true;
+  return memcmp((void *)&a, (void *)&b, sizeof(T)) == 0;
+}
+
+// Generates a decimal string with nd significant digits
+
+string digits(int nd) {
+  string s;
+  for(int i=0;i<nd;i++) s += char('0' + (i == 0 ? 1 + rng->nextLT(9) : rng->nextLT(10)));
+  return s;
+}
+
+template<typename T, typename U>
+void check(const char *mes, const string &s, T x, U y) {
+  if (same(T(y), x)) return;
+  cout << "NG : " << mes << ", str = " << s << endl;
+  cout << "x = " << to_string(x, 40) << endl;
+  cout << "y = " << to_string(T(y), 40) << endl;
+  success = false;
+}
+
+template<typename T>
+void checkEndptr(const char *s, int pos, const char *expected) {
+  const char *endptr = nullptr;
+  T x = T(s, &endptr);
+  if (endptr - s != pos || !same(x, T(expected))) {
+    cout << "NG : endptr, str = " << s << ", pos = " << (endptr - s) << endl;
+    success = false;
+  }
+}
+
+int main(int argc, char **argv) {
+  cout << "Checking Double and Float with strtod and strtof" << endl;
+
+  for(int i=0;i<300000 && success;i++) {
+    string s = digits(1 + rng->nextLT(38));
+    s += "e" + std::to_string(int(rng->nextLT(600)) - 300 - (int)s.size() + 1);
+    if (rng->nextLT(2)) s = "-" + s;
+    check("Double", s, Double(s.c_str()), strtod(s.c_str(), nullptr));
+
+    // Subnormal numbers of Float are handled by the slower path
+
+    string t = digits(1 + rng->nextLT(38));
+    t += "e" + std::to_string(int(rng->nextLT(70)) - 35 - (int)t.size() + 1);
+    check("Float", t, Float(t.c_str()), strtof(t.c_str(), nullptr));
+  }
+
+  cout << "Checking exact products" << endl;
+
+  // w * 10^k is representable without rounding in Octuple
+
+  for(int i=0;i<100000 && success;i++) {
+    string w = digits(1 + rng->nextLT(38));
+    int k = rng->nextLT(41);
+    string s = w + "e" + std::to_string(k);
+
+    Octuple y = Octuple(BigUInt<7>(w.c_str()));
+    for(int j=0;j<k;j++) y *= 10;
+
+    check("Octuple", s, Octuple(s.c_str()), y);
+    check("Quad", s, Quad(s.c_str()), y);
+    check("Double", s, Double(s.c_str()), y);
+  }
+
+  cout << "Checking ties" << endl;
+
+  // 2^113 + 1 and 2^113 + 3 are halfway between two Quad numbers
+
+  {
+    BigUInt<7> b = BigUInt<7>(1) << 113;
+    Quad q = ldexp(Quad(1), 113);
+    check("Quad tie", "2^113+1", Quad(to_string(b + 1).c_str()), q);
+    check("Quad tie", "2^113+3", Quad(to_string(b + 3).c_str()), q + 4);
+    check("Quad tie", "2^113+3-", Quad(("-" + to_string(b + 3)).c_str()), -(q + 4));
+    check("Double tie", "2^53+1", Double("9007199254740993"), Double(9007199254740992.0));
+    check("Double tie", "2^53+3", Double("9007199254740995"), Double(9007199254740996.0));
+    check("Double tie", "2^53+1 e-1", Double("900719925474099.3e1"), Double(9007199254740992.0));
+  }
+
+  cout << "Checking round trips of Quad" << endl;
+
+  for(int i=0;i<100000 && success;i++) {
+    Quad x = ldexp(Quad(int64_t(rng->next64())) + ldexp(Quad(int64_t(rng->next64())), -64),
+		   (int)rng->nextLT(4000) - 2000);
+    char buf[100];
+    snprintShortest(buf, sizeof(buf), x.getUnpacked(), 'e');
+    check("Quad round trip", buf, Quad(buf), x);
+  }
+
+  checkEndptr<Quad>("1.5,2", 3, "1.5");
+  checkEndptr<Quad>("  -12e3x", 7, "-12000");
+  checkEndptr<Quad>("1e", 1, "1");
+  checkEndptr<Quad>("1e+", 1, "1");
+  checkEndptr<Quad>("0.0", 3, "0");
+  checkEndptr<Octuple>("123456789012345678901234567890123456789012345 ", 45, "1.23456789012345678901234567890123456789012345e+44");
+
+  if (!success) {
+    cout << "NG" << endl;
+    return -1;
+  }
+
+  cout << "OK" << endl;
+  return 0;
+}
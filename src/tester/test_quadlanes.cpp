@@ -0,0 +1,168 @@
+//  See https://github.com/shibatch/tlfloat for our project.
+//        Copyright Naoki Shibata and contributors.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iostream>
+#include <vector>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+
+#include "suppress.hpp"
+
+#include "tlfloat/tlmath.hpp"
+#include "quadlanes.hpp"
+
+#include "testerutil.hpp"
+
+using namespace std;
+using namespace tlfloat;
+
+typedef void (*binop_t)(Quad *, const Quad *, const Quad *, size_t);
+typedef void (*ternop_t)(Quad *, const Quad *, const Quad *, const Quad *, size_t);
+
+#define DEFINE_KERNELS(L, TARGET)					\
+  TARGET static void add ## L(Quad *d, const Quad *x, const Quad *y, size_t n) { detail::addsubLanes<L>(d, x, y, n, false); } \
+  TARGET static void sub ## L(Quad *d, const Quad *x, const Quad *y, size_t n) { detail::addsubLanes<L>(d, x, y, n, true); } \
+  TARGET static void mul ## L(Quad *d, const Quad *x, const Quad *y, size_t n) { detail::mulLanes<L>(d, x, y, n); } \
+  TARGET static void fma ## L(Quad *d, const Quad *x, const Quad *y, const Quad *z, size_t n) { detail::fmaLanes<L>(d, x, y, z, n); }
+
+DEFINE_KERNELS(2, )
+DEFINE_KERNELS(4, __attribute__((target("avx2"))))
+DEFINE_KERNELS(8, __attribute__((target("avx512f,avx512cd"))))
+
+shared_ptr<RNG> rng = createPreferredRNG();
+
+Quad fromBits(uint64_t h, uint64_t l) {
+  uint64_t u[2] = { l, h };
+  Quad q;
+  memcpy((void *)&q, u, sizeof(q));
+  return q;
+}
+
+Quad rndExp(int emin, int emax) {
+  uint64_t e = emin + rng->nextLT(emax - emin + 1);
+  return fromBits((rng->next(1) << 63) | (e << 48) | rng->next(48), rng->next64());
+}
+
+Quad rndQuad() {
+  switch(rng->nextLT(8)) {
+  case 0: return fromBits(rng->next64(), rng->next64());
+  case 1: return rndExp(0, 3);
+  case 2: return rndExp(0x7ffc, 0x7fff);
+  case 3: {
+    static const double a[] = { 0.0, -0.0, 1.0, -1.0, 0.5, 3.0, INFINITY, -INFINITY, NAN };
+    return Quad(a[rng->nextLT(sizeof(a)/sizeof(a[0]))]);
+  }
+  case 4: return rndExp(0x3fff - 300, 0x3fff + 300);
+  default: return rndExp(0x3fff - 4, 0x3fff + 4);
+  }
+}
+
+// Returns a number close to +-q, so that the subtraction cancels
+Quad nearby(Quad q) {
+  uint64_t u[2];
+  memcpy(u, (void *)&q, sizeof(u));
+  int s = rng->nextLT(124);
+  uint64_t dl = s >= 64 ? 0 : rng->next64() >> s, dh = s >= 64 ? rng->next64() >> (s - 64) : 0;
+  if (rng->next(1)) { u[1] += dh; u[0] += dl; } else { u[1] -= dh; u[0] -= dl; }
+  if (rng->next(1)) u[1] ^= uint64_t(1) << 63;
+  return fromBits(u[1], u[0]);
+}
+
+bool success = true;
+
+bool same(Quad a, Quad b) {
+  if (isnan(a) && isnan(b)) return true;
+  return memcmp((void *)&a, (void *)&b, sizeof(Quad)) == 0;
+}
+
+void checkBin(const char *mes, binop_t f, Quad (*ref)(Quad, Quad), size_t n) {
+  vector<Quad> x(n), y(n), d(n);
+  for(size_t i=0;i<n;i++) {
+    x[i] = rndQuad();
+    y[i] = rng->nextLT(3) == 0 ? nearby(x[i]) : rndQuad();
+  }
+
+  f(d.data(), x.data(), y.data(), n);
+
+  for(size_t i=0;i<n;i++) {
+    Quad r = ref(x[i], y[i]);
+    if (!same(d[i], r)) {
+      cout << "NG : " << mes << endl;
+      cout << "x = " << to_string(x[i], 40) << endl;
+      cout << "y = " << to_string(y[i], 40) << endl;
+      cout << "t = " << to_string(r, 40) << endl;
+      cout << "c = " << to_string(d[i], 40) << endl;
+      success = false;
+      return;
+    }
+  }
+
+  vector<Quad> x2 = x;
+  f(x2.data(), x2.data(), y.data(), n);
+  if (memcmp((void *)x2.data(), (void *)d.data(), n * sizeof(Quad)) != 0) {
+    cout << "NG : " << mes << " in-place" << endl;
+    success = false;
+  }
+}
+
+void checkFMA(const char *mes, ternop_t f, size_t n) {
+  vector<Quad> x(n), y(n), z(n), d(n);
+  for(size_t i=0;i<n;i++) {
+    x[i] = rndQuad();
+    y[i] = rndQuad();
+    z[i] = rng->nextLT(3) == 0 ? nearby(x[i] * y[i]) : rndQuad();
+  }
+
+  f(d.data(), x.data(), y.data(), z.data(), n);
+
+  for(size_t i=0;i<n;i++) {
+    Quad r = fma(x[i], y[i], z[i]);
+    if (!same(d[i], r)) {
+      cout << "NG : " << mes << endl;
+      cout << "x = " << to_string(x[i], 40) << endl;
+      cout << "y = " << to_string(y[i], 40) << endl;
+      cout << "z = " << to_string(z[i], 40) << endl;
+      cout << "t = " << to_string(r, 40) << endl;
+      cout << "c = " << to_string(d[i], 40) << endl;
+      success = false;
+      return;
+    }
+  }
+}
+
+static Quad refAdd(Quad x, Quad y) { return x + y; }
+static Quad refSub(Quad x, Quad y) { return x - y; }
+static Quad refMul(Quad x, Quad y) { return x * y; }
+
+void check(const char *name, binop_t add, binop_t sub, binop_t mul, ternop_t fma_) {
+  const size_t N = 1000003;
+  cout << "Checking " << name << " kernels" << endl;
+  checkBin("add", add, refAdd, N);
+  checkBin("sub", sub, refSub, N);
+  checkBin("mul", mul, refMul, N);
+  checkFMA("fma", fma_, N);
+  for(size_t n=0;n<20;n++) {
+    checkBin("add (short)", add, refAdd, n);
+    checkFMA("fma (short)", fma_, n);
+  }
+}
+
+int main(int argc, char **argv) {
+  __builtin_cpu_init();
+
+  check("generic", add2, sub2, mul2, fma2);
+  if (__builtin_cpu_supports("avx2")) check("AVX2", add4, sub4, mul4, fma4);
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512cd")) check("AVX-512", add8, sub8, mul8, fma8);
+
+  if (!success) {
+    cout << "NG" << endl;
+    exit(-1);
+  }
+
+  cout << "OK" << endl;
+  exit(0);
+}
@@ -0,0 +1,213 @@
+//  See https://github.com/shibatch/tlfloat for our project.
+//        Copyright Naoki Shibata and contributors.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <charconv>
+
+#include "suppress.hpp"
+
+#include "tlfloat/tlmath.hpp"
+#include "tlfloat/tlfloat.h"
+
+#include "testerutil.hpp"
+
+using namespace std;
+using namespace tlfloat;
+
+shared_ptr<RNG> rng = createPreferredRNG();
+
+bool success = true;
+
+template<typename T>
+bool same(T a, T b) {
+  if (isnan(a) && isnan(b)) return true;
+  return memcmp((void *)&a, (void *)&b, sizeof(T)) == 0;
+}
+
+template<typename T>
+T fromBits(uint64_t u) {
+  T x;
+  memcpy((void *)&x, (void *)&u, sizeof(T));
+  return x;
+}
+
+template<typename T>
+T rnd() {
+  uint64_t u[sizeof(T) / 8 + 1];
+  for(auto &w : u) w = rng->next64();
+  T x;
+  memcpy((void *)&x, (void *)u, sizeof(T));
+  return x;
+}
+
+// Parses a decimal string with a reference conversion
+
+template<typename T> T parse(const char *s);
+template<> Half parse<Half>(const char *s) { return Half(Double(strtod(s, nullptr))); }
+template<> BFloat16 parse<BFloat16>(const char *s) { return BFloat16(Double(strtod(s, nullptr))); }
+template<> Float parse<Float>(const char *s) { return Float(strtof(s, nullptr)); }
+template<> Double parse<Double>(const char *s) { return Double(strtod(s, nullptr)); }
+template<> Quad parse<Quad>(const char *s) { return Quad(Octuple(s)); }
+
+// Checks that the output reads back to x, and that no decimal with
+// fewer digits reads back to x
+
+template<typename T>
+void checkShortest(T x) {
+  char buf[1000];
+  snprintShortest(buf, sizeof(buf), x.getUnpacked(), 'e');
+
+  if (!same(parse<T>(buf), x)) {
+    cout << "NG : round trip, x = " << to_string(x, 40) << ", str = " << buf << endl;
+    success = false;
+    return;
+  }
+
+  if (isnan(x) || isinf(x) || iszero(x)) return;
+
+  char *eptr;
+  string digits;
+  for(char *p = buf;*p != 'e';p++) if ('0' <= *p && *p <= '9') digits += *p;
+  long e = strtol(strchr(buf, 'e') + 1, &eptr, 10);
+  if (digits.size() <= 1) return;
+
+  string prefix = digits.substr(0, digits.size() - 1);
+  for(int d=-1;d<=1;d++) {
+    BigUInt<7> m = BigUInt<7>(prefix.c_str()) + BigUInt<7>(d);
+    if (m == 0) continue;
+    string s = to_string(m) + "e" + std::to_string(e - (long)prefix.size() + 1);
+    if (x.getUnpacked().sign) s = "-" + s;
+    if (same(parse<T>(s.c_str()), x)) {
+      cout << "NG : not shortest, x = " << to_string(x, 40) << ", str = " << buf << ", " << s << endl;
+      success = false;
+      return;
+    }
+  }
+}
+
+// Compares the digits with std::to_chars, which gives the closest
+// among the shortest representations
+
+template<typename T, typename F>
+void checkToChars(F f) {
+#ifdef __cpp_lib_to_chars
+  char buf[1000], ref[1000];
+  snprintShortest(buf, sizeof(buf), T(f).getUnpacked(), 'e');
+  auto r = std::to_chars(ref, ref + sizeof(ref) - 1, f, std::chars_format::scientific);
+  *r.ptr = '\0';
+
+  // std::to_chars prints the exponent with at least two digits as %e does
+
+  if (strcmp(buf, ref) != 0) {
+    cout << "NG : to_chars, str = " << buf << ", ref = " << ref << endl;
+    success = false;
+  }
+#endif
+}
+
+template<typename T>
+void checkString(T x, const char *expected) {
+  string s = to_string_shortest(x);
+  if (s != expected) {
+    cout << "NG : to_string_shortest, str = " << s << ", expected = " << expected << endl;
+    success = false;
+  }
+}
+
+void checkPrintf(const char *fmt, const char *expected, ...) {
+  char buf[1000];
+  va_list ap;
+  va_start(ap, expected);
+  tlfloat_vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  if (strcmp(buf, expected) != 0) {
+    cout << "NG : printf, fmt = " << fmt << ", str = " << buf << ", expected = " << expected << endl;
+    success = false;
+  }
+}
+
+int main(int argc, char **argv) {
+  cout << "Checking Half and BFloat16 exhaustively" << endl;
+
+  for(uint64_t u=0;u<0x10000 && success;u++) {
+    checkShortest(fromBits<Half>(u));
+    checkShortest(fromBits<BFloat16>(u));
+  }
+
+  cout << "Checking Float and Double" << endl;
+
+  for(int i=0;i<300000 && success;i++) {
+    Float f = rnd<Float>();
+    Double d = rnd<Double>();
+    checkShortest(f);
+    checkShortest(d);
+    if (!isnan(f)) checkToChars<Float>((float)f);
+    if (!isnan(d)) checkToChars<Double>((double)d);
+  }
+
+  cout << "Checking Quad" << endl;
+
+  for(int i=0;i<20000 && success;i++) checkShortest(rnd<Quad>());
+
+  cout << "Checking Octuple" << endl;
+
+  // The string parser of Octuple is not always correctly rounded, and
+  // an error of 1 ulp is allowed in the round trip
+
+  for(int i=0;i<10000 && success;i++) {
+    Octuple x = rnd<Octuple>();
+    if (isnan(x)) continue;
+    string s = to_string_shortest(x);
+    Octuple y = Octuple(s.c_str());
+    if (!(same(x, y) || same(nextafter(x, y), y))) {
+      cout << "NG : round trip, x = " << to_string(x, 80) << ", str = " << s << endl;
+      success = false;
+    }
+  }
+
+  checkString(Quad(1) / 3, "0.3333333333333333333333333333333333");
+  checkString(Quad(2) / 3, "0.6666666666666666666666666666666666");
+  checkString(Quad("0.1"), "0.1");
+  checkString(Quad("1e+100"), "1e+100");
+  checkString(Quad::flt_max(), "1.189731495357231765085759326628007e+4932");
+  checkString(Quad::flt_min(), "3.3621031431120935062626778173217526e-4932");
+  checkString(Quad::flt_true_min(), "6e-4966");
+  checkString(-Quad(0), "-0");
+
+  checkString(Octuple(1) / 3, "0.333333333333333333333333333333333333333333333333333333333333333333333333");
+  checkString(Octuple(2) / 3, "0.666666666666666666666666666666666666666666666666666666666666666666666665");
+  checkString(Octuple::flt_max(), "1.61132571748576047361957211845200501064402387454966951747637125049607183e+78913");
+  checkString(Octuple::flt_min(), "2.48242795146434978829932822291387172367768770607964686927095329791378756e-78913");
+  checkString(Octuple::flt_true_min(), "2e-78984");
+
+  checkPrintf("%~g", "0.1", 0.1);
+  checkPrintf("%~e", "1.5e+300", 1.5e+300);
+  checkPrintf("%~f", "123.25", 123.25);
+  checkPrintf("%~g", "1e+06", 1e+6);
+  checkPrintf("%~.10g", "1000000", 1e+6);
+  checkPrintf("%~G", "1E+20", 1e+20);
+  checkPrintf("%~+10g", "     +0.25", 0.25);
+  checkPrintf("%~-10g|", "0.25      |", 0.25);
+  checkPrintf("%~010g", "-000000.25", -0.25);
+  checkPrintf("%~#e", "1.e+00", 1.0);
+  checkPrintf("%~f", "0.0001", 0.0001);
+  checkPrintf("%~g", "inf", 1.0 / 0.0);
+  checkPrintf("%~_128g", "0.3333333333333333333333333333333333", Quad(1) / 3);
+  checkPrintf("%~_32g", "0.1", Float(0.1f));
+  checkPrintf("%~_256e", "2e-78984", Octuple::flt_true_min());
+  checkPrintf("%~Lg %~d", "0.5 3", (long double)0.5, 3);
+
+  if (!success) {
+    cout << "NG" << endl;
+    return -1;
+  }
+
+  cout << "OK" << endl;
+  return 0;
+}
@@ -0,0 +1,94 @@
+//  See https://github.com/shibatch/tlfloat for our project.
+//        Copyright Naoki Shibata and contributors.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+
+#include "suppress.hpp"
+
+#include "tlfloat/tlmath.hpp"
+
+#include "testerutil.hpp"
+
+using namespace std;
+using namespace tlfloat;
+
+static_assert(Quad(unpacked(Quad(1)) / 3 * 3 - 1) == Quad(1) / 3 * 3 - 1);
+
+shared_ptr<RNG> rng = createPreferredRNG();
+
+template<typename T>
+T rnd() {
+  typedef decltype(T::to_Unpacked_t()) Unpacked_t;
+  const int nbexp = Unpacked_t::nbexp_(), nbmant = Unpacked_t::nbmant_();
+  uint64_t u[2] = { rng->next64(), rng->next64() };
+  switch(rng->nextLT(8)) {
+  case 0: return T(0);
+  case 1: case 2: {
+    // Exponent close to the minimum or the maximum
+    uint64_t e = rng->nextLT(2) ? rng->nextLT(4) : ((1 << nbexp) - 1 - rng->nextLT(4));
+    u[sizeof(T) / 8 - 1] &= ~(((uint64_t(1) << nbexp) - 1) << (nbmant - (sizeof(T) - 8) * 8));
+    u[sizeof(T) / 8 - 1] |= e << (nbmant - (sizeof(T) - 8) * 8);
+    break;
+  }
+  case 3: case 4: {
+    uint64_t e = (1 << (nbexp - 1)) - 1 - 20 + rng->nextLT(40);
+    u[sizeof(T) / 8 - 1] &= ~(((uint64_t(1) << nbexp) - 1) << (nbmant - (sizeof(T) - 8) * 8));
+    u[sizeof(T) / 8 - 1] |= e << (nbmant - (sizeof(T) - 8) * 8);
+    break;
+  }
+  default: break;
+  }
+  T x;
+  memcpy((void *)&x, u, sizeof(T));
+  return x;
+}
+
+template<typename T>
+bool same(T a, T b) {
+  if (isnan(a) && isnan(b)) return true;
+  return memcmp((void *)&a, (void *)&b, sizeof(T)) == 0;
+}
+
+template<typename T>
+bool checkType(const char *name) {
+  cout << "Checking " << name << endl;
+  for(int i=0;i<1000000;i++) {
+    T a = rnd<T>(), b = rnd<T>(), c = rnd<T>(), d = rnd<T>(), e = rnd<T>();
+
+    T t0 = a * b + c * d - e, c0 = unpacked(a) * b + unpacked(c) * d - e;
+    T t1 = (a / b - c) * (d + e), c1 = (unpacked(a) / b - c) * (d + unpacked(e));
+    T t2 = fma(a * b, c, -d) / e, c2 = fma(unpacked(a) * b, c, -unpacked(d)) / e;
+    T t3 = -(a - b) * 3 + c / 2;
+    UnpackedExpr<T> x = a;
+    x -= b; x *= -3; x += unpacked(c) / 2;
+    T c3 = x;
+
+    if (!same(t0, c0) || !same(t1, c1) || !same(t2, c2) || !same(t3, c3)) {
+      cout << "NG : " << name << endl;
+      cout << "a = " << to_string(a, 40) << endl;
+      cout << "b = " << to_string(b, 40) << endl;
+      cout << "c = " << to_string(c, 40) << endl;
+      cout << "d = " << to_string(d, 40) << endl;
+      cout << "e = " << to_string(e, 40) << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char **argv) {
+  bool success = checkType<Double>("Double") && checkType<Quad>("Quad");
+
+  if (!success) {
+    cout << "NG" << endl;
+    exit(-1);
+  }
+
+  cout << "OK" << endl;
+  exit(0);
+}
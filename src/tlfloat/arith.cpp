@@ -20,33 +20,21 @@ using namespace tlfloat;
 extern "C" {
   float tlfloat_addf(const float x, const float y) { return (float)(Float(x) + Float(y)); }
   double tlfloat_add(const double x, const double y) { return (double)(Double(x) + Double(y)); }
-  tlfloat_quad_ tlfloat_addq(const tlfloat_quad_ x, const tlfloat_quad_ y) { return (tlfloat_quad_)(Quad(x) + Quad(y)); }
-  tlfloat_octuple_ tlfloat_addo(const tlfloat_octuple_ x, const tlfloat_octuple_ y) { return (tlfloat_octuple_)(Octuple(x) + Octuple(y)); }
 
   float tlfloat_subf(const float x, const float y) { return (float)(Float(x) - Float(y)); }
   double tlfloat_sub(const double x, const double y) { return (double)(Double(x) - Double(y)); }
-  tlfloat_quad_ tlfloat_subq(const tlfloat_quad_ x, const tlfloat_quad_ y) { return (tlfloat_quad_)(Quad(x) - Quad(y)); }
-  tlfloat_octuple_ tlfloat_subo(const tlfloat_octuple_ x, const tlfloat_octuple_ y) { return (tlfloat_octuple_)(Octuple(x) - Octuple(y)); }
 
   float tlfloat_mulf(const float x, const float y) { return (float)(Float(x) * Float(y)); }
   double tlfloat_mul(const double x, const double y) { return (double)(Double(x) * Double(y)); }
-  tlfloat_quad_ tlfloat_mulq(const tlfloat_quad_ x, const tlfloat_quad_ y) { return (tlfloat_quad_)(Quad(x) * Quad(y)); }
-  tlfloat_octuple_ tlfloat_mulo(const tlfloat_octuple_ x, const tlfloat_octuple_ y) { return (tlfloat_octuple_)(Octuple(x) * Octuple(y)); }
 
   float tlfloat_divf(const float x, const float y) { return (float)(Float(x) / Float(y)); }
   double tlfloat_div(const double x, const double y) { return (double)(Double(x) / Double(y)); }
-  tlfloat_quad_ tlfloat_divq(const tlfloat_quad_ x, const tlfloat_quad_ y) { return (tlfloat_quad_)(Quad(x) / Quad(y)); }
-  tlfloat_octuple_ tlfloat_divo(const tlfloat_octuple_ x, const tlfloat_octuple_ y) { return (tlfloat_octuple_)(Octuple(x) / Octuple(y)); }
 
   float tlfloat_fmaf(const float x, const float y, const float z) { return (float)fma(Float(x), Float(y), Float(z)); }
   double tlfloat_fma(const double x, const double y, const double z) { return (double)fma(Double(x), Double(y), Double(z)); }
-  tlfloat_quad_ tlfloat_fmaq(const tlfloat_quad_ x, const tlfloat_quad_ y, const tlfloat_quad_ z) { return (tlfloat_quad_)fma(Quad(x), Quad(y), Quad(z)); }
-  tlfloat_octuple_ tlfloat_fmao(const tlfloat_octuple_ x, const tlfloat_octuple_ y, const tlfloat_octuple_ z) { return (tlfloat_octuple_)fma(Octuple(x), Octuple(y), Octuple(z)); }
 
   float tlfloat_sqrtf(const float x) { return (float)sqrt(Float(x)); }
   double tlfloat_sqrt(const double x) { return (double)sqrt(Double(x)); }
-  tlfloat_quad_ tlfloat_sqrtq(const tlfloat_quad_ x) { return (tlfloat_quad_)sqrt(Quad(x)); }
-  tlfloat_octuple_ tlfloat_sqrto(const tlfloat_octuple_ x) { return (tlfloat_octuple_)sqrt(Octuple(x)); }
 
   //
 
@@ -181,4 +169,56 @@ extern "C" {
   double tlfloat_rint(const double x) { return (double)rint(Double(x)); }
   tlfloat_quad_ tlfloat_rintq(const tlfloat_quad_ x) { return (tlfloat_quad_)rint(Quad(x)); }
   tlfloat_octuple_ tlfloat_rinto(const tlfloat_octuple_ x) { return (tlfloat_octuple_)rint(Octuple(x)); }
+
+  // tlfloat_addq_n, tlfloat_subq_n, tlfloat_mulq_n and tlfloat_fmaq_n are in quadlanes.cpp
+
+  void tlfloat_addo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)(Octuple(x[i]) + Octuple(y[i])); }
+
+  void tlfloat_subo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)(Octuple(x[i]) - Octuple(y[i])); }
+
+  void tlfloat_mulo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)(Octuple(x[i]) * Octuple(y[i])); }
+
+  void tlfloat_divq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)(Quad(x[i]) / Quad(y[i])); }
+  void tlfloat_divo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)(Octuple(x[i]) / Octuple(y[i])); }
+
+  void tlfloat_fmao_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, const tlfloat_octuple_ *z, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)fma(Octuple(x[i]), Octuple(y[i]), Octuple(z[i])); }
+
+  void tlfloat_sqrtq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)sqrt(Quad(x[i])); }
+  void tlfloat_sqrto_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)sqrt(Octuple(x[i])); }
+
+  void tlfloat_negq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)-Quad(x[i]); }
+  void tlfloat_nego_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)-Octuple(x[i]); }
+
+  void tlfloat_fabsq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)fabs(Quad(x[i])); }
+  void tlfloat_fabso_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)fabs(Octuple(x[i])); }
+
+  void tlfloat_copysignq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)copysign(Quad(x[i]), Quad(y[i])); }
+  void tlfloat_copysigno_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)copysign(Octuple(x[i]), Octuple(y[i])); }
+
+  void tlfloat_fmaxq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)fmax(Quad(x[i]), Quad(y[i])); }
+  void tlfloat_fmaxo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)fmax(Octuple(x[i]), Octuple(y[i])); }
+
+  void tlfloat_fminq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)fmin(Quad(x[i]), Quad(y[i])); }
+  void tlfloat_fmino_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)fmin(Octuple(x[i]), Octuple(y[i])); }
+
+  void tlfloat_fdimq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)fdim(Quad(x[i]), Quad(y[i])); }
+  void tlfloat_fdimo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)fdim(Octuple(x[i]), Octuple(y[i])); }
+
+  void tlfloat_hypotq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)hypot(Quad(x[i]), Quad(y[i])); }
+  void tlfloat_hypoto_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)hypot(Octuple(x[i]), Octuple(y[i])); }
+
+  void tlfloat_truncq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)trunc(Quad(x[i])); }
+  void tlfloat_trunco_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)trunc(Octuple(x[i])); }
+
+  void tlfloat_floorq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)floor(Quad(x[i])); }
+  void tlfloat_flooro_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)floor(Octuple(x[i])); }
+
+  void tlfloat_ceilq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)ceil(Quad(x[i])); }
+  void tlfloat_ceilo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)ceil(Octuple(x[i])); }
+
+  void tlfloat_roundq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)round(Quad(x[i])); }
+  void tlfloat_roundo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)round(Octuple(x[i])); }
+
+  void tlfloat_rintq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)rint(Quad(x[i])); }
+  void tlfloat_rinto_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)rint(Octuple(x[i])); }
 }
@@ -0,0 +1,88 @@
+//  See https://github.com/shibatch/tlfloat for our project.
+//        Copyright Naoki Shibata and contributors.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstring>
+#include <cctype>
+#include <cstdarg>
+
+#include "suppress.hpp"
+
+#define TLFLOAT_NO_LIBSTDCXX
+
+#if !defined(TLFLOAT_ENABLE_DISPATCH)
+#include "dispatch.hpp"
+#else // #if !defined(TLFLOAT_ENABLE_DISPATCH)
+#define TLFLOAT_DISPATCH_VARIANT generic
+#include "dispatch.hpp"
+
+// The functions below are resolved at load time to the variant
+// compiled for AVX-512 IFMA, for BMI2 and ADX, or for the baseline
+// x86-64 instruction set.
+
+#define TLFLOAT_DISPATCH_DECLARE(variant)				\
+  extern "C" {								\
+    TLFLOAT_DISPATCH_ATTR tlfloat_quad_ tlfloat_addq_ ## variant(const tlfloat_quad_ x, const tlfloat_quad_ y); \
+    TLFLOAT_DISPATCH_ATTR tlfloat_octuple_ tlfloat_addo_ ## variant(const tlfloat_octuple_ x, const tlfloat_octuple_ y); \
+    TLFLOAT_DISPATCH_ATTR tlfloat_quad_ tlfloat_subq_ ## variant(const tlfloat_quad_ x, const tlfloat_quad_ y); \
+    TLFLOAT_DISPATCH_ATTR tlfloat_octuple_ tlfloat_subo_ ## variant(const tlfloat_octuple_ x, const tlfloat_octuple_ y); \
+    TLFLOAT_DISPATCH_ATTR tlfloat_quad_ tlfloat_mulq_ ## variant(const tlfloat_quad_ x, const tlfloat_quad_ y); \
+    TLFLOAT_DISPATCH_ATTR tlfloat_octuple_ tlfloat_mulo_ ## variant(const tlfloat_octuple_ x, const tlfloat_octuple_ y); \
+    TLFLOAT_DISPATCH_ATTR tlfloat_quad_ tlfloat_divq_ ## variant(const tlfloat_quad_ x, const tlfloat_quad_ y); \
+    TLFLOAT_DISPATCH_ATTR tlfloat_octuple_ tlfloat_divo_ ## variant(const tlfloat_octuple_ x, const tlfloat_octuple_ y); \
+    TLFLOAT_DISPATCH_ATTR tlfloat_quad_ tlfloat_fmaq_ ## variant(const tlfloat_quad_ x, const tlfloat_quad_ y, const tlfloat_quad_ z); \
+    TLFLOAT_DISPATCH_ATTR tlfloat_octuple_ tlfloat_fmao_ ## variant(const tlfloat_octuple_ x, const tlfloat_octuple_ y, const tlfloat_octuple_ z); \
+    TLFLOAT_DISPATCH_ATTR tlfloat_quad_ tlfloat_sqrtq_ ## variant(const tlfloat_quad_ x); \
+    TLFLOAT_DISPATCH_ATTR tlfloat_octuple_ tlfloat_sqrto_ ## variant(const tlfloat_octuple_ x); \
+  }
+
+TLFLOAT_DISPATCH_DECLARE(bmi2)
+TLFLOAT_DISPATCH_DECLARE(avx512)
+
+static int dispatchLevel() {
+  __builtin_cpu_init();
+  const bool bmi2 = __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("adx");
+  if (bmi2 && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma")) return 2;
+  if (bmi2) return 1;
+  return 0;
+}
+
+#define TLFLOAT_DISPATCH_RESOLVER(name)					\
+  static decltype(&name ## _generic) name ## _resolver() {		\
+    switch(dispatchLevel()) {						\
+    case 2: return name ## _avx512;					\
+    case 1: return name ## _bmi2;					\
+    default: return name ## _generic;					\
+    }									\
+  }
+
+extern "C" {
+  TLFLOAT_DISPATCH_RESOLVER(tlfloat_addq)
+  TLFLOAT_DISPATCH_RESOLVER(tlfloat_addo)
+  TLFLOAT_DISPATCH_RESOLVER(tlfloat_subq)
+  TLFLOAT_DISPATCH_RESOLVER(tlfloat_subo)
+  TLFLOAT_DISPATCH_RESOLVER(tlfloat_mulq)
+  TLFLOAT_DISPATCH_RESOLVER(tlfloat_mulo)
+  TLFLOAT_DISPATCH_RESOLVER(tlfloat_divq)
+  TLFLOAT_DISPATCH_RESOLVER(tlfloat_divo)
+  TLFLOAT_DISPATCH_RESOLVER(tlfloat_fmaq)
+  TLFLOAT_DISPATCH_RESOLVER(tlfloat_fmao)
+  TLFLOAT_DISPATCH_RESOLVER(tlfloat_sqrtq)
+  TLFLOAT_DISPATCH_RESOLVER(tlfloat_sqrto)
+
+  tlfloat_quad_ tlfloat_addq(const tlfloat_quad_ x, const tlfloat_quad_ y) __attribute__((ifunc("tlfloat_addq_resolver")));
+  tlfloat_octuple_ tlfloat_addo(const tlfloat_octuple_ x, const tlfloat_octuple_ y) __attribute__((ifunc("tlfloat_addo_resolver")));
+  tlfloat_quad_ tlfloat_subq(const tlfloat_quad_ x, const tlfloat_quad_ y) __attribute__((ifunc("tlfloat_subq_resolver")));
+  tlfloat_octuple_ tlfloat_subo(const tlfloat_octuple_ x, const tlfloat_octuple_ y) __attribute__((ifunc("tlfloat_subo_resolver")));
+  tlfloat_quad_ tlfloat_mulq(const tlfloat_quad_ x, const tlfloat_quad_ y) __attribute__((ifunc("tlfloat_mulq_resolver")));
+  tlfloat_octuple_ tlfloat_mulo(const tlfloat_octuple_ x, const tlfloat_octuple_ y) __attribute__((ifunc("tlfloat_mulo_resolver")));
+  tlfloat_quad_ tlfloat_divq(const tlfloat_quad_ x, const tlfloat_quad_ y) __attribute__((ifunc("tlfloat_divq_resolver")));
+  tlfloat_octuple_ tlfloat_divo(const tlfloat_octuple_ x, const tlfloat_octuple_ y) __attribute__((ifunc("tlfloat_divo_resolver")));
+  tlfloat_quad_ tlfloat_fmaq(const tlfloat_quad_ x, const tlfloat_quad_ y, const tlfloat_quad_ z) __attribute__((ifunc("tlfloat_fmaq_resolver")));
+  tlfloat_octuple_ tlfloat_fmao(const tlfloat_octuple_ x, const tlfloat_octuple_ y, const tlfloat_octuple_ z) __attribute__((ifunc("tlfloat_fmao_resolver")));
+  tlfloat_quad_ tlfloat_sqrtq(const tlfloat_quad_ x) __attribute__((ifunc("tlfloat_sqrtq_resolver")));
+  tlfloat_octuple_ tlfloat_sqrto(const tlfloat_octuple_ x) __attribute__((ifunc("tlfloat_sqrto_resolver")));
+}
+#endif // #if !defined(TLFLOAT_ENABLE_DISPATCH)
@@ -0,0 +1,45 @@
+//  See https://github.com/shibatch/tlfloat for our project.
+//        Copyright Naoki Shibata and contributors.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// The variant of the functions in dispatch.hpp for processors with
+// BMI2 and ADX. The 64x64-bit products in BigUInt multiplication are
+// computed with mulx, which does not touch the flags, and the
+// compiler can keep the carry chains of the additions in between.
+
+#include <bit>
+#include <cstdint>
+#include <cmath>
+#include <cstring>
+#include <cassert>
+#include <cstdio>
+#include <type_traits>
+
+#include "suppress.hpp"
+
+#define TLFLOAT_NO_LIBSTDCXX
+
+#if defined(TLFLOAT_ENABLE_DISPATCH)
+#include <x86intrin.h>
+
+// The standard headers are included above so that only the code in
+// the tlfloat headers is compiled for the target. Inline functions
+// in the standard headers can then be shared with the other
+// variants without the risk of executing unsupported instructions.
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("bmi2,adx"))), apply_to = function)
+#else
+#pragma GCC target("bmi2,adx")
+#endif
+
+#define tlfloat tlfloat_bmi2
+#define TLFLOAT_DISPATCH_VARIANT bmi2
+#include "dispatch.hpp"
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#endif
+#endif // #if defined(TLFLOAT_ENABLE_DISPATCH)
@@ -62,4 +62,33 @@ extern "C" {
   double tlfloat_pow(const double x, const double y) { return (double)pow(Double(x), Double(y)); }
   tlfloat_quad_ tlfloat_powq(const tlfloat_quad_ x, const tlfloat_quad_ y) { return (tlfloat_quad_)pow(Quad(x), Quad(y)); }
   tlfloat_octuple_ tlfloat_powo(const tlfloat_octuple_ x, const tlfloat_octuple_ y) { return (tlfloat_octuple_)pow(Octuple(x), Octuple(y)); }
+
+  //
+
+  void tlfloat_expq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)exp(Quad(x[i])); }
+  void tlfloat_expo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)exp(Octuple(x[i])); }
+
+  void tlfloat_expm1q_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)expm1(Quad(x[i])); }
+  void tlfloat_expm1o_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)expm1(Octuple(x[i])); }
+
+  void tlfloat_exp2q_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)exp2(Quad(x[i])); }
+  void tlfloat_exp2o_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)exp2(Octuple(x[i])); }
+
+  void tlfloat_exp10q_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)exp10(Quad(x[i])); }
+  void tlfloat_exp10o_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)exp10(Octuple(x[i])); }
+
+  void tlfloat_logq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)log(Quad(x[i])); }
+  void tlfloat_logo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)log(Octuple(x[i])); }
+
+  void tlfloat_log1pq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)log1p(Quad(x[i])); }
+  void tlfloat_log1po_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)log1p(Octuple(x[i])); }
+
+  void tlfloat_log2q_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)log2(Quad(x[i])); }
+  void tlfloat_log2o_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)log2(Octuple(x[i])); }
+
+  void tlfloat_log10q_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)log10(Quad(x[i])); }
+  void tlfloat_log10o_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)log10(Octuple(x[i])); }
+
+  void tlfloat_powq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)pow(Quad(x[i]), Quad(y[i])); }
+  void tlfloat_powo_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, const tlfloat_octuple_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)pow(Octuple(x[i]), Octuple(y[i])); }
 }
@@ -172,6 +172,25 @@ extern "C" {
     return std::bit_cast<tlfloat_uint128_t_>(std::bit_cast<BigUInt<7>>(x) >> y);
   }
 
+  tlfloat_int128_t_ tlfloat_gcd_i128_i128(const tlfloat_int128_t_ x, const tlfloat_int128_t_ y) {
+    return std::bit_cast<tlfloat_int128_t_>(std::bit_cast<BigInt<7>>(x).gcd(std::bit_cast<BigInt<7>>(y)));
+  }
+  tlfloat_int128_t_ tlfloat_extgcd_i128_i128(const tlfloat_int128_t_ x, const tlfloat_int128_t_ y, tlfloat_int128_t_ *s, tlfloat_int128_t_ *t) {
+    BigInt<7> bs, bt, g = std::bit_cast<BigInt<7>>(x).extgcd(std::bit_cast<BigInt<7>>(y), &bs, &bt);
+    if (s) *s = std::bit_cast<tlfloat_int128_t_>(bs);
+    if (t) *t = std::bit_cast<tlfloat_int128_t_>(bt);
+    return std::bit_cast<tlfloat_int128_t_>(g);
+  }
+  tlfloat_int128_t_ tlfloat_modinv_i128_i128(const tlfloat_int128_t_ x, const tlfloat_int128_t_ m) {
+    return std::bit_cast<tlfloat_int128_t_>(std::bit_cast<BigInt<7>>(x).modinv(std::bit_cast<BigInt<7>>(m)));
+  }
+  tlfloat_uint128_t_ tlfloat_gcd_u128_u128(const tlfloat_uint128_t_ x, const tlfloat_uint128_t_ y) {
+    return std::bit_cast<tlfloat_uint128_t_>(std::bit_cast<BigUInt<7>>(x).gcd(std::bit_cast<BigUInt<7>>(y)));
+  }
+  tlfloat_uint128_t_ tlfloat_modinv_u128_u128(const tlfloat_uint128_t_ x, const tlfloat_uint128_t_ m) {
+    return std::bit_cast<tlfloat_uint128_t_>(std::bit_cast<BigUInt<7>>(x).modinv(std::bit_cast<BigUInt<7>>(m)));
+  }
+
   //
 
   float tlfloat_cbrtf(const float a) { return (float)cbrt(Float(a)); }
@@ -23,6 +23,18 @@
 using namespace tlfloat;
 
 namespace {
+  template<typename T>
+  static int snprintValue(char *xbuf, size_t xbufsize, const T& value, char typespec, int width, int precision, bool flag_shortest,
+			  bool flag_sign, bool flag_blank, bool flag_alt, bool flag_left, bool flag_zero, bool flag_upper) {
+    if (flag_shortest) {
+      return snprintShortest(xbuf, xbufsize, value.getUnpacked(), tolower(typespec), width, precision,
+			     flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
+    }
+    typedef decltype(decltype(value.getUnpacked())::xUnpackedFloat()) xUnpacked_t;
+    return snprint(xbuf, xbufsize, value.getUnpacked().cast((xUnpacked_t *)0), typespec, width, precision,
+		   flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
+  }
+
   static int xvprintf(size_t (*consumer)(const char *ptr, size_t size, void *arg), void *arg, const char *fmt, va_list ap) {
     const int xbufsize = 5000;
     char *xbuf = (char *)calloc(xbufsize+10, 1);
@@ -58,6 +70,7 @@ namespace {
 
       bool flag_left = false, flag_sign = false, flag_blank = false;
       bool flag_alt = false, flag_zero = false, flag_upper = false, done = false;
+      bool flag_shortest = false;
       do {
 	switch(*fmt) {
 	case '-': flag_left  = true; break;
@@ -65,6 +78,7 @@ namespace {
 	case ' ': flag_blank = true; break;
 	case '#': flag_alt   = true; break;
 	case '0': flag_zero  = true; break;
+	case '~': flag_shortest = true; break;
 	default:  done       = true; break;
 	}
       } while(!done && (*++fmt) != 0);
@@ -152,25 +166,29 @@ namespace {
 	  if (nbits == 0) {
 	    if (size_prefix == 'Q') {
 	      Quad value = std::bit_cast<Quad>(va_arg(ap, tlfloat_quad_));
-	      typedef decltype(decltype(value.getUnpacked())::xUnpackedFloat()) xUnpacked_t;
-	      int ret = snprint(xbuf, xbufsize, value.getUnpacked().cast((xUnpacked_t *)0), *fmt, width, precision, 
-				flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
+	      int ret = snprintValue(xbuf, xbufsize, value, *fmt, width, precision, flag_shortest,
+				     flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
 	      if (ret < 0) { errorflag = 1; break; }
 	      outlen += (*consumer)(xbuf, strlen(xbuf), arg);
 	      subfmt_processed = true;
 	    } else if (size_prefix == 'P') {
 	      Quad value = std::bit_cast<Quad>(*(tlfloat_quad_ *)va_arg(ap, tlfloat_quad_ *));
-	      typedef decltype(decltype(value.getUnpacked())::xUnpackedFloat()) xUnpacked_t;
-	      int ret = snprint(xbuf, xbufsize, value.getUnpacked().cast((xUnpacked_t *)0), *fmt, width, precision, 
-				flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
+	      int ret = snprintValue(xbuf, xbufsize, value, *fmt, width, precision, flag_shortest,
+				     flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
 	      if (ret < 0) { errorflag = 1; break; }
 	      outlen += (*consumer)(xbuf, strlen(xbuf), arg);
 	      subfmt_processed = true;
 	    } else if (size_prefix == 'O') {
 	      Octuple value = std::bit_cast<Octuple>(va_arg(ap, tlfloat_octuple_));
-	      typedef decltype(decltype(value.getUnpacked())::xUnpackedFloat()) xUnpacked_t;
-	      int ret = snprint(xbuf, xbufsize, value.getUnpacked().cast((xUnpacked_t *)0), *fmt, width, precision, 
-				flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
+	      int ret = snprintValue(xbuf, xbufsize, value, *fmt, width, precision, flag_shortest,
+				     flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
+	      if (ret < 0) { errorflag = 1; break; }
+	      outlen += (*consumer)(xbuf, strlen(xbuf), arg);
+	      subfmt_processed = true;
+	    } else if (size_prefix == 0 && flag_shortest) {
+	      Double value = Double(va_arg(ap, double));
+	      int ret = snprintValue(xbuf, xbufsize, value, *fmt, width, precision, flag_shortest,
+				     flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
 	      if (ret < 0) { errorflag = 1; break; }
 	      outlen += (*consumer)(xbuf, strlen(xbuf), arg);
 	      subfmt_processed = true;
@@ -184,9 +202,8 @@ namespace {
 	    case 16: {
 	      typedef struct { uint16_t e; } arg_t;
 	      Half value = std::bit_cast<Half>(va_arg(ap, arg_t));
-	      typedef decltype(decltype(value.getUnpacked())::xUnpackedFloat()) xUnpacked_t;
-	      int ret = snprint(xbuf, xbufsize, value.getUnpacked().cast((xUnpacked_t *)0), *fmt, width, precision, 
-				flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
+	      int ret = snprintValue(xbuf, xbufsize, value, *fmt, width, precision, flag_shortest,
+				     flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
 	      if (ret < 0) { errorflag = 1; break; }
 	      outlen += (*consumer)(xbuf, strlen(xbuf), arg);
 	      subfmt_processed = true;
@@ -195,9 +212,8 @@ namespace {
 	    case 32: {
 	      typedef struct { uint32_t e; } arg_t;
 	      Float value = std::bit_cast<Float>(va_arg(ap, arg_t));
-	      typedef decltype(decltype(value.getUnpacked())::xUnpackedFloat()) xUnpacked_t;
-	      int ret = snprint(xbuf, xbufsize, value.getUnpacked().cast((xUnpacked_t *)0), *fmt, width, precision, 
-				flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
+	      int ret = snprintValue(xbuf, xbufsize, value, *fmt, width, precision, flag_shortest,
+				     flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
 	      if (ret < 0) { errorflag = 1; break; }
 	      outlen += (*consumer)(xbuf, strlen(xbuf), arg);
 	      subfmt_processed = true;
@@ -206,9 +222,8 @@ namespace {
 	    case 64: {
 	      typedef struct { uint64_t e[1]; } arg_t;
 	      Double value = std::bit_cast<Double>(va_arg(ap, arg_t));
-	      typedef decltype(decltype(value.getUnpacked())::xUnpackedFloat()) xUnpacked_t;
-	      int ret = snprint(xbuf, xbufsize, value.getUnpacked().cast((xUnpacked_t *)0), *fmt, width, precision, 
-				flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
+	      int ret = snprintValue(xbuf, xbufsize, value, *fmt, width, precision, flag_shortest,
+				     flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
 	      if (ret < 0) { errorflag = 1; break; }
 	      outlen += (*consumer)(xbuf, strlen(xbuf), arg);
 	      subfmt_processed = true;
@@ -217,9 +232,8 @@ namespace {
 	    case 128: {
 	      typedef struct { uint64_t e[2]; } arg_t;
 	      Quad value = std::bit_cast<Quad>(va_arg(ap, arg_t));
-	      typedef decltype(decltype(value.getUnpacked())::xUnpackedFloat()) xUnpacked_t;
-	      int ret = snprint(xbuf, xbufsize, value.getUnpacked().cast((xUnpacked_t *)0), *fmt, width, precision, 
-				flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
+	      int ret = snprintValue(xbuf, xbufsize, value, *fmt, width, precision, flag_shortest,
+				     flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
 	      if (ret < 0) { errorflag = 1; break; }
 	      outlen += (*consumer)(xbuf, strlen(xbuf), arg);
 	      subfmt_processed = true;
@@ -228,9 +242,8 @@ namespace {
 	    case 256: {
 	      typedef struct { uint64_t e[4]; } arg_t;
 	      Octuple value = std::bit_cast<Octuple>(va_arg(ap, arg_t));
-	      typedef decltype(decltype(value.getUnpacked())::xUnpackedFloat()) xUnpacked_t;
-	      int ret = snprint(xbuf, xbufsize, value.getUnpacked().cast((xUnpacked_t *)0), *fmt, width, precision, 
-				flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
+	      int ret = snprintValue(xbuf, xbufsize, value, *fmt, width, precision, flag_shortest,
+				     flag_sign, flag_blank, flag_alt, flag_left, flag_zero, flag_upper);
 	      if (ret < 0) { errorflag = 1; break; }
 	      outlen += (*consumer)(xbuf, strlen(xbuf), arg);
 	      subfmt_processed = true;
@@ -364,8 +377,9 @@ namespace {
 
       if (!subfmt_processed) {
 	char *subfmt = (char *)calloc(fmt - subfmtstart + 2, 1);
-	memcpy(subfmt, subfmtstart, fmt - subfmtstart + 1);
-	subfmt[fmt - subfmtstart + 1] = 0;
+	int sublen = 0;
+	for(const char *p = subfmtstart;p <= fmt;p++) if (*p != '~') subfmt[sublen++] = *p;
+	subfmt[sublen] = 0;
 	int ret = ::vsnprintf(xbuf, xbufsize, subfmt, ap2);
 	free(subfmt);
 	if (ret < 0) { errorflag = 1; break; }
@@ -0,0 +1,78 @@
+//  See https://github.com/shibatch/tlfloat for our project.
+//        Copyright Naoki Shibata and contributors.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstring>
+#include <cctype>
+#include <cstdarg>
+
+#include "suppress.hpp"
+
+#define TLFLOAT_NO_LIBSTDCXX
+#include "tlfloat/tlmath.hpp"
+
+#include "tlfloat/tlfloat.h"
+
+using namespace tlfloat;
+
+#if !defined(TLFLOAT_ENABLE_QUADLANES)
+extern "C" {
+  void tlfloat_addq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)(Quad(x[i]) + Quad(y[i])); }
+  void tlfloat_subq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)(Quad(x[i]) - Quad(y[i])); }
+  void tlfloat_mulq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)(Quad(x[i]) * Quad(y[i])); }
+  void tlfloat_fmaq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, const tlfloat_quad_ *z, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)fma(Quad(x[i]), Quad(y[i]), Quad(z[i])); }
+}
+#else // #if !defined(TLFLOAT_ENABLE_QUADLANES)
+#include "quadlanes.hpp"
+
+// The functions below are resolved at load time to the AVX-512 or
+// AVX2 lane kernels, or to the scalar loops on other processors.
+
+#define TLFLOAT_AVX2 __attribute__((target("avx2")))
+#define TLFLOAT_AVX512 __attribute__((target("avx512f,avx512cd")))
+
+static void addq_n_scalar(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)(Quad(x[i]) + Quad(y[i])); }
+static void subq_n_scalar(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)(Quad(x[i]) - Quad(y[i])); }
+static void mulq_n_scalar(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)(Quad(x[i]) * Quad(y[i])); }
+static void fmaq_n_scalar(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, const tlfloat_quad_ *z, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)fma(Quad(x[i]), Quad(y[i]), Quad(z[i])); }
+
+TLFLOAT_AVX2 static void addq_n_avx2(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) { detail::addsubLanes<4>(dst, x, y, n, false); }
+TLFLOAT_AVX2 static void subq_n_avx2(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) { detail::addsubLanes<4>(dst, x, y, n, true); }
+TLFLOAT_AVX2 static void mulq_n_avx2(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) { detail::mulLanes<4>(dst, x, y, n); }
+TLFLOAT_AVX2 static void fmaq_n_avx2(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, const tlfloat_quad_ *z, size_t n) { detail::fmaLanes<4>(dst, x, y, z, n); }
+
+TLFLOAT_AVX512 static void addq_n_avx512(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) { detail::addsubLanes<8>(dst, x, y, n, false); }
+TLFLOAT_AVX512 static void subq_n_avx512(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) { detail::addsubLanes<8>(dst, x, y, n, true); }
+TLFLOAT_AVX512 static void mulq_n_avx512(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) { detail::mulLanes<8>(dst, x, y, n); }
+TLFLOAT_AVX512 static void fmaq_n_avx512(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, const tlfloat_quad_ *z, size_t n) { detail::fmaLanes<8>(dst, x, y, z, n); }
+
+static int quadLanesWidth() {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512cd")) return 8;
+  if (__builtin_cpu_supports("avx2")) return 4;
+  return 1;
+}
+
+#define TLFLOAT_QUADLANES_RESOLVER(name)				\
+  static decltype(&name ## _scalar) tlfloat_ ## name ## _resolver() {	\
+    switch(quadLanesWidth()) {						\
+    case 8: return name ## _avx512;					\
+    case 4: return name ## _avx2;					\
+    default: return name ## _scalar;					\
+    }									\
+  }
+
+extern "C" {
+  TLFLOAT_QUADLANES_RESOLVER(addq_n)
+  TLFLOAT_QUADLANES_RESOLVER(subq_n)
+  TLFLOAT_QUADLANES_RESOLVER(mulq_n)
+  TLFLOAT_QUADLANES_RESOLVER(fmaq_n)
+
+  void tlfloat_addq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) __attribute__((ifunc("tlfloat_addq_n_resolver")));
+  void tlfloat_subq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) __attribute__((ifunc("tlfloat_subq_n_resolver")));
+  void tlfloat_mulq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, size_t n) __attribute__((ifunc("tlfloat_mulq_n_resolver")));
+  void tlfloat_fmaq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, const tlfloat_quad_ *y, const tlfloat_quad_ *z, size_t n) __attribute__((ifunc("tlfloat_fmaq_n_resolver")));
+}
+#endif // #if !defined(TLFLOAT_ENABLE_QUADLANES)
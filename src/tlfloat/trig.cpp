@@ -73,4 +73,46 @@ extern "C" {
   void tlfloat_sincospio(const tlfloat_octuple_ x, tlfloat_octuple_ *s, tlfloat_octuple_ *c) {
     auto a = sincospi(Octuple(x)); *s = (tlfloat_octuple_)a.first; *c = (tlfloat_octuple_)a.second;
   }
+
+  //
+
+  void tlfloat_sinq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)sin(Quad(x[i])); }
+  void tlfloat_sino_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)sin(Octuple(x[i])); }
+
+  void tlfloat_cosq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)cos(Quad(x[i])); }
+  void tlfloat_coso_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)cos(Octuple(x[i])); }
+
+  void tlfloat_tanq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)tan(Quad(x[i])); }
+  void tlfloat_tano_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)tan(Octuple(x[i])); }
+
+  void tlfloat_sinpiq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)sinpi(Quad(x[i])); }
+  void tlfloat_sinpio_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)sinpi(Octuple(x[i])); }
+
+  void tlfloat_cospiq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)cospi(Quad(x[i])); }
+  void tlfloat_cospio_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)cospi(Octuple(x[i])); }
+
+  void tlfloat_tanpiq_n(tlfloat_quad_ *dst, const tlfloat_quad_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_quad_)tanpi(Quad(x[i])); }
+  void tlfloat_tanpio_n(tlfloat_octuple_ *dst, const tlfloat_octuple_ *x, size_t n) { for(size_t i=0;i<n;i++) dst[i] = (tlfloat_octuple_)tanpi(Octuple(x[i])); }
+
+  void tlfloat_sincosq_n(tlfloat_quad_ *s, tlfloat_quad_ *c, const tlfloat_quad_ *x, size_t n) {
+    for(size_t i=0;i<n;i++) {
+      auto a = sincos(Quad(x[i])); s[i] = (tlfloat_quad_)a.first; c[i] = (tlfloat_quad_)a.second;
+    }
+  }
+  void tlfloat_sincoso_n(tlfloat_octuple_ *s, tlfloat_octuple_ *c, const tlfloat_octuple_ *x, size_t n) {
+    for(size_t i=0;i<n;i++) {
+      auto a = sincos(Octuple(x[i])); s[i] = (tlfloat_octuple_)a.first; c[i] = (tlfloat_octuple_)a.second;
+    }
+  }
+
+  void tlfloat_sincospiq_n(tlfloat_quad_ *s, tlfloat_quad_ *c, const tlfloat_quad_ *x, size_t n) {
+    for(size_t i=0;i<n;i++) {
+      auto a = sincospi(Quad(x[i])); s[i] = (tlfloat_quad_)a.first; c[i] = (tlfloat_quad_)a.second;
+    }
+  }
+  void tlfloat_sincospio_n(tlfloat_octuple_ *s, tlfloat_octuple_ *c, const tlfloat_octuple_ *x, size_t n) {
+    for(size_t i=0;i<n;i++) {
+      auto a = sincospi(Octuple(x[i])); s[i] = (tlfloat_octuple_)a.first; c[i] = (tlfloat_octuple_)a.second;
+    }
+  }
 }
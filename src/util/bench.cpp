@@ -29,6 +29,37 @@ typedef Quad real;
 #define LOG	log
 #define POW	pow
 
+#elif defined(CONFIG_TLFLOAT_QUAD_ARRAY)
+
+#include <tlfloat/tlmath.hpp>
+#include <tlfloat/tlfloat.h>
+#define CONFIG "tlfloat quad and array C API"
+using namespace tlfloat;
+typedef Quad real;
+
+#define FMA	fma
+#define SQRT	sqrt
+#define RINT    rint
+#define SIN	sin
+#define ATAN	atan
+#define EXP	exp
+#define LOG	log
+#define POW	pow
+
+typedef tlfloat_quad_ creal;
+
+#define ADD_N	tlfloat_addq_n
+#define SUB_N	tlfloat_subq_n
+#define MUL_N	tlfloat_mulq_n
+#define DIV_N	tlfloat_divq_n
+#define FMA_N	tlfloat_fmaq_n
+#define SQRT_N	tlfloat_sqrtq_n
+#define RINT_N	tlfloat_rintq_n
+#define SIN_N	tlfloat_sinq_n
+#define EXP_N	tlfloat_expq_n
+#define LOG_N	tlfloat_logq_n
+#define POW_N	tlfloat_powq_n
+
 #elif defined(CONFIG_TLFLOAT_OCTUPLE)
 
 #include <tlfloat/tlmath.hpp>
@@ -60,6 +91,20 @@ typedef tlfloat_quad real;
 #define LOG	tlfloat_logq
 #define POW	tlfloat_powq
 
+typedef tlfloat_quad_ creal;
+
+#define ADD_N	tlfloat_addq_n
+#define SUB_N	tlfloat_subq_n
+#define MUL_N	tlfloat_mulq_n
+#define DIV_N	tlfloat_divq_n
+#define FMA_N	tlfloat_fmaq_n
+#define SQRT_N	tlfloat_sqrtq_n
+#define RINT_N	tlfloat_rintq_n
+#define SIN_N	tlfloat_sinq_n
+#define EXP_N	tlfloat_expq_n
+#define LOG_N	tlfloat_logq_n
+#define POW_N	tlfloat_powq_n
+
 #elif defined(CONFIG_TLFLOAT_OCTUPLE_CAPI)
 
 #include <tlfloat/tlfloat.h>
@@ -75,6 +120,20 @@ typedef tlfloat_octuple real;
 #define LOG	tlfloat_logo
 #define POW	tlfloat_powo
 
+typedef tlfloat_octuple_ creal;
+
+#define ADD_N	tlfloat_addo_n
+#define SUB_N	tlfloat_subo_n
+#define MUL_N	tlfloat_mulo_n
+#define DIV_N	tlfloat_divo_n
+#define FMA_N	tlfloat_fmao_n
+#define SQRT_N	tlfloat_sqrto_n
+#define RINT_N	tlfloat_rinto_n
+#define SIN_N	tlfloat_sino_n
+#define EXP_N	tlfloat_expo_n
+#define LOG_N	tlfloat_logo_n
+#define POW_N	tlfloat_powo_n
+
 #elif defined(CONFIG_LIBQUADMATH)
 
 #define CONFIG "Libquadmath"
@@ -186,6 +245,25 @@ static void funcPow() {
   for(int i=0;i<K;i++) D.W[i] = POW(D.X[i], D.Y[i]);
 }
 
+#ifdef ADD_N
+#define A(x) ((creal *)(x))
+
+static void funcAddSubN() {
+  ADD_N(A(D.W), A(D.X), A(D.Y), K/2);
+  SUB_N(A(D.W + K/2), A(D.X + K/2), A(D.Y + K/2), K/2);
+}
+
+static void funcMulN() { MUL_N(A(D.W), A(D.X), A(D.Y), K); }
+static void funcDivN() { DIV_N(A(D.W), A(D.X), A(D.Y), K); }
+static void funcFMAN() { FMA_N(A(D.W), A(D.X), A(D.Y), A(D.Z), K); }
+static void funcSqrtN() { SQRT_N(A(D.W), A(D.H), K); }
+static void funcRintN() { RINT_N(A(D.W), A(D.H), K); }
+static void funcSinN() { SIN_N(A(D.W), A(D.X), K); }
+static void funcExpN() { EXP_N(A(D.W), A(D.X), K); }
+static void funcLogN() { LOG_N(A(D.W), A(D.H), K); }
+static void funcPowN() { POW_N(A(D.W), A(D.X), A(D.Y), K); }
+#endif
+
 void donothing(void *);
 
 static inline int64_t timeus() {
@@ -246,5 +324,18 @@ int main(int argc, char **argv) {
   measure("Log                 ", funcLog        , K, sec_us);
   measure("Pow                 ", funcPow        , K, sec_us);
 
+#ifdef ADD_N
+  measure("Addition (array)    ", funcAddSubN    , K, sec_us);
+  measure("Mult. (array)       ", funcMulN       , K, sec_us);
+  measure("Division (array)    ", funcDivN       , K, sec_us);
+  measure("FMA (array)         ", funcFMAN       , K, sec_us);
+  measure("Square root (array) ", funcSqrtN      , K, sec_us);
+  measure("Rint (array)        ", funcRintN      , K, sec_us);
+  measure("Sin (array)         ", funcSinN       , K, sec_us);
+  measure("Exp (array)         ", funcExpN       , K, sec_us);
+  measure("Log (array)         ", funcLogN       , K, sec_us);
+  measure("Pow (array)         ", funcPowN       , K, sec_us);
+#endif
+
   exit(0);
 }
@@ -0,0 +1,106 @@
+//  See https://github.com/shibatch/tlfloat for our project.
+//        Copyright Naoki Shibata and contributors.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This program measures the throughput of BigUInt multiplication with
+// Karatsuba and Toom-3 algorithms at each width, in order to find
+// the crossover point for TLFLOAT_TOOM3_THRESHOLD.
+
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <random>
+#include <cstdint>
+#include <tlfloat/tlfloatconfig.hpp>
+#include <tlfloat/bigint.hpp>
+
+using namespace std;
+using namespace tlfloat;
+
+const int K = 16;
+
+template<int N>
+struct Data {
+  BigUInt<N-1> x[K], y[K];
+  BigUInt<N> z[K];
+};
+
+template<int N> static Data<N> benchData;
+
+template<int N> static void funcKaratsuba() {
+  for(int i=0;i<K;i++) benchData<N>.z[i] = BigUInt<N>::mulKaratsuba(benchData<N>.x[i], benchData<N>.y[i]);
+}
+
+template<int N> static void funcToom3() {
+  for(int i=0;i<K;i++) benchData<N>.z[i] = BigUInt<N>::mulToom3(benchData<N>.x[i], benchData<N>.y[i]);
+}
+
+void donothing(void *);
+
+static inline int64_t timeus() {
+  return chrono::duration_cast<chrono::microseconds>
+    (chrono::system_clock::now() - chrono::system_clock::from_time_t(0)).count();
+}
+
+static double measure(void (*func)(void), void *ptr, int64_t sec_us) {
+  int64_t N = 10, t0, t1, t2, t3;
+
+  for(;;) {
+    t0 = timeus();
+    for(int64_t i=0;i<N;i++) { (*func)(); donothing(ptr); }
+    t1 = timeus();
+    if (t1 - t0 > 100000) break;
+    N *= 2;
+  }
+
+  const int64_t M = N * sec_us / (t1 - t0);
+
+  this_thread::sleep_for(chrono::microseconds(sec_us));
+
+  t2 = timeus();
+  for(int64_t i=0;i<M;i++) { (*func)(); donothing(ptr); }
+  t3 = timeus();
+
+  return M * K / double(t3 - t2);
+}
+
+template<int N>
+static void run(mt19937_64 &rng, int64_t sec_us) {
+  for(int i=0;i<K;i++) {
+    for(int j=0;j<(1 << (N - 7));j++) {
+      benchData<N>.x[i].setWord(j, rng());
+      benchData<N>.y[i].setWord(j, rng());
+    }
+  }
+
+  double k = measure(funcKaratsuba<N>, &benchData<N>, sec_us);
+  double t = measure(funcToom3<N>, &benchData<N>, sec_us);
+
+  printf("%5d x %5d bits : Karatsuba %10.4g, Toom-3 %10.4g Mops/second, %s%s\n",
+	 1 << (N - 1), 1 << (N - 1), k, t, t > k ? "Toom-3 is faster" : "Karatsuba is faster",
+	 N == TLFLOAT_TOOM3_THRESHOLD ? " (threshold)" : "");
+}
+
+int main(int argc, char **argv) {
+  int64_t sec_us = 1000000;
+  if (argc >= 2) sec_us = int64_t(atof(argv[1]) * 1000000);
+
+  mt19937_64 rng(1);
+
+  time_t t = time(NULL);
+  printf("Date                 : %s", ctime(&t));
+  printf("TLFloat version      : %d.%d.%d\n", TLFLOAT_VERSION_MAJOR, TLFLOAT_VERSION_MINOR, TLFLOAT_VERSION_PATCH);
+  printf("Config               : BigUInt multiplication, TLFLOAT_TOOM3_THRESHOLD = %d\n", TLFLOAT_TOOM3_THRESHOLD);
+  printf("Measurement time     : %g sec\n", sec_us / 1000000.0);
+
+  run<10>(rng, sec_us);
+  run<11>(rng, sec_us);
+  run<12>(rng, sec_us);
+  run<13>(rng, sec_us);
+  run<14>(rng, sec_us);
+  run<15>(rng, sec_us);
+
+  exit(0);
+}
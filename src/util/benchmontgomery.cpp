@@ -0,0 +1,152 @@
+//  See https://github.com/shibatch/tlfloat for our project.
+//        Copyright Naoki Shibata and contributors.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This program measures the throughput of modular exponentiation
+// with BigUInt::Montgomery. The exponents and the modulus have the
+// full width of BigUInt<N>.
+
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <random>
+#include <cstdint>
+#include <tlfloat/tlfloatconfig.hpp>
+#include <tlfloat/bigint.hpp>
+
+using namespace std;
+using namespace tlfloat;
+
+const int K = 16;
+
+template<int N>
+struct Data {
+  BigUInt<N> a[K], b[K], e[K], f[K], r[K];
+  typename BigUInt<N>::Montgomery *mg;
+};
+
+template<int N> static Data<N> benchData;
+
+// Right-to-left binary method, which Montgomery::pow used to implement
+template<int N> static BigUInt<N> binaryPow(const typename BigUInt<N>::Montgomery &mg, BigUInt<N> a, BigUInt<N> e) {
+  BigUInt<N> r = mg.one;
+  for (;;) {
+    if (e.getWord(0) & 1) r = mg.mul(r, a);
+    e >>= 1;
+    if (e.isZero()) break;
+    a = mg.sqr(a);
+  }
+  return r;
+}
+
+template<int N> static void funcBinary() {
+  Data<N> &d = benchData<N>;
+  for(int i=0;i<K;i++) d.r[i] = binaryPow<N>(*d.mg, d.a[i], d.e[i]);
+}
+
+template<int N> static void funcWindow() {
+  Data<N> &d = benchData<N>;
+  for(int i=0;i<K;i++) d.r[i] = d.mg->pow(d.a[i], d.e[i]);
+}
+
+template<int N> static void funcBatch() {
+  Data<N> &d = benchData<N>;
+  d.mg->pow(d.r, d.a, d.e[0], K);
+}
+
+template<int N> static void funcTwoPow() {
+  Data<N> &d = benchData<N>;
+  for(int i=0;i<K;i++) d.r[i] = d.mg->mul(d.mg->pow(d.a[i], d.e[i]), d.mg->pow(d.b[i], d.f[i]));
+}
+
+template<int N> static void funcMultipow() {
+  Data<N> &d = benchData<N>;
+  for(int i=0;i<K;i++) {
+    const BigUInt<N> a[2] = { d.a[i], d.b[i] }, e[2] = { d.e[i], d.f[i] };
+    d.r[i] = d.mg->multipow(a, e);
+  }
+}
+
+void donothing(void *);
+
+static inline int64_t timeus() {
+  return chrono::duration_cast<chrono::microseconds>
+    (chrono::system_clock::now() - chrono::system_clock::from_time_t(0)).count();
+}
+
+static double measure(void (*func)(void), void *ptr, int64_t sec_us) {
+  int64_t N = 1, t0, t1, t2, t3;
+
+  for(;;) {
+    t0 = timeus();
+    for(int64_t i=0;i<N;i++) { (*func)(); donothing(ptr); }
+    t1 = timeus();
+    if (t1 - t0 > 100000) break;
+    N *= 2;
+  }
+
+  const int64_t M = N * sec_us / (t1 - t0) + 1;
+
+  this_thread::sleep_for(chrono::microseconds(sec_us));
+
+  t2 = timeus();
+  for(int64_t i=0;i<M;i++) { (*func)(); donothing(ptr); }
+  t3 = timeus();
+
+  return M * K / double(t3 - t2) * 1000000.0;
+}
+
+template<int N>
+static void run(mt19937_64 &rng, int64_t sec_us) {
+  Data<N> &d = benchData<N>;
+
+  BigUInt<N> m;
+  for(int j=0;j<(1 << (N - 6));j++) m.setWord(j, rng());
+  m.setWord(0, m.getWord(0) | 1);
+  m.setWord((1 << (N - 6)) - 1, m.getWord((1 << (N - 6)) - 1) | (uint64_t(1) << 63));
+  d.mg = new typename BigUInt<N>::Montgomery(m);
+
+  for(int i=0;i<K;i++) {
+    for(int j=0;j<(1 << (N - 6));j++) {
+      d.a[i].setWord(j, rng());
+      d.b[i].setWord(j, rng());
+      d.e[i].setWord(j, rng());
+      d.f[i].setWord(j, rng());
+    }
+    d.a[i] = d.mg->transform(d.a[i] % m);
+    d.b[i] = d.mg->transform(d.b[i] % m);
+  }
+
+  printf("%5d bits : binary %10.4g, window %10.4g, batch %10.4g, two pows %10.4g, multipow %10.4g /second\n",
+	 1 << N,
+	 measure(funcBinary<N>, &d, sec_us),
+	 measure(funcWindow<N>, &d, sec_us),
+	 measure(funcBatch<N>, &d, sec_us),
+	 measure(funcTwoPow<N>, &d, sec_us),
+	 measure(funcMultipow<N>, &d, sec_us));
+
+  delete d.mg;
+}
+
+int main(int argc, char **argv) {
+  int64_t sec_us = 1000000;
+  if (argc >= 2) sec_us = int64_t(atof(argv[1]) * 1000000);
+
+  mt19937_64 rng(1);
+
+  time_t t = time(NULL);
+  printf("Date                 : %s", ctime(&t));
+  printf("TLFloat version      : %d.%d.%d\n", TLFLOAT_VERSION_MAJOR, TLFLOAT_VERSION_MINOR, TLFLOAT_VERSION_PATCH);
+  printf("Config               : BigUInt::Montgomery exponentiation\n");
+  printf("Measurement time     : %g sec\n", sec_us / 1000000.0);
+
+  run<7>(rng, sec_us);
+  run<8>(rng, sec_us);
+  run<9>(rng, sec_us);
+  run<10>(rng, sec_us);
+  run<11>(rng, sec_us);
+
+  exit(0);
+}
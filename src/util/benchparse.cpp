@@ -0,0 +1,102 @@
+//  See https://github.com/shibatch/tlfloat for our project.
+//        Copyright Naoki Shibata and contributors.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This program measures the throughput of the decimal string to
+// Quad/Octuple conversion, with and without the fast path.
+
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <random>
+#include <cstdint>
+#include <cstring>
+#include <tlfloat/tlfloatconfig.hpp>
+#include <tlfloat/tlmath.hpp>
+
+using namespace std;
+using namespace tlfloat;
+
+const int K = 256;
+
+struct {
+  char S[K][128], L[K][128];
+  Quad Q[K];
+  Octuple O[K];
+} D;
+
+template<typename T>
+static T parseWithoutFastPath(const char *s) {
+  typedef decltype(T::to_Unpacked_t()) Unpacked_t;
+  typedef decltype(Unpacked_t::xUnpackedFloat()) xUnpacked_t;
+  return T(xUnpacked_t(s).cast((Unpacked_t *)nullptr));
+}
+
+static void funcQuadShort() { for(int i=0;i<K;i++) D.Q[i] = Quad(D.S[i]); }
+static void funcQuadShortSlow() { for(int i=0;i<K;i++) D.Q[i] = parseWithoutFastPath<Quad>(D.S[i]); }
+static void funcQuadLong() { for(int i=0;i<K;i++) D.Q[i] = Quad(D.L[i]); }
+static void funcQuadLongSlow() { for(int i=0;i<K;i++) D.Q[i] = parseWithoutFastPath<Quad>(D.L[i]); }
+static void funcOctupleShort() { for(int i=0;i<K;i++) D.O[i] = Octuple(D.S[i]); }
+static void funcOctupleShortSlow() { for(int i=0;i<K;i++) D.O[i] = parseWithoutFastPath<Octuple>(D.S[i]); }
+
+void donothing(void *);
+
+static inline int64_t timeus() {
+  return chrono::duration_cast<chrono::microseconds>
+    (chrono::system_clock::now() - chrono::system_clock::from_time_t(0)).count();
+}
+
+void measure(const char* mes, void (*func)(void), int opPerCall, int64_t sec_us) {
+  int64_t N = 10, t0, t1, t2, t3;
+
+  for(;;) {
+    t0 = timeus();
+    for(int64_t i=0;i<N;i++) { (*func)(); donothing(&D); }
+    t1 = timeus();
+    if (t1 - t0 > 100000) break;
+    N *= 2;
+  }
+
+  const int64_t M = N * sec_us / (t1 - t0);
+
+  this_thread::sleep_for(chrono::microseconds(sec_us));
+
+  t2 = timeus();
+  for(int64_t i=0;i<M;i++) { (*func)(); donothing(&D); }
+  t3 = timeus();
+
+  printf("%s : %g Mops/second\n", mes, M * opPerCall / double(t3 - t2));
+}
+
+int main(int argc, char **argv) {
+  int64_t sec_us = 1000000;
+  if (argc >= 2) sec_us = int64_t(atof(argv[1]) * 1000000);
+
+  // Short strings have up to 36 significant digits, as printed by
+  // %.35Qe. Long strings have 72 digits and always take the slow path.
+
+  mt19937_64 rng(1);
+  for(int i=0;i<K;i++) {
+    Octuple x = ldexp(Octuple(int64_t(rng())) + ldexp(Octuple(int64_t(rng())), -64) + ldexp(Octuple(int64_t(rng())), -128),
+		      int(rng() % 400) - 200);
+    snprint(D.S[i], sizeof(D.S[i]), Quad(x).getUnpacked().cast((decltype(Quad::to_Unpacked_t().xUnpackedFloat()) *)0), 'e', 0, 35);
+    snprint(D.L[i], sizeof(D.L[i]), x.getUnpacked().cast((decltype(Octuple::to_Unpacked_t().xUnpackedFloat()) *)0), 'e', 0, 71);
+  }
+
+  time_t t = time(NULL);
+  printf("Date                 : %s", ctime(&t));
+  printf("TLFloat version      : %d.%d.%d\n", TLFLOAT_VERSION_MAJOR, TLFLOAT_VERSION_MINOR, TLFLOAT_VERSION_PATCH);
+  printf("Config               : decimal string parsing\n");
+  printf("Measurement time     : %g sec\n", sec_us / 1000000.0);
+
+  measure("Quad, 36 digits                 ", funcQuadShort       , K, sec_us);
+  measure("Quad, 36 digits, no fast path   ", funcQuadShortSlow   , K, sec_us);
+  measure("Quad, 72 digits                 ", funcQuadLong        , K, sec_us);
+  measure("Quad, 72 digits, no fast path   ", funcQuadLongSlow    , K, sec_us);
+  measure("Octuple, 36 digits              ", funcOctupleShort    , K, sec_us);
+  measure("Octuple, 36 digits, no fast path", funcOctupleShortSlow, K, sec_us);
+
+  exit(0);
+}
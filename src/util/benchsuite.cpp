@@ -0,0 +1,466 @@
+//  See https://github.com/shibatch/tlfloat for our project.
+//        Copyright Naoki Shibata and contributors.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This program measures the throughput of the functions in tlmath.hpp
+// and tlfloat.h for every FP type and every way of calling them, and
+// writes the results in JSON format.
+//
+// Usage : bench_tlfloat_suite [<measurement time in sec>] [-o <JSON file>] [-f <filter>] [-j <max threads>]
+//
+// Only the entries whose "type/api/function" contains the filter
+// string are measured. With -j, each entry is run on 1, 2, 4, ... up
+// to the given number of threads at the same time, and the aggregate
+// throughput and the per-thread efficiency are reported. Each thread
+// has its own input and output arrays, so a drop in efficiency
+// reflects frequency scaling, SMT, or state shared inside the library.
+
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <string>
+#include <functional>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <tlfloat/tlfloatconfig.hpp>
+#include <tlfloat/tlmath.hpp>
+
+#define TLFLOAT_LIBQUADMATH_EMULATION
+#include <tlfloat/tlfloat.h>
+
+using namespace std;
+using namespace tlfloat;
+
+const int K = 256;
+
+// Each thread has its own copy of the input and output arrays, aligned
+// to cache lines so that threads do not share any line
+
+template<typename S>
+struct alignas(64) Data {
+  S W[K], A[K], B[K], C[K], U[K], P[K], G[K];
+  double D[K];
+  int64_t L[K];
+  int I[K];
+  char Str[K][80];
+};
+
+template<typename S> static thread_local Data<S> benchData;
+
+struct Entry {
+  string type, api, func;
+  function<void()> f;
+};
+
+static vector<Entry> entries;
+
+// Functions that initialize benchData of the calling thread
+
+static vector<void (*)()> fillers;
+
+void donothing(void *);
+
+// Input values are generated in type T and stored in S, which has
+// the same data layout as T
+
+template<typename T, typename S>
+static void fill() {
+  static_assert(sizeof(T) == sizeof(S));
+  Data<S> &d = benchData<S>;
+  auto set = [](S &s, double v) { T t = T(v); memcpy((void *)&s, (void *)&t, sizeof(S)); };
+  for(int i=0;i<K;i++) {
+    set(d.A[i], (i * 0.0391 - 5.0) * ((i & 1) ? -1 : 1) + 0.01);        // any sign, |x| < 6
+    set(d.B[i], (i * 0.0217 + 0.5) * ((i & 2) ? -1 : 1));               // any sign, non-zero
+    set(d.C[i], (i * 0.0113 + 0.1) * ((i & 4) ? -1 : 1));
+    set(d.U[i], (i * 0.0077 - 0.98));                                   // (-1, 1)
+    set(d.P[i], i * 0.0391 + 0.01);                                     // positive
+    set(d.G[i], i * 0.0391 + 1.01);                                     // greater than 1
+    d.D[i] = i * 1.2345 - 150.0;
+    d.L[i] = i * 12345 - 1500000;
+    snprintf(d.Str[i], sizeof(d.Str[i]), "%.17g", i * 1.2345e-3 - 0.15);
+  }
+}
+
+static void addFiller(void (*f)()) {
+  f();
+  if (find(fillers.begin(), fillers.end(), f) == fillers.end()) fillers.push_back(f);
+}
+
+template<typename S, typename F>
+static void unary(const char *type, const char *api, const char *func, S (Data<S>::*in)[K], F f) {
+  entries.push_back({ type, api, func, [in, f]() {
+    Data<S> &d = benchData<S>;
+    for(int i=0;i<K;i++) d.W[i] = f((d.*in)[i]);
+    donothing(&d);
+  } });
+}
+
+template<typename S, typename F>
+static void binary(const char *type, const char *api, const char *func, S (Data<S>::*in0)[K], S (Data<S>::*in1)[K], F f) {
+  entries.push_back({ type, api, func, [in0, in1, f]() {
+    Data<S> &d = benchData<S>;
+    for(int i=0;i<K;i++) d.W[i] = f((d.*in0)[i], (d.*in1)[i]);
+    donothing(&d);
+  } });
+}
+
+template<typename S, typename F>
+static void custom(const char *type, const char *api, const char *func, F f) {
+  entries.push_back({ type, api, func, [f]() {
+    Data<S> &d = benchData<S>;
+    for(int i=0;i<K;i++) f(d, i);
+    donothing(&d);
+  } });
+}
+
+// Lists of the functions. The second and third arguments specify
+// the input arrays.
+
+#define UNARY_FUNCS(F)							\
+  F(sqrt, P) F(cbrt, A) F(fabs, A)					\
+  F(trunc, A) F(floor, A) F(ceil, A) F(round, A) F(rint, A)		\
+  F(sin, A) F(cos, A) F(tan, A) F(asin, U) F(acos, U) F(atan, A)	\
+  F(exp, A) F(exp2, A) F(exp10, A) F(expm1, A)				\
+  F(log, P) F(log2, P) F(log10, P) F(log1p, P)				\
+  F(sinh, A) F(cosh, A) F(tanh, A) F(asinh, A) F(acosh, G) F(atanh, U) \
+  F(erf, A) F(erfc, A) F(tgamma, P) F(lgamma, P)
+
+#define UNARY_FUNCS_PI(F) F(sinpi, A) F(cospi, A) F(tanpi, A)
+
+#define BINARY_FUNCS(F)							\
+  F(atan2, A, B) F(pow, P, A) F(hypot, A, B)				\
+  F(fmod, A, C) F(remainder, A, C)					\
+  F(fmax, A, B) F(fmin, A, B) F(fdim, A, B) F(copysign, A, B) F(nextafter, A, B)
+
+// Template API
+
+template<typename T>
+static void addTemplate(const char *type) {
+  typedef T S;
+  addFiller(fill<T, S>);
+  const char *api = "template";
+
+#define TEMPLATE_UNARY(NAME, X) unary<S>(type, api, #NAME, &Data<S>::X, [](S x) { return NAME(x); });
+#define TEMPLATE_BINARY(NAME, X, Y) binary<S>(type, api, #NAME, &Data<S>::X, &Data<S>::Y, [](S x, S y) { return NAME(x, y); });
+
+  binary<S>(type, api, "add", &Data<S>::A, &Data<S>::B, [](S x, S y) { return x + y; });
+  binary<S>(type, api, "sub", &Data<S>::A, &Data<S>::B, [](S x, S y) { return x - y; });
+  binary<S>(type, api, "mul", &Data<S>::A, &Data<S>::B, [](S x, S y) { return x * y; });
+  binary<S>(type, api, "div", &Data<S>::A, &Data<S>::B, [](S x, S y) { return x / y; });
+  custom<S>(type, api, "fma", [](Data<S> &d, int i) { d.W[i] = fma(d.A[i], d.B[i], d.C[i]); });
+  custom<S>(type, api, "compare", [](Data<S> &d, int i) { d.I[i] = (d.A[i] < d.B[i]) + (d.A[i] == d.C[i]); });
+  UNARY_FUNCS(TEMPLATE_UNARY);
+  UNARY_FUNCS_PI(TEMPLATE_UNARY);
+  BINARY_FUNCS(TEMPLATE_BINARY);
+  custom<S>(type, api, "sincos", [](Data<S> &d, int i) { auto p = sincos(d.A[i]); d.W[i] = p.first + p.second; });
+  custom<S>(type, api, "remquo", [](Data<S> &d, int i) { auto p = remquo(d.A[i], d.C[i]); d.W[i] = p.first; d.I[i] = int(p.second); });
+  custom<S>(type, api, "ldexp", [](Data<S> &d, int i) { d.W[i] = ldexp(d.A[i], i - 128); });
+  custom<S>(type, api, "frexp", [](Data<S> &d, int i) { d.W[i] = frexp(d.A[i], &d.I[i]); });
+  custom<S>(type, api, "modf", [](Data<S> &d, int i) { d.W[i] = modf(d.A[i], &d.B[i]); });
+  custom<S>(type, api, "ilogb", [](Data<S> &d, int i) { d.I[i] = ilogb(d.A[i]); });
+  custom<S>(type, api, "cast_to_double", [](Data<S> &d, int i) { d.D[i] = (double)d.A[i]; });
+  custom<S>(type, api, "cast_from_double", [](Data<S> &d, int i) { d.W[i] = S(d.D[i]); });
+  custom<S>(type, api, "cast_to_int64", [](Data<S> &d, int i) { d.L[i] = (int64_t)d.A[i]; });
+  custom<S>(type, api, "cast_from_int64", [](Data<S> &d, int i) { d.W[i] = S(d.L[i]); });
+  custom<S>(type, api, "strtod", [](Data<S> &d, int i) { d.W[i] = S(d.Str[i]); });
+  custom<S>(type, api, "to_string", [](Data<S> &d, int i) {
+    typedef decltype(S::to_Unpacked_t()) Unpacked_t;
+    typedef decltype(Unpacked_t::xUnpackedFloat()) xUnpacked_t;
+    snprint(d.Str[i], sizeof(d.Str[i]), d.A[i].getUnpacked().cast((xUnpacked_t *)0), 'g', 0, 20);
+  });
+  custom<S>(type, api, "to_string_shortest", [](Data<S> &d, int i) {
+    snprintShortest(d.Str[i], sizeof(d.Str[i]), d.A[i].getUnpacked(), 'g');
+  });
+}
+
+// C API. CAPI_NAME(sin) gives the name of the C function for each
+// type, e.g. tlfloat_sinq.
+
+#define CAPI_UNARY(NAME, X) unary<S>(type, api, #NAME, &Data<S>::X, [](S x) { return CAPI_NAME(NAME)(x); });
+#define CAPI_BINARY(NAME, X, Y) binary<S>(type, api, #NAME, &Data<S>::X, &Data<S>::Y, [](S x, S y) { return CAPI_NAME(NAME)(x, y); });
+
+#define CAPI_COMMON()							\
+  binary<S>(type, api, "add", &Data<S>::A, &Data<S>::B, [](S x, S y) { return CAPI_NAME(add)(x, y); }); \
+  binary<S>(type, api, "sub", &Data<S>::A, &Data<S>::B, [](S x, S y) { return CAPI_NAME(sub)(x, y); }); \
+  binary<S>(type, api, "mul", &Data<S>::A, &Data<S>::B, [](S x, S y) { return CAPI_NAME(mul)(x, y); }); \
+  binary<S>(type, api, "div", &Data<S>::A, &Data<S>::B, [](S x, S y) { return CAPI_NAME(div)(x, y); }); \
+  custom<S>(type, api, "fma", [](Data<S> &d, int i) { d.W[i] = CAPI_NAME(fma)(d.A[i], d.B[i], d.C[i]); }); \
+  UNARY_FUNCS(CAPI_UNARY);						\
+  UNARY_FUNCS_PI(CAPI_UNARY);						\
+  BINARY_FUNCS(CAPI_BINARY);						\
+  custom<S>(type, api, "remquo", [](Data<S> &d, int i) { d.W[i] = CAPI_NAME(remquo)(d.A[i], d.C[i], &d.I[i]); }); \
+  custom<S>(type, api, "ldexp", [](Data<S> &d, int i) { d.W[i] = CAPI_NAME(ldexp)(d.A[i], i - 128); }); \
+  custom<S>(type, api, "frexp", [](Data<S> &d, int i) { d.W[i] = CAPI_NAME(frexp)(d.A[i], &d.I[i]); }); \
+  custom<S>(type, api, "modf", [](Data<S> &d, int i) { d.W[i] = CAPI_NAME(modf)(d.A[i], &d.B[i]); })
+
+static void addCAPI() {
+  {
+    typedef float S;
+    addFiller(fill<Float, S>);
+    const char *type = "Float", *api = "capi";
+#define CAPI_NAME(NAME) tlfloat_ ## NAME ## f
+    CAPI_COMMON();
+    custom<S>(type, api, "strtod", [](Data<S> &d, int i) { d.W[i] = tlfloat_strtof(d.Str[i], nullptr); });
+    custom<S>(type, api, "snprintf", [](Data<S> &d, int i) { tlfloat_snprintf(d.Str[i], sizeof(d.Str[i]), "%.20_32g", Float(d.A[i])); });
+#undef CAPI_NAME
+  }
+  {
+    typedef double S;
+    addFiller(fill<Double, S>);
+    const char *type = "Double", *api = "capi";
+#define CAPI_NAME(NAME) tlfloat_ ## NAME
+    CAPI_COMMON();
+    custom<S>(type, api, "strtod", [](Data<S> &d, int i) { d.W[i] = tlfloat_strtod(d.Str[i], nullptr); });
+    custom<S>(type, api, "snprintf", [](Data<S> &d, int i) { tlfloat_snprintf(d.Str[i], sizeof(d.Str[i]), "%.20g", d.A[i]); });
+#undef CAPI_NAME
+  }
+  {
+    typedef tlfloat_quad_ S;
+    addFiller(fill<Quad, S>);
+    const char *type = "Quad", *api = "capi";
+#define CAPI_NAME(NAME) tlfloat_ ## NAME ## q
+    CAPI_COMMON();
+    custom<S>(type, api, "sincos", [](Data<S> &d, int i) { tlfloat_sincosq(d.A[i], &d.W[i], &d.B[i]); });
+    custom<S>(type, api, "compare", [](Data<S> &d, int i) { d.I[i] = tlfloat_lt_q_q(d.A[i], d.B[i]) + tlfloat_eq_q_q(d.A[i], d.C[i]); });
+    custom<S>(type, api, "ilogb", [](Data<S> &d, int i) { d.I[i] = tlfloat_ilogbq(d.A[i]); });
+    custom<S>(type, api, "cast_to_double", [](Data<S> &d, int i) { d.D[i] = tlfloat_cast_d_q(d.A[i]); });
+    custom<S>(type, api, "cast_from_double", [](Data<S> &d, int i) { d.W[i] = tlfloat_cast_q_d_(d.D[i]); });
+    custom<S>(type, api, "cast_to_int64", [](Data<S> &d, int i) { d.L[i] = tlfloat_cast_i64_q(d.A[i]); });
+    custom<S>(type, api, "cast_from_int64", [](Data<S> &d, int i) { d.W[i] = tlfloat_cast_q_i64_(d.L[i]); });
+    custom<S>(type, api, "strtod", [](Data<S> &d, int i) { d.W[i] = tlfloat_strtoq_(d.Str[i], nullptr); });
+    custom<S>(type, api, "snprintf", [](Data<S> &d, int i) { tlfloat_snprintf(d.Str[i], sizeof(d.Str[i]), "%.20Qg", d.A[i]); });
+#undef CAPI_NAME
+  }
+  {
+    typedef tlfloat_octuple_ S;
+    addFiller(fill<Octuple, S>);
+    const char *type = "Octuple", *api = "capi";
+#define CAPI_NAME(NAME) tlfloat_ ## NAME ## o
+    CAPI_COMMON();
+    custom<S>(type, api, "sincos", [](Data<S> &d, int i) { tlfloat_sincoso(d.A[i], &d.W[i], &d.B[i]); });
+    custom<S>(type, api, "compare", [](Data<S> &d, int i) { d.I[i] = tlfloat_lt_o_o(d.A[i], d.B[i]) + tlfloat_eq_o_o(d.A[i], d.C[i]); });
+    custom<S>(type, api, "ilogb", [](Data<S> &d, int i) { d.I[i] = tlfloat_ilogbo(d.A[i]); });
+    custom<S>(type, api, "cast_to_double", [](Data<S> &d, int i) { d.D[i] = tlfloat_cast_d_o(d.A[i]); });
+    custom<S>(type, api, "cast_from_double", [](Data<S> &d, int i) { d.W[i] = tlfloat_cast_o_d_(d.D[i]); });
+    custom<S>(type, api, "cast_to_int64", [](Data<S> &d, int i) { d.L[i] = tlfloat_cast_i64_o(d.A[i]); });
+    custom<S>(type, api, "cast_from_int64", [](Data<S> &d, int i) { d.W[i] = tlfloat_cast_o_i64_(d.L[i]); });
+    custom<S>(type, api, "strtod", [](Data<S> &d, int i) { d.W[i] = tlfloat_strtoo_(d.Str[i], nullptr); });
+    custom<S>(type, api, "snprintf", [](Data<S> &d, int i) { tlfloat_snprintf(d.Str[i], sizeof(d.Str[i]), "%.20Og", d.A[i]); });
+#undef CAPI_NAME
+  }
+}
+
+// C++11 API, in which tlfloat_quad and tlfloat_octuple are used as
+// arithmetic types. The functions for tlfloat_quad are the ones
+// emulating libquadmath.
+
+#define CPP11_UNARY(NAME, X) unary<S>(type, api, #NAME, &Data<S>::X, [](S x) { return S(CPP11_NAME(NAME)(x)); });
+#define CPP11_BINARY(NAME, X, Y) binary<S>(type, api, #NAME, &Data<S>::X, &Data<S>::Y, [](S x, S y) { return S(CPP11_NAME(NAME)(x, y)); });
+
+#define CPP11_COMMON()							\
+  binary<S>(type, api, "add", &Data<S>::A, &Data<S>::B, [](S x, S y) { return x + y; }); \
+  binary<S>(type, api, "sub", &Data<S>::A, &Data<S>::B, [](S x, S y) { return x - y; }); \
+  binary<S>(type, api, "mul", &Data<S>::A, &Data<S>::B, [](S x, S y) { return x * y; }); \
+  binary<S>(type, api, "div", &Data<S>::A, &Data<S>::B, [](S x, S y) { return x / y; }); \
+  custom<S>(type, api, "compare", [](Data<S> &d, int i) { d.I[i] = (d.A[i] < d.B[i]) + (d.A[i] == d.C[i]); }); \
+  custom<S>(type, api, "fma", [](Data<S> &d, int i) { d.W[i] = CPP11_NAME(fma)(d.A[i], d.B[i], d.C[i]); }); \
+  UNARY_FUNCS(CPP11_UNARY);						\
+  BINARY_FUNCS(CPP11_BINARY);						\
+  custom<S>(type, api, "cast_to_double", [](Data<S> &d, int i) { d.D[i] = (double)d.A[i]; }); \
+  custom<S>(type, api, "cast_from_double", [](Data<S> &d, int i) { d.W[i] = S(d.D[i]); }); \
+  custom<S>(type, api, "cast_to_int64", [](Data<S> &d, int i) { d.L[i] = (int64_t)d.A[i]; }); \
+  custom<S>(type, api, "cast_from_int64", [](Data<S> &d, int i) { d.W[i] = S(d.L[i]); })
+
+static void addCPP11API() {
+  {
+    typedef tlfloat_quad S;
+    addFiller(fill<Quad, S>);
+    const char *type = "Quad", *api = "cpp11";
+#define CPP11_NAME(NAME) NAME ## q
+    CPP11_COMMON();
+#undef CPP11_NAME
+  }
+  {
+    typedef tlfloat_octuple S;
+    addFiller(fill<Octuple, S>);
+    const char *type = "Octuple", *api = "cpp11";
+#define CPP11_NAME(NAME) tlfloat_ ## NAME ## o
+    CPP11_COMMON();
+#undef CPP11_NAME
+  }
+}
+
+static inline int64_t timeus() {
+  return chrono::duration_cast<chrono::microseconds>
+    (chrono::system_clock::now() - chrono::system_clock::from_time_t(0)).count();
+}
+
+// Returns the number of calls that takes about sec_us microseconds
+// on a single thread
+
+static int64_t calibrate(const Entry &e, int64_t sec_us) {
+  int64_t N = 10, t0, t1;
+
+  for(;;) {
+    t0 = timeus();
+    for(int64_t i=0;i<N;i++) e.f();
+    t1 = timeus();
+    if (t1 - t0 > 100000) break;
+    N *= 2;
+  }
+
+  return N * sec_us / (t1 - t0) + 1;
+}
+
+static double measure(const Entry &e, int opPerCall, int64_t sec_us) {
+  const int64_t M = calibrate(e, sec_us);
+
+  this_thread::sleep_for(chrono::microseconds(sec_us));
+
+  int64_t t2 = timeus();
+  for(int64_t i=0;i<M;i++) e.f();
+  int64_t t3 = timeus();
+
+  return M * opPerCall / double(t3 - t2);
+}
+
+// Runs M calls on each of nth threads, which start at the same time
+// and work on their own benchData. Returns the aggregate throughput.
+
+static double measureThreads(const Entry &e, int opPerCall, int64_t M, int nth) {
+  atomic<int> ready(0);
+  atomic<bool> go(false);
+  vector<int64_t> tend(nth);
+  vector<thread> threads;
+
+  for(int t=0;t<nth;t++) {
+    threads.emplace_back([&, t]() {
+      for(auto f : fillers) f();
+      ready++;
+      while(!go) this_thread::yield();
+      for(int64_t i=0;i<M;i++) e.f();
+      tend[t] = timeus();
+    });
+  }
+
+  while(ready < nth) this_thread::yield();
+  const int64_t t0 = timeus();
+  go = true;
+  for(auto &th : threads) th.join();
+
+  const int64_t t1 = *max_element(tend.begin(), tend.end());
+  return nth * M * opPerCall / double(t1 - t0);
+}
+
+int main(int argc, char **argv) {
+  int64_t sec_us = 1000000;
+  string jsonfn, filter;
+  int maxThreads = 0;
+
+  for(int i=1;i<argc;i++) {
+    if (strcmp(argv[i], "-o") == 0 && i+1 < argc) {
+      jsonfn = argv[++i];
+    } else if (strcmp(argv[i], "-f") == 0 && i+1 < argc) {
+      filter = argv[++i];
+    } else if (strcmp(argv[i], "-j") == 0 && i+1 < argc) {
+      maxThreads = max(atoi(argv[++i]), 1);
+    } else {
+      sec_us = int64_t(atof(argv[i]) * 1000000);
+    }
+  }
+
+  addTemplate<Half>("Half");
+  addTemplate<BFloat16>("BFloat16");
+  addTemplate<Float>("Float");
+  addTemplate<Double>("Double");
+  addTemplate<Quad>("Quad");
+  addTemplate<Octuple>("Octuple");
+  addCAPI();
+  addCPP11API();
+
+  time_t t = time(NULL);
+  char date[64];
+  strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&t));
+
+  printf("Date                 : %s\n", date);
+  printf("TLFloat version      : %d.%d.%d\n", TLFLOAT_VERSION_MAJOR, TLFLOAT_VERSION_MINOR, TLFLOAT_VERSION_PATCH);
+  printf("Measurement time     : %g sec\n", sec_us / 1000000.0);
+  if (maxThreads) printf("Max number of threads: %d (%u hardware threads)\n", maxThreads, thread::hardware_concurrency());
+
+  ofstream ofs;
+  if (!jsonfn.empty()) {
+    ofs.open(jsonfn);
+    if (!ofs) {
+      fprintf(stderr, "Could not open %s\n", jsonfn.c_str());
+      exit(-1);
+    }
+    ofs << "{\n";
+    ofs << "  \"date\": \"" << date << "\",\n";
+    ofs << "  \"tlfloat_version\": \"" << TLFLOAT_VERSION_MAJOR << "." << TLFLOAT_VERSION_MINOR << "." << TLFLOAT_VERSION_PATCH << "\",\n";
+    ofs << "  \"measurement_time\": " << sec_us / 1000000.0 << ",\n";
+    ofs << "  \"unit\": \"Mops/second\",\n";
+    if (maxThreads) ofs << "  \"max_threads\": " << maxThreads << ",\n";
+    ofs << "  \"results\": [";
+  }
+
+  bool first = true;
+  for(auto &e : entries) {
+    const string name = e.type + "/" + e.api + "/" + e.func;
+    if (name.find(filter) == string::npos) continue;
+
+    if (maxThreads == 0) {
+      const double mops = measure(e, K, sec_us);
+      printf("%-40s : %g Mops/second\n", name.c_str(), mops);
+      fflush(stdout);
+
+      if (ofs.is_open()) {
+	ofs << (first ? "\n" : ",\n");
+	ofs << "    { \"type\": \"" << e.type << "\", \"api\": \"" << e.api << "\", \"function\": \"" << e.func
+	    << "\", \"mops\": " << mops << " }";
+	first = false;
+      }
+      continue;
+    }
+
+    // The numbers of threads are 1, 2, 4, ... and maxThreads. The
+    // efficiency is the aggregate throughput divided by the number of
+    // threads times the single-thread throughput.
+
+    const int64_t M = calibrate(e, sec_us);
+    double mops1 = 0;
+
+    for(int nth=1;;nth = min(nth * 2, maxThreads)) {
+      this_thread::sleep_for(chrono::microseconds(sec_us));
+
+      const double mops = measureThreads(e, K, M, nth);
+      if (nth == 1) mops1 = mops;
+      const double efficiency = mops / (nth * mops1);
+
+      printf("%-40s : %3d threads : %g Mops/second, efficiency %.3f\n", name.c_str(), nth, mops, efficiency);
+      fflush(stdout);
+
+      if (ofs.is_open()) {
+	ofs << (first ? "\n" : ",\n");
+	ofs << "    { \"type\": \"" << e.type << "\", \"api\": \"" << e.api << "\", \"function\": \"" << e.func
+	    << "\", \"threads\": " << nth << ", \"mops\": " << mops << ", \"efficiency\": " << efficiency << " }";
+	first = false;
+      }
+
+      if (nth == maxThreads) break;
+    }
+  }
+
+  if (ofs.is_open()) {
+    ofs << "\n  ]\n}\n";
+    ofs.close();
+  }
+
+  exit(0);
+}
@@ -0,0 +1,121 @@
+//  See https://github.com/shibatch/tlfloat for our project.
+//        Copyright Naoki Shibata and contributors.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// This program generates pow10tab.hpp. Each entry of a table holds
+// floor(10^(i*step) * 2^(64*words - 1 - floor(log2(10^(i*step))))),
+// which is computed with exact integer arithmetic.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <vector>
+
+using namespace std;
+
+// Multi-precision integers are represented by vectors of 32-bit limbs
+
+static void mulSmall(vector<uint32_t> &x, uint32_t m) {
+  uint64_t carry = 0;
+  for(auto &w : x) {
+    uint64_t t = (uint64_t)w * m + carry;
+    w = (uint32_t)t;
+    carry = t >> 32;
+  }
+  if (carry) x.push_back((uint32_t)carry);
+}
+
+static void divSmall(vector<uint32_t> &x, uint32_t d) {
+  uint64_t r = 0;
+  for(int i=(int)x.size()-1;i>=0;i--) {
+    uint64_t t = (r << 32) | x[i];
+    x[i] = (uint32_t)(t / d);
+    r = t % d;
+  }
+  while(x.size() > 1 && x.back() == 0) x.pop_back();
+}
+
+static void mulPow10(vector<uint32_t> &x, int n) {
+  for(;n >= 9;n -= 9) mulSmall(x, 1000000000);
+  uint32_t m = 1;
+  for(;n > 0;n--) m *= 10;
+  mulSmall(x, m);
+}
+
+static void divPow10(vector<uint32_t> &x, int n) {
+  for(;n >= 9;n -= 9) divSmall(x, 1000000000);
+  uint32_t m = 1;
+  for(;n > 0;n--) m *= 10;
+  divSmall(x, m);
+}
+
+static int64_t bitLength(const vector<uint32_t> &x) {
+  int64_t t = x.size() - 1, n = 0;
+  while((uint64_t(x[t]) >> n) != 0) n++;
+  return t * 32 + n;
+}
+
+// Returns the top 64*words bits of x
+
+static vector<uint64_t> topBits(const vector<uint32_t> &x, int words) {
+  vector<uint64_t> r(words);
+  int64_t lsb = bitLength(x) - 64 * words;
+  for(int i=0;i<words*64;i++) {
+    int64_t p = lsb + i;
+    if (p < 0) continue;
+    if ((x[p >> 5] >> (p & 31)) & 1) r[i >> 6] |= uint64_t(1) << (i & 63);
+  }
+  return r;
+}
+
+static void generate(const char *name, int words, int shift, int kmin, int kmax) {
+  const int step = 1 << shift, imin = kmin >> shift, imax = kmax >> shift;
+  vector<vector<uint64_t>> tab(imax - imin + 1);
+
+  vector<uint32_t> x = { 1 };
+  for(int i=0;i<=imax;i++) {
+    if (i >= imin) tab[i - imin] = topBits(x, words);
+    mulPow10(x, step);
+  }
+
+  // floor(2^m / 10^n) has enough bits for all negative exponents
+
+  const int64_t m = (int64_t)(-imin) * step * 3322 / 1000 + 64 * words + 128;
+  vector<uint32_t> y(m / 32 + 1);
+  y[m / 32] = uint32_t(1) << (m % 32);
+  for(int i=-1;i>=imin;i--) {
+    divPow10(y, step);
+    tab[i - imin] = topBits(y, words);
+  }
+
+  printf("    static constexpr int tlfloat_pow10tab_%s_words = %d;\n", name, words);
+  printf("    static constexpr int tlfloat_pow10tab_%s_shift = %d;\n", name, shift);
+  printf("    static constexpr int tlfloat_pow10tab_%s_min = %d;\n", name, imin);
+  printf("    static constexpr int tlfloat_pow10tab_%s_max = %d;\n", name, imax);
+  printf("\n");
+  printf("#ifndef __CUDA_ARCH__\n");
+  printf("    static constexpr uint64_t tlfloat_pow10tab_%s[][%d] = {\n", name, words);
+  printf("#else\n");
+  printf("    static __device__ constexpr uint64_t tlfloat_pow10tab_%s[][%d] = {\n", name, words);
+  printf("#endif\n");
+  for(auto &e : tab) {
+    printf("      {");
+    for(int j=0;j<words;j++) printf(" 0x%016llxULL,", (unsigned long long)e[j]);
+    printf(" },\n");
+  }
+  printf("    };\n");
+}
+
+int main(int argc, char **argv) {
+  printf("#include <cstdint>\n");
+  printf("\n");
+  printf("namespace tlfloat {\n");
+  printf("  namespace detail {\n");
+  generate("a", 6, 6, -4898, 4966);
+  printf("\n");
+  generate("b", 10, 8, -78841, 78984);
+  printf("  };\n");
+  printf("}\n");
+}